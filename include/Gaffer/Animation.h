@@ -44,6 +44,8 @@
 #include "boost/multi_index/ordered_index.hpp"
 #include "boost/multi_index_container.hpp"
 
+#include <atomic>
+
 namespace Gaffer
 {
 
@@ -164,12 +166,20 @@ class GAFFER_API Animation : public ComputeNode
 				FloatPlug *outPlug();
 				const FloatPlug *outPlug() const;
 
+			protected :
+
+				void parentChanging( Gaffer::GraphComponent *newParent ) override;
+
 			private :
 
 				friend class Key;
 				friend KeyIterator;
 				friend ConstKeyIterator;
 
+				// Must be called whenever `m_keys` or the
+				// properties of a key are modified.
+				void keysChanged();
+
 				typedef boost::multi_index::multi_index_container<
 					KeyPtr,
 					boost::multi_index::indexed_by<
@@ -219,6 +229,17 @@ class GAFFER_API Animation : public ComputeNode
 		static CurvePlug *inputCurve( ValuePlug *plug );
 		static const CurvePlug *inputCurve( const ValuePlug *plug );
 
+		// Compiled representation of all our curves, storing
+		// the keys in contiguous arrays for fast evaluation.
+		// Built on demand and discarded whenever a curve is
+		// edited, added or removed.
+		struct CompiledCurves;
+		const CompiledCurves *compiledCurves() const;
+		void invalidateCompiledCurves();
+		float evaluate( const CurvePlug *curve, float time ) const;
+
+		mutable std::atomic<const CompiledCurves *> m_compiledCurves;
+
 		static size_t g_firstPlugIndex;
 
 };
@@ -73,6 +73,28 @@ class GAFFER_API BackgroundTask : public boost::noncopyable
 
 		typedef std::function<void ( const IECore::Canceller &canceller )> Function;
 
+		/// Determines the order in which pending tasks are started,
+		/// and allows urgent tasks to take resources from less urgent
+		/// ones.
+		enum Priority
+		{
+			/// Work which may turn out not to be needed, such as
+			/// precomputing results in anticipation of a request.
+			/// Speculative tasks run with limited concurrency, are not
+			/// started while more urgent tasks are running, and are
+			/// preempted when more urgent tasks are launched. Preemption
+			/// cancels the task via its `Canceller`, and if the function exits
+			/// by throwing `IECore::Cancelled`, it is queued to be called
+			/// again from the start. Speculative functions must therefore be
+			/// safe to call more than once.
+			Speculative,
+			/// Work needed to update visible UI elements.
+			Visible,
+			/// Work that the user is actively waiting on, such as
+			/// updating the Viewer following an edit.
+			Interactive
+		};
+
 		/// Launches a background task to run `function`, which is expected
 		/// to perform asynchronous computes using the `subject` plug.
 		/// The `function` is passed an `IECore::Canceller` object which must
@@ -80,7 +102,7 @@ class GAFFER_API BackgroundTask : public boost::noncopyable
 		///
 		/// > Note : Gaffer's responsiveness to asynchronous edits is entirely
 		/// > dependent on prompt responses to cancellation requests.
-		BackgroundTask( const Plug *subject, const Function &function );
+		BackgroundTask( const Plug *subject, const Function &function, Priority priority = Visible );
 		/// Calls `cancelAndWait()`. This allows the lifetime of the
 		/// BackgroundTask to be used to protect access to resources
 		//  required by the background function.
@@ -118,8 +140,12 @@ class GAFFER_API BackgroundTask : public boost::noncopyable
 		/// >   become `Cancelled`. The `function` may have completed
 		/// >   concurrently, or may have ignored the request
 		/// >   for cancellation.
+		/// > - A Speculative task returns to Pending when it
+		/// >   is preempted.
 		Status status() const;
 
+		Priority priority() const;
+
 	private :
 
 		// Called by `Action` to ensure that any related tasks are cancelled
@@ -136,6 +162,10 @@ class GAFFER_API BackgroundTask : public boost::noncopyable
 		struct TaskData;
 		std::shared_ptr<TaskData> m_taskData;
 
+		// Queues tasks by priority and runs them on the TBB
+		// thread pool.
+		class Scheduler;
+
 };
 
 } // namespace Gaffer
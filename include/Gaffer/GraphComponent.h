@@ -158,6 +158,8 @@ class GAFFER_API GraphComponent : public IECore::RunTimeTyped, public boost::sig
 		/// \undoable
 		void clearChildren();
 		/// Get an immediate child by name, performing a runTimeCast to T.
+		/// Lookups are performed using an index when there are many children,
+		/// so are constant time rather than linear in the number of children.
 		template<typename T=GraphComponent>
 		T *getChild( const IECore::InternedString &name );
 		/// Get an immediate child by name, performing a runTimeCast to T.
@@ -277,6 +279,8 @@ class GAFFER_API GraphComponent : public IECore::RunTimeTyped, public boost::sig
 		static std::string unprefixedTypeName( const char *typeName );
 
 		void throwIfChildRejected( const GraphComponent *potentialChild ) const;
+		const GraphComponent *getChildInternal( const IECore::InternedString &name ) const;
+		void updateChildIndex();
 		void setNameInternal( const IECore::InternedString &name );
 		void addChildInternal( GraphComponentPtr child, size_t index );
 		void removeChildInternal( GraphComponentPtr child, bool emitParentChanged );
@@ -285,10 +289,16 @@ class GAFFER_API GraphComponent : public IECore::RunTimeTyped, public boost::sig
 		struct Signals;
 		Signals *signals();
 
+		// Index from name to child, used to accelerate `getChild()`.
+		// Only built once the number of children exceeds a threshold,
+		// as linear search is quicker for small numbers of children.
+		struct ChildIndex;
+
 		std::unique_ptr<Signals> m_signals;
 		IECore::InternedString m_name;
 		GraphComponent *m_parent;
 		ChildContainer m_children;
+		std::unique_ptr<ChildIndex> m_childIndex;
 
 };
 
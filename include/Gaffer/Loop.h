@@ -103,6 +103,13 @@ class IECORE_EXPORT Loop : public ComputeNode
 		const ValuePlug *descendantPlug( const ValuePlug *plug, const std::vector<IECore::InternedString> &relativeName ) const;
 		const ValuePlug *sourcePlug( const ValuePlug *output, const Context *context, int &sourceLoopIndex, IECore::InternedString &indexVariable ) const;
 
+		// Returns true if `plug` is `outPlug()` or one of its descendants.
+		bool isOutput( const ValuePlug *plug ) const;
+		// Evaluates `plug` for each iteration before `lastIndex`, in order,
+		// calling `f( plug, hash )` for each one.
+		template<typename F>
+		void iterate( const ValuePlug *plug, const Context *context, const IECore::InternedString &indexVariable, int lastIndex, F &&f ) const;
+
 };
 
 IE_CORE_DECLAREPTR( Loop )
@@ -76,6 +76,7 @@ class GAFFER_API Node : public GraphComponent
 
 		typedef boost::signal<void (Plug *)> UnaryPlugSignal;
 		typedef boost::signal<void (Plug *, Plug *)> BinaryPlugSignal;
+		typedef boost::signal<void ( const std::vector<Plug *> & )> PlugVectorSignal;
 
 		/// @name Plug signals
 		/// These signals are emitted on events relating to child Plugs
@@ -116,6 +117,12 @@ class GAFFER_API Node : public GraphComponent
 		/// onto an input plug of a plain Node (and potentially onwards if that plug
 		/// has its own output connections).
 		UnaryPlugSignal &plugDirtiedSignal();
+		/// Emitted once at the end of each dirty propagation, after plugDirtiedSignal()
+		/// has been emitted for the individual plugs, with all the plugs of this
+		/// node that were dirtied. Observers interested in many plugs should prefer
+		/// this to plugDirtiedSignal(), since it requires a single slot call per node
+		/// rather than one per plug. The same restrictions apply as for plugDirtiedSignal().
+		PlugVectorSignal &plugsDirtiedSignal();
 		/// Emitted when the flags are changed for a plug of this node.
 		UnaryPlugSignal &plugFlagsChangedSignal();
 		//@}
@@ -192,6 +199,7 @@ class GAFFER_API Node : public GraphComponent
 		UnaryPlugSignal m_plugInputChangedSignal;
 		UnaryPlugSignal m_plugFlagsChangedSignal;
 		UnaryPlugSignal m_plugDirtiedSignal;
+		PlugVectorSignal m_plugsDirtiedSignal;
 		ErrorSignal m_errorSignal;
 
 };
@@ -37,6 +37,7 @@
 #ifndef GAFFER_PARALLELALGO_H
 #define GAFFER_PARALLELALGO_H
 
+#include "Gaffer/BackgroundTask.h"
 #include "Gaffer/Export.h"
 
 #include "boost/signals.hpp"
@@ -47,7 +48,6 @@
 namespace Gaffer
 {
 
-class BackgroundTask;
 class Plug;
 
 namespace ParallelAlgo
@@ -81,7 +81,7 @@ GAFFER_API void popUIThreadCallHandler();
 /// explicitly. Implicit cancellation is also performed using the `subject`
 /// argument : see the `BackgroundTask` documentation for details.
 typedef std::function<void ()> BackgroundFunction;
-GAFFER_API std::unique_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, BackgroundFunction function );
+GAFFER_API std::unique_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, BackgroundFunction function, BackgroundTask::Priority priority = BackgroundTask::Visible );
 
 } // namespace ParallelAlgo
 
@@ -61,6 +61,8 @@ void bindPath();
 namespace Gaffer
 {
 
+class Plug;
+
 IE_CORE_FORWARDDECLARE( Path )
 IE_CORE_FORWARDDECLARE( PathFilter )
 
@@ -138,6 +140,13 @@ class GAFFER_API Path : public IECore::RunTimeTyped
 		/// type.
 		virtual PathPtr copy() const;
 
+		/// Returns the plug used to generate children and properties
+		/// for this path, if any. This is used as the subject for
+		/// BackgroundTasks which query the path asynchronously, so that
+		/// they are cancelled before the node graph is edited. The default
+		/// implementation returns null.
+		virtual const Plug *cancellationSubject() const;
+
 		/// Keeps removing names from the back of
 		/// names() until isValid() returns true.
 		void truncateUntilValid();
@@ -72,13 +72,20 @@ class GAFFER_API PerformanceMonitor : public Monitor
 				size_t hashCount = 0,
 				size_t computeCount = 0,
 				boost::chrono::nanoseconds hashDuration = boost::chrono::nanoseconds( 0 ),
-				boost::chrono::nanoseconds computeDuration = boost::chrono::nanoseconds( 0 )
+				boost::chrono::nanoseconds computeDuration = boost::chrono::nanoseconds( 0 ),
+				size_t computeWaitCount = 0,
+				boost::chrono::nanoseconds computeWaitDuration = boost::chrono::nanoseconds( 0 )
 			);
 
 			size_t hashCount;
 			size_t computeCount;
 			boost::chrono::nanoseconds hashDuration;
 			boost::chrono::nanoseconds computeDuration;
+			/// The number of times a thread waited for another
+			/// thread to compute the same value, rather than
+			/// duplicating the work, and the time spent waiting.
+			size_t computeWaitCount;
+			boost::chrono::nanoseconds computeWaitDuration;
 
 			Statistics & operator += ( const Statistics &rhs );
 
@@ -174,6 +174,11 @@ class GAFFER_API ScriptNode : public Node
 		/// serialised nodes to those contained in the set.
 		std::string serialise( const Node *parent = nullptr, const Set *filter = nullptr ) const;
 		/// Calls serialise() and saves the result into the specified file.
+		/// If the file name has a ".gfrb" extension, the serialisation is
+		/// stored in a compact binary form which also contains the
+		/// precompiled Python bytecode for each statement. Such files are
+		/// loaded significantly faster, and are read transparently by
+		/// `executeFile()`, `load()` and `importFile()`.
 		void serialiseToFile( const std::string &fileName, const Node *parent = nullptr, const Set *filter = nullptr ) const;
 		/// Executes a previously generated serialisation. If continueOnError is true, then
 		/// errors are reported via IECore::MessageHandler rather than as exceptions, and
@@ -183,6 +188,9 @@ class GAFFER_API ScriptNode : public Node
 		/// were ignored.
 		bool execute( const std::string &serialisation, Node *parent = nullptr, bool continueOnError = false );
 		/// As above, but loads the serialisation from the specified file.
+		/// Compiled serialisations are shared between calls for files with
+		/// identical contents, so repeated execution of the same file (as
+		/// performed by multiple References to the same asset) is cheap.
 		bool executeFile( const std::string &fileName, Node *parent = nullptr, bool continueOnError = false );
 		/// Returns true if a script is currently being executed. Note that
 		/// `execute()`, `executeFile()`, `load()`, `importFile()` and `paste()` are all
@@ -309,11 +317,15 @@ class GAFFER_API ScriptNode : public Node
 
 		typedef std::function<std::string ( const Node *, const Set * )> SerialiseFunction;
 		typedef std::function<bool ( ScriptNode *, const std::string &, Node *, bool, const std::string &context )> ExecuteFunction;
+		typedef std::function<std::string ( const std::string & )> CompileFunction;
 
 		// Actual implementations reside in libGafferBindings (due to Python
 		// dependency), and are injected into these functions.
 		static SerialiseFunction g_serialiseFunction;
 		static ExecuteFunction g_executeFunction;
+		// Converts a serialisation into the binary form used for ".gfrb"
+		// files. Execute functions must accept either form.
+		static CompileFunction g_compileFunction;
 		friend struct GafferModule::SerialiserRegistration;
 
 		bool m_executing;
@@ -64,6 +64,8 @@ class GAFFERIMAGE_API ColorProcessor : public ImageProcessor
 
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
+		Imath::Box2i outputRegion( const ImagePlug *input, const Imath::Box2i &inputRegion ) const override;
+
 	protected :
 
 		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
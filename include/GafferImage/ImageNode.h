@@ -70,6 +70,25 @@ class GAFFERIMAGE_API ImageNode : public Gaffer::ComputeNode
 
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
+		/// Affected regions
+		/// ================
+		///
+		/// These methods allow clients such as the Viewer to limit the work done
+		/// following an edit, by revisiting only the parts of `outPlug()` that the
+		/// edit could have changed. They must be called with a context suitable
+		/// for evaluating the node's global plugs. Both default to returning
+		/// `ImagePlug::infiniteDataWindow()`, which is always a safe answer.
+
+		/// Returns the region of `outPlug()` that the node modifies relative to its
+		/// input images, given the current values of its other plugs. Following an
+		/// edit to those plugs, changes are confined to the union of the regions
+		/// from before and after the edit. Implementations must not depend on the
+		/// content of the input images.
+		virtual Imath::Box2i affectedRegion() const;
+		/// Returns the region of `outPlug()` which may change when `inputRegion`
+		/// of the `input` image changes.
+		virtual Imath::Box2i outputRegion( const ImagePlug *input, const Imath::Box2i &inputRegion ) const;
+
 	protected :
 
 		/// The enabled() and channelEnabled( channel ) methods provide a means to disable the node
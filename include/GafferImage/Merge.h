@@ -89,6 +89,8 @@ class GAFFERIMAGE_API Merge : public FlatImageProcessor
 
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
+		Imath::Box2i outputRegion( const ImagePlug *input, const Imath::Box2i &inputRegion ) const override;
+
 	protected :
 
 		/// Reimplemented to hash the connected input plugs
@@ -78,6 +78,9 @@ class GAFFERIMAGE_API Shape : public FlatImageProcessor
 
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
+		Imath::Box2i affectedRegion() const override;
+		Imath::Box2i outputRegion( const ImagePlug *input, const Imath::Box2i &inputRegion ) const override;
+
 	protected :
 
 		void hashDataWindow( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
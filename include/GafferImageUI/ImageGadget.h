@@ -63,6 +63,7 @@
 #include <array>
 
 #include <chrono>
+#include <unordered_map>
 
 namespace IECoreGL
 {
@@ -146,7 +147,12 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 		void setPaused( bool paused );
 		bool getPaused() const;
 
+		/// Returns the number of tile textures uploaded since the last call
+		/// to `resetTileUpdateCount()`.
 		static uint64_t tileUpdateCount();
+		/// Returns the number of tiles whose hash was computed to check for
+		/// changes since the last call to `resetTileUpdateCount()`.
+		static uint64_t tileHashCount();
 		static void resetTileUpdateCount();
 
 		enum State
@@ -219,6 +225,9 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 			DataWindowDirty = 2,
 			ChannelNamesDirty = 4,
 			TilesDirty = 8,
+			// Channel data has been dirtied, but only the tiles intersecting
+			// `m_pendingRegion` need updating.
+			ChannelDataDirty = 16,
 			AllDirty = FormatDirty | DataWindowDirty | ChannelNamesDirty | TilesDirty
 		};
 
@@ -305,6 +314,35 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 		std::unique_ptr<Gaffer::BackgroundTask> m_tilesTask;
 		std::atomic_bool m_renderRequestPending;
 
+		// Dirty region tracking. Rather than rehash every tile when the
+		// channel data is dirtied, we walk upstream asking each ImageNode
+		// for the region its edits could have affected. We keep a record
+		// of each ImagePlug visited so that we can tell what has changed
+		// since the last walk.
+
+		struct RegionRecord
+		{
+			// Keeps the plug alive so its address can't be reused.
+			Gaffer::ConstPlugPtr plug;
+			// Of the channelData plug.
+			uint64_t dirtyCount;
+			const Gaffer::Plug *input;
+			// For ImageNode outputs only.
+			IECore::MurmurHash settingsHash;
+			Imath::Box2i affectedRegion;
+		};
+
+		typedef std::unordered_map<const GafferImage::ImagePlug *, Imath::Box2i> VisitedRegions;
+
+		Imath::Box2i dirtyRegion();
+		Imath::Box2i dirtyRegionWalk( const GafferImage::ImagePlug *plug, VisitedRegions &visited );
+
+		std::unordered_map<const Gaffer::Plug *, RegionRecord> m_regionRecords;
+		// Accumulated from `dirtyRegion()` until an update completes.
+		Imath::Box2i m_pendingRegion;
+		// The data window of the last completed update.
+		Imath::Box2i m_tilesDataWindow;
+
 		// Rendering.
 
 		void visibilityChanged();
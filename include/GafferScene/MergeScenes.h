@@ -39,7 +39,9 @@
 
 #include "GafferScene/SceneProcessor.h"
 
-#include <bitset>
+#include "Gaffer/TypedObjectPlug.h"
+
+#include <vector>
 
 namespace GafferScene
 {
@@ -83,6 +85,9 @@ class GAFFERSCENE_API MergeScenes : public SceneProcessor
 		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
 
+		Gaffer::ValuePlug::CachePolicy hashCachePolicy( const Gaffer::ValuePlug *output ) const override;
+		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
+
 		void hashBound( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const override;
 		Imath::Box3f computeBound( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const override;
 
@@ -109,20 +114,24 @@ class GAFFERSCENE_API MergeScenes : public SceneProcessor
 
 	private :
 
-		using InputMask = std::bitset<32>;
+		// Sorted indices of the inputs which are valid at a
+		// particular location. Unlike a fixed size bitmask, this
+		// places no limit on the number of inputs, and allows
+		// locations coming from a single input to be dealt with
+		// without considering all the others.
+		using InputMask = std::vector<int>;
 
-		// Plugs used to track which inputs are valid
-		// at the current location. The value can be
-		// converted directly to an `InputMask` for use
-		// with `visit()`.
-		Gaffer::IntPlug *activeInputsPlug();
-		const Gaffer::IntPlug *activeInputsPlug() const;
+		// Plug used to track which inputs are valid
+		// at the current location. The value is an
+		// `InputMask` for use with `visit()`.
+		Gaffer::IntVectorDataPlug *activeInputsPlug();
+		const Gaffer::IntVectorDataPlug *activeInputsPlug() const;
 
 		Gaffer::AtomicBox3fPlug *mergedDescendantsBoundPlug();
 		const Gaffer::AtomicBox3fPlug *mergedDescendantsBoundPlug() const;
 
 		void hashActiveInputs( const Gaffer::Context *context, IECore::MurmurHash &h ) const;
-		int computeActiveInputs( const Gaffer::Context *context ) const;
+		IECore::ConstIntVectorDataPtr computeActiveInputs( const Gaffer::Context *context ) const;
 
 		void hashMergedDescendantsBound( const Gaffer::Context *context, IECore::MurmurHash &h ) const;
 		const Imath::Box3f computeMergedDescendantsBound( const Gaffer::Context *context ) const;
@@ -148,7 +157,12 @@ class GAFFERSCENE_API MergeScenes : public SceneProcessor
 		// Calls `visitor( inputType, inputIndex, input )` for all inputs specified by `inputMask`.
 		// Visitor may return `true` to continue to subsequent inputs or `false` to stop iteration.
 		template<typename Visitor>
-		void visit( InputMask inputMask, Visitor &&visitor, VisitOrder order = VisitOrder::Forwards ) const;
+		void visit( const InputMask &inputMask, Visitor &&visitor, VisitOrder order = VisitOrder::Forwards ) const;
+
+		// Calls `getter( inputIndex, input )` for all inputs specified by `inputMask`, in parallel
+		// if there are enough of them, returning the results in the order of `inputMask`.
+		template<typename Getter>
+		auto parallelGet( const InputMask &inputMask, Getter &&getter ) const -> std::vector<decltype( getter( 0, nullptr ) )>;
 
 		static size_t g_firstPlugIndex;
 
@@ -0,0 +1,95 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2021, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#ifndef IECOREGLPREVIEW_MESHPROXYALGO_H
+#define IECOREGLPREVIEW_MESHPROXYALGO_H
+
+#include "GafferScene/Export.h"
+
+#include "IECoreScene/MeshPrimitive.h"
+
+#include "OpenEXR/ImathBox.h"
+#include "OpenEXR/ImathMatrix.h"
+
+#include "boost/signals.hpp"
+
+#include <vector>
+
+namespace IECoreGLPreview
+{
+
+/// Utilities for drawing dense meshes using simplified proxies,
+/// choosing a level of detail appropriate to their size on screen.
+namespace MeshProxyAlgo
+{
+
+/// Returns a triangulated copy of `mesh`, simplified to approximately
+/// `targetTriangles` triangles by repeatedly collapsing the edges which
+/// introduce the least error (as measured by the quadric error metric).
+/// Only the "P" primitive variable is preserved.
+GAFFERSCENE_API IECoreScene::MeshPrimitivePtr decimate( const IECoreScene::MeshPrimitive *mesh, size_t targetTriangles );
+
+/// Returns the number of triangles `mesh` has once triangulated.
+GAFFERSCENE_API size_t numTriangles( const IECoreScene::MeshPrimitive *mesh );
+
+/// Returns the target triangle counts for the levels of detail used to
+/// draw a mesh with `numTriangles` triangles. The first level is always the
+/// original mesh, and each subsequent level has a quarter of the triangles of
+/// the last. Meshes which are too small to benefit from proxies have just the
+/// one level.
+GAFFERSCENE_API std::vector<size_t> levelTriangleCounts( size_t numTriangles );
+
+/// Returns the approximate area, in pixels, covered by `bound` when it is
+/// projected into a viewport by `worldToClip`. Returns infinity if the bound
+/// extends behind the camera.
+GAFFERSCENE_API float projectedArea( const Imath::Box3f &bound, const Imath::M44f &worldToClip, const Imath::V2f &viewportSize );
+
+/// Returns the index of the coarsest level in `levelTriangleCounts` which
+/// provides adequate detail for a mesh covering `projectedArea` pixels.
+GAFFERSCENE_API size_t selectLevel( const std::vector<size_t> &levelTriangleCounts, float projectedArea );
+
+/// Signal emitted on the UI thread when the OpenGL renderer finishes a
+/// background conversion of a mesh which it has been drawing via a proxy
+/// in the meantime. Viewports should redraw in response.
+using ConversionCompletedSignal = boost::signal<void ()>;
+GAFFERSCENE_API ConversionCompletedSignal &conversionCompletedSignal();
+
+} // namespace MeshProxyAlgo
+
+} // namespace IECoreGLPreview
+
+#endif // IECOREGLPREVIEW_MESHPROXYALGO_H
@@ -46,6 +46,7 @@
 
 #include <atomic>
 #include <functional>
+#include <mutex>
 
 namespace GafferScene
 {
@@ -69,12 +70,22 @@ class GAFFERSCENE_API RenderController : public boost::signals::trackable
 		void setContext( const Gaffer::ConstContextPtr &context );
 		const Gaffer::Context *getContext() const;
 
+		/// If a background update is in progress, changes to the
+		/// expansion are merged into it rather than cancelling it,
+		/// with newly expanded locations being given priority.
 		void setExpandedPaths( const IECore::PathMatcher &expandedPaths );
 		const IECore::PathMatcher &getExpandedPaths() const;
 
 		void setMinimumExpansionDepth( size_t depth );
 		size_t getMinimumExpansionDepth() const;
 
+		/// When on, `updateInBackground()` first outputs bounding boxes
+		/// in place of any objects which have not been loaded yet, and
+		/// then replaces them with the objects themselves. This gives
+		/// quicker feedback when exploring large scenes.
+		void setBoundsFirst( bool boundsFirst );
+		bool getBoundsFirst() const;
+
 		typedef boost::signal<void (RenderController &)> UpdateRequiredSignal;
 		UpdateRequiredSignal &updateRequiredSignal();
 
@@ -105,7 +116,17 @@ class GAFFERSCENE_API RenderController : public boost::signals::trackable
 		void dirtyGlobals( unsigned components );
 		void dirtySceneGraphs( unsigned components );
 
-		void updateInternal( const ProgressCallback &callback = ProgressCallback(), const IECore::PathMatcher *pathsToUpdate = nullptr );
+		void expansionChanged();
+		// Applies changes made by `setExpandedPaths()` and `setMinimumExpansionDepth()`
+		// to the scene graphs, adding any newly expanded paths to `newlyExpandedPaths`.
+		void applyPendingExpansion( IECore::PathMatcher *newlyExpandedPaths = nullptr );
+		bool backgroundTaskRunning() const;
+
+		// Returns false if the update was stopped early because the
+		// expansion changed. Reports progress via `callback`, but
+		// leaves it to the caller to report completion, since an
+		// update may consist of several passes.
+		bool updateInternal( const ProgressCallback &callback = ProgressCallback(), const IECore::PathMatcher *pathsToUpdate = nullptr, bool deferObjects = false );
 		void updateDefaultCamera();
 		void cancelBackgroundTask();
 
@@ -118,12 +139,20 @@ class GAFFERSCENE_API RenderController : public boost::signals::trackable
 
 		IECore::PathMatcher m_expandedPaths;
 		size_t m_minimumExpansionDepth;
+		// The expansion used by the scene graph updates. This lags
+		// behind the above while changes are pending, and is only
+		// modified when no scene graph update is running.
+		IECore::PathMatcher m_updateExpandedPaths;
+		size_t m_updateMinimumExpansionDepth;
+		std::mutex m_expansionMutex;
+		std::atomic_bool m_expansionPending;
+		bool m_boundsFirst;
 
 		boost::signals::scoped_connection m_plugDirtiedConnection;
 		boost::signals::scoped_connection m_contextChangedConnection;
 
 		UpdateRequiredSignal m_updateRequiredSignal;
-		bool m_updateRequired;
+		std::atomic_bool m_updateRequired;
 		bool m_updateRequested;
 		std::atomic<uint64_t> m_failedAttributeEdits;
 
@@ -176,6 +176,9 @@ struct History : public IECore::RefCounted
 };
 
 GAFFERSCENE_API History::Ptr history( const Gaffer::ValuePlug *scenePlugChild, const ScenePlug::ScenePath &path );
+/// Histories are cached internally, and the cache holds references to the plugs and
+/// contexts they contain. This clears the cache so that those references are released.
+GAFFERSCENE_API void clearHistoryCache();
 
 /// Extends History to provide information on the history of a specific attribute.
 /// Attributes may be renamed by ShuffleAttributes nodes and this is reflected
@@ -81,6 +81,7 @@ class GAFFERSCENE_API ScenePath : public Gaffer::Path
 		bool isValid() const override;
 		bool isLeaf() const override;
 		Gaffer::PathPtr copy() const override;
+		const Gaffer::Plug *cancellationSubject() const override;
 
 		static Gaffer::PathFilterPtr createStandardFilter( const std::vector<std::string> &setNames = std::vector<std::string>(), const std::string &setsLabel = "" );
 
@@ -105,6 +105,12 @@ class GAFFERSCENEUI_API SceneGadget : public GafferUI::Gadget
 		void setPaused( bool paused );
 		bool getPaused() const;
 
+		/// When on, bounding boxes are drawn for objects which have
+		/// not been loaded yet, and are replaced with the objects
+		/// as they become available. Defaults to off.
+		void setBoundsFirst( bool boundsFirst );
+		bool getBoundsFirst() const;
+
 		/// Specifies a set of paths that block drawing until they are
 		/// up to date. Use sparingly.
 		void setBlockingPaths( const IECore::PathMatcher &blockingPaths );
@@ -177,6 +183,7 @@ class GAFFERSCENEUI_API SceneGadget : public GafferUI::Gadget
 		void renderScene() const;
 		IECore::PathMatcher convertSelection( IECore::UIntVectorDataPtr ids ) const;
 		void visibilityChanged();
+		void meshConversionCompleted();
 
 		bool m_paused;
 		IECore::PathMatcher m_blockingPaths;
@@ -47,6 +47,7 @@
 #include "GafferUI/View.h"
 
 #include "Gaffer/BackgroundTask.h"
+#include "Gaffer/NumericPlug.h"
 #include "Gaffer/StringPlug.h"
 
 #include <unordered_set>
@@ -77,6 +78,10 @@ class GAFFERSCENEUI_API UVView : public GafferUI::View
 		Gaffer::StringPlug *displayTransformPlug();
 		const Gaffer::StringPlug *displayTransformPlug() const;
 
+		/// The resolution that textures are downsampled to for display.
+		Gaffer::IntPlug *textureResolutionPlug();
+		const Gaffer::IntPlug *textureResolutionPlug() const;
+
 		void setPaused( bool paused );
 		bool getPaused() const;
 
@@ -117,6 +122,7 @@ class GAFFERSCENEUI_API UVView : public GafferUI::View
 		void visibilityChanged();
 		void updateTextureGadgets( const IECore::ConstCompoundObjectPtr &textures );
 		void updateDisplayTransform();
+		void updateTextureResolution();
 		void gadgetStateChanged( const GafferUI::Gadget *gadget, bool running );
 
 		UVViewSignal m_stateChangedSignal;
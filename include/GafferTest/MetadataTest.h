@@ -39,10 +39,17 @@
 
 #include "GafferTest/Export.h"
 
+#include "Gaffer/GraphComponent.h"
+
+#include <vector>
+
 namespace GafferTest
 {
 
 GAFFERTEST_API void testMetadataThreading();
+/// Retrieves the values for `keys` from `root` and all its descendants,
+/// `iterations` times, in parallel.
+GAFFERTEST_API void parallelMetadataValues( const Gaffer::GraphComponent *root, const std::vector<IECore::InternedString> &keys, size_t iterations );
 
 } // namespace GafferTest
 
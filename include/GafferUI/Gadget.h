@@ -305,6 +305,11 @@ class GAFFERUI_API Gadget : public Gaffer::GraphComponent
 		/// of its children will render anything for the specified layer.
 		/// The default implementation returns true.
 		virtual bool hasLayer( Layer layer ) const;
+		/// May be implemented by derived classes to skip the rendering of
+		/// individual children, for instance because they lie outside the
+		/// visible region. Called for each visible child, after this gadget's
+		/// `doRenderLayer()`. The default implementation returns true.
+		virtual bool shouldRenderChild( const Gadget *child ) const;
 
 		/// \deprecated
 		void requestRender();
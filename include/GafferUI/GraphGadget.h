@@ -43,6 +43,8 @@
 #include "Gaffer/CompoundNumericPlug.h"
 #include "Gaffer/Plug.h"
 
+#include <memory>
+
 namespace Gaffer
 {
 IE_CORE_FORWARDDECLARE( Node );
@@ -187,9 +189,26 @@ class GAFFERUI_API GraphGadget : public ContainerGadget
 		/// Returns the connectionGadget under the specified line.
 		ConnectionGadget *connectionGadgetAt( const IECore::LineSegment3f &lineInGadgetSpace ) const;
 
+		/// Fills the vector with the NodeGadgets whose bounds intersect `region`,
+		/// which is specified in the space of the GraphGadget. This uses a
+		/// spatial index, so is efficient even for very large graphs. Returns
+		/// the new size of the vector.
+		size_t nodeGadgetsInRegion( const Imath::Box2f &region, std::vector<NodeGadget *> &nodeGadgets ) const;
+		/// As above, but for ConnectionGadgets.
+		size_t connectionGadgetsInRegion( const Imath::Box2f &region, std::vector<ConnectionGadget *> &connectionGadgets ) const;
+
+		/// Returns true if the render in progress is zoomed out so far
+		/// that NodeGadgets should omit fine detail such as nodules and
+		/// labels, which would not be legible anyway.
+		bool renderingLowDetail() const;
+
 	protected :
 
+		void updateLayout() const override;
 		void doRenderLayer( Layer layer, const Style *style ) const override;
+		/// Culls NodeGadgets and ConnectionGadgets that are outside
+		/// the viewport.
+		bool shouldRenderChild( const Gadget *child ) const override;
 
 	private :
 
@@ -293,6 +312,18 @@ class GAFFERUI_API GraphGadget : public ContainerGadget
 
 		GraphLayoutPtr m_layout;
 
+		// Index of the bounds of our NodeGadgets and ConnectionGadgets,
+		// used for culling and hit testing. Rebuilt lazily whenever our
+		// layout is dirtied, which happens whenever a child is added or
+		// removed or a child's bound changes.
+		struct SpatialIndex;
+		const SpatialIndex *spatialIndex() const;
+		mutable std::unique_ptr<SpatialIndex> m_spatialIndex;
+
+		// State for the render in progress, updated in `doRenderLayer()`.
+		mutable Imath::Box2f m_renderRegion;
+		mutable bool m_renderingLowDetail;
+
 };
 
 IE_CORE_DECLAREPTR( GraphGadget );
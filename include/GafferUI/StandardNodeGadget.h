@@ -105,6 +105,9 @@ class GAFFERUI_API StandardNodeGadget : public NodeGadget
 
 		void doRenderLayer( Layer layer, const Style *style ) const override;
 		bool hasLayer( Layer layer ) const override;
+		/// Omits nodules and contents when the GraphGadget
+		/// is rendering in low detail.
+		bool shouldRenderChild( const Gadget *child ) const override;
 
 		const Imath::Color3f *userColor() const;
 
@@ -127,7 +130,7 @@ class GAFFERUI_API StandardNodeGadget : public NodeGadget
 
 		static NodeGadgetTypeDescription<StandardNodeGadget> g_nodeGadgetTypeDescription;
 
-		void plugDirtied( const Gaffer::Plug *plug );
+		void plugsDirtied( const std::vector<Gaffer::Plug *> &plugs );
 
 		void enter( Gadget *gadget );
 		void leave( Gadget *gadget );
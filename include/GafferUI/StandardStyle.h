@@ -47,6 +47,7 @@ IECORE_PUSH_DEFAULT_VISIBILITY
 IECORE_POP_DEFAULT_VISIBILITY
 
 #include <array>
+#include <memory>
 
 namespace IECoreGL
 {
@@ -81,6 +82,7 @@ class GAFFERUI_API StandardStyle : public Style
 		Imath::Box3f textBound( TextType type, const std::string &text ) const override;
 		void renderText( TextType type, const std::string &text, State state = NormalState, const Imath::Color4f *userColor = nullptr ) const override;
 		void renderWrappedText( TextType textType, const std::string &text, const Imath::Box2f &bound, State state = NormalState ) const override;
+		void renderTextBatch( TextType textType, const std::vector<TextLabel> &labels, State state = NormalState, const Imath::Color4f *userColor = nullptr ) const override;
 
 		void renderFrame( const Imath::Box2f &frame, float borderWidth, State state = NormalState ) const override;
 		void renderSelectionBox( const Imath::Box2f &box ) const override;
@@ -154,6 +156,21 @@ class GAFFERUI_API StandardStyle : public Style
 
 		IECoreGL::StatePtr m_highlightState;
 
+		// Text layout. The glyph quads for each string are computed on
+		// the CPU and cached, so that they can be shared by `textBound()`
+		// and the render methods. Layout may be performed on any thread,
+		// but not concurrently with `setFont()` or `setFontScale()`.
+
+		struct GlyphRun;
+		typedef std::shared_ptr<const GlyphRun> ConstGlyphRunPtr;
+		class GlyphRunCache;
+
+		ConstGlyphRunPtr glyphRun( TextType textType, const std::string &text ) const;
+		ConstGlyphRunPtr computeGlyphRun( TextType textType, const std::string &text ) const;
+		void bindText( TextType textType, State state, const Imath::Color4f *userColor ) const;
+
+		std::unique_ptr<GlyphRunCache> m_glyphRunCache;
+
 };
 
 IE_CORE_DECLAREPTR( Style );
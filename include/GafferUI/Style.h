@@ -49,10 +49,14 @@
 
 IECORE_PUSH_DEFAULT_VISIBILITY
 #include "OpenEXR/ImathBox.h"
+#include "OpenEXR/ImathMatrix.h"
 IECORE_POP_DEFAULT_VISIBILITY
 
 #include "boost/signal.hpp"
 
+#include <string>
+#include <vector>
+
 namespace IECoreGL
 {
 
@@ -113,6 +117,19 @@ class GAFFERUI_API Style : public IECore::RunTimeTyped
 		virtual Imath::Box3f textBound( TextType textType, const std::string &text ) const = 0;
 		virtual void renderText( TextType textType, const std::string &text, State state = NormalState, const Imath::Color4f *userColor = nullptr ) const = 0;
 		virtual void renderWrappedText( TextType textType, const std::string &text, const Imath::Box2f &bound, State state = NormalState ) const = 0;
+
+		/// A string to be drawn by `renderTextBatch()`.
+		struct TextLabel
+		{
+			std::string text;
+			/// Relative to the current GL transform.
+			Imath::M44f transform;
+		};
+
+		/// Draws many strings of the same type and state together, which may
+		/// be considerably quicker than calling `renderText()` for each. The
+		/// default implementation does exactly that.
+		virtual void renderTextBatch( TextType textType, const std::vector<TextLabel> &labels, State state = NormalState, const Imath::Color4f *userColor = nullptr ) const;
 		//@}
 
 		/// @name Generic UI elements
@@ -63,6 +63,11 @@ class PythonExpressionEngine( Gaffer.Expression.Engine ) :
 		outPlugs.extend( [ self.__plug( node, p ) for p in self.__outPlugPaths ] )
 		contextNames.extend( parser.contextReads )
 
+		# Simple expressions can be evaluated natively, without
+		# the overhead of acquiring the GIL. Anything unsupported
+		# falls back to `execute()` and `apply()` below.
+		self._compileNative( node, expression, inPlugs, outPlugs )
+
 	def execute( self, context, inputs ) :
 
 		plugDict = {}
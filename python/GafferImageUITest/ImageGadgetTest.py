@@ -110,6 +110,69 @@ class ImageGadgetTest( GafferUITest.TestCase ) :
 		del g, w
 		del s
 
+	def testEditsOnlyUpdateAffectedTiles( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["c"] = GafferImage.Constant()
+		s["c"]["format"].setValue( GafferImage.Format( 2048, 2048 ) )
+
+		s["r"] = GafferImage.Rectangle()
+		s["r"]["in"].setInput( s["c"]["out"] )
+		s["r"]["area"].setValue( imath.Box2f( imath.V2f( 20 ), imath.V2f( 100 ) ) )
+
+		g = GafferImageUI.ImageGadget()
+		g.setImage( s["r"]["out"] )
+
+		with GafferUI.Window() as w :
+			GafferUI.GadgetWidget( g )
+
+		w.setVisible( True )
+
+		def waitForUpdate() :
+
+			with IECore.CapturingMessageHandler() :
+				for i in range( 0, 100 ) :
+					self.waitForIdle( 10 )
+					if g.state() == g.State.Complete :
+						break
+
+			self.assertEqual( g.state(), g.State.Complete )
+
+		# Everything must be computed for the first update.
+
+		GafferImageUI.ImageGadget.resetTileUpdateCount()
+		waitForUpdate()
+		numTiles = ( 2048 // GafferImage.ImagePlug.tileSize() ) ** 2
+		self.assertEqual( GafferImageUI.ImageGadget.tileHashCount(), numTiles * 4 )
+
+		# But editing the rectangle only affects the tiles it occupies. Including
+		# the line width, it covers pixels 18-102 in both axes, which is 2x2 tiles.
+
+		GafferImageUI.ImageGadget.resetTileUpdateCount()
+		s["r"]["color"].setValue( imath.Color4f( 1, 0, 0, 1 ) )
+		waitForUpdate()
+		self.assertEqual( GafferImageUI.ImageGadget.tileHashCount(), 2 * 2 * 4 )
+		self.assertLessEqual( GafferImageUI.ImageGadget.tileUpdateCount(), 2 * 2 * 4 )
+
+		# Moving it affects the tiles at both the old and new positions. These
+		# are accumulated into a single bounding box covering pixels 18-382,
+		# which is 6x6 tiles.
+
+		GafferImageUI.ImageGadget.resetTileUpdateCount()
+		s["r"]["area"].setValue( imath.Box2f( imath.V2f( 300 ), imath.V2f( 380 ) ) )
+		waitForUpdate()
+		self.assertEqual( GafferImageUI.ImageGadget.tileHashCount(), 6 * 6 * 4 )
+
+		# Upstream edits are passed through the rectangle.
+
+		GafferImageUI.ImageGadget.resetTileUpdateCount()
+		s["c"]["color"].setValue( imath.Color4f( 0.5 ) )
+		waitForUpdate()
+		self.assertEqual( GafferImageUI.ImageGadget.tileHashCount(), numTiles * 4 )
+
+		del g, w
+		del s
+
 if __name__ == "__main__":
 	unittest.main()
 
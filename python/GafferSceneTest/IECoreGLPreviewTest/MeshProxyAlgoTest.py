@@ -0,0 +1,138 @@
+##########################################################################
+#
+#  Copyright (c) 2021, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import unittest
+
+import imath
+
+import IECore
+import IECoreScene
+
+import GafferTest
+import GafferScene
+
+class MeshProxyAlgoTest( GafferTest.TestCase ) :
+
+	def testNumTriangles( self ) :
+
+		plane = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ), imath.V2i( 10 ) )
+		self.assertEqual( GafferScene.IECoreScenePreview.MeshProxyAlgo.numTriangles( plane ), 200 )
+
+	def testDecimate( self ) :
+
+		plane = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ), imath.V2i( 100 ) )
+		self.assertEqual( GafferScene.IECoreScenePreview.MeshProxyAlgo.numTriangles( plane ), 20000 )
+
+		proxy = GafferScene.IECoreScenePreview.MeshProxyAlgo.decimate( plane, 5000 )
+		self.assertTrue( proxy.arePrimitiveVariablesValid() )
+		self.assertEqual( proxy.keys(), [ "P" ] )
+		self.assertEqual( proxy.maxVerticesPerFace(), 3 )
+		self.assertLessEqual( GafferScene.IECoreScenePreview.MeshProxyAlgo.numTriangles( proxy ), 5000 )
+		self.assertGreater( GafferScene.IECoreScenePreview.MeshProxyAlgo.numTriangles( proxy ), 2500 )
+
+		# Borders are preserved, so the bound shouldn't change.
+		self.assertTrue( proxy.bound().min().equalWithAbsError( plane.bound().min(), 1e-4 ) )
+		self.assertTrue( proxy.bound().max().equalWithAbsError( plane.bound().max(), 1e-4 ) )
+
+	def testDecimateWithoutP( self ) :
+
+		mesh = IECoreScene.MeshPrimitive( IECore.IntVectorData( [ 3 ] ), IECore.IntVectorData( [ 0, 1, 2 ] ) )
+		with self.assertRaises( RuntimeError ) :
+			GafferScene.IECoreScenePreview.MeshProxyAlgo.decimate( mesh, 1 )
+
+	def testLevelTriangleCounts( self ) :
+
+		levelTriangleCounts = GafferScene.IECoreScenePreview.MeshProxyAlgo.levelTriangleCounts
+
+		# Small meshes aren't worth proxying.
+		self.assertEqual( levelTriangleCounts( 0 ), [ 0 ] )
+		self.assertEqual( levelTriangleCounts( 1000 ), [ 1000 ] )
+
+		counts = levelTriangleCounts( 1000000 )
+		self.assertEqual( counts[0], 1000000 )
+		self.assertGreater( len( counts ), 1 )
+		for i in range( 1, len( counts ) ) :
+			self.assertEqual( counts[i], counts[i-1] // 4 )
+			self.assertGreaterEqual( counts[i], 1000 )
+
+	def testProjectedArea( self ) :
+
+		projectedArea = GafferScene.IECoreScenePreview.MeshProxyAlgo.projectedArea
+
+		# With an identity projection, clip space is the same as world space,
+		# so a bound covering [ -1, 1 ] covers the whole viewport.
+		self.assertAlmostEqual(
+			projectedArea( imath.Box3f( imath.V3f( -1 ), imath.V3f( 1 ) ), imath.M44f(), imath.V2f( 100, 50 ) ),
+			5000, delta = 1e-2
+		)
+
+		self.assertAlmostEqual(
+			projectedArea( imath.Box3f( imath.V3f( 0 ), imath.V3f( 1 ) ), imath.M44f(), imath.V2f( 100, 50 ) ),
+			1250, delta = 1e-2
+		)
+
+		# Bounds extending behind the camera are treated as infinitely large.
+		perspective = imath.M44f(
+			1, 0, 0, 0,
+			0, 1, 0, 0,
+			0, 0, -1, -1,
+			0, 0, 0, 0,
+		)
+		self.assertEqual(
+			projectedArea( imath.Box3f( imath.V3f( -1 ), imath.V3f( 1 ) ), perspective, imath.V2f( 100 ) ),
+			float( "inf" )
+		)
+
+	def testSelectLevel( self ) :
+
+		levelTriangleCounts = GafferScene.IECoreScenePreview.MeshProxyAlgo.levelTriangleCounts( 1000000 )
+		selectLevel = GafferScene.IECoreScenePreview.MeshProxyAlgo.selectLevel
+
+		self.assertEqual( selectLevel( levelTriangleCounts, float( "inf" ) ), 0 )
+		self.assertEqual( selectLevel( levelTriangleCounts, 0 ), len( levelTriangleCounts ) - 1 )
+
+		# Larger areas require finer levels.
+		previousLevel = len( levelTriangleCounts ) - 1
+		for area in ( 10, 1000, 100000, 1000000, 10000000 ) :
+			level = selectLevel( levelTriangleCounts, area )
+			self.assertLessEqual( level, previousLevel )
+			previousLevel = level
+
+		self.assertEqual( selectLevel( [ 100 ], 0 ), 0 )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -226,6 +226,86 @@ class RendererTest( GafferTest.TestCase ) :
 
 		del o
 
+	def testQueryFrustumAndRay( self ) :
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
+			"OpenGL",
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Interactive
+		)
+
+		cube = IECoreScene.MeshPrimitive.createBox( imath.Box3f( imath.V3f( -0.5 ), imath.V3f( 0.5 ) ) )
+		attributes = renderer.attributes( IECore.CompoundObject() )
+
+		objects = []
+		for x in range( -10, 11 ) :
+			for y in range( -10, 11 ) :
+				o = renderer.object( "/cube_{}_{}".format( x, y ), cube, attributes )
+				o.transform( imath.M44f().translate( imath.V3f( x * 2, y * 2, 0 ) ) )
+				objects.append( o )
+
+		# Orthographic clip volume spanning -3 to 3 in X and Y.
+
+		worldToClip = imath.M44f().scale( imath.V3f( 1 / 3.0, 1 / 3.0, 0.1 ) )
+		paths = renderer.command( "gl:queryFrustum", { "worldToClip" : IECore.M44fData( worldToClip ) } ).value
+		self.assertEqual(
+			set( paths.paths() ),
+			{ "/cube_{}_{}".format( x, y ) for x in range( -1, 2 ) for y in range( -1, 2 ) }
+		)
+
+		# Margin extends the volume in X and Y.
+
+		paths = renderer.command(
+			"gl:queryFrustum",
+			{
+				"worldToClip" : IECore.M44fData( worldToClip ),
+				"margin" : IECore.V2fData( imath.V2f( 0.4, 0 ) ),
+			}
+		).value
+		self.assertEqual(
+			set( paths.paths() ),
+			{ "/cube_{}_{}".format( x, y ) for x in range( -2, 3 ) for y in range( -1, 2 ) }
+		)
+
+		# Ray down the Z axis.
+
+		paths = renderer.command(
+			"gl:queryRay",
+			{
+				"origin" : IECore.V3fData( imath.V3f( 4.1, -2.2, 10 ) ),
+				"direction" : IECore.V3fData( imath.V3f( 0, 0, -1 ) ),
+			}
+		).value
+		self.assertEqual( paths.paths(), [ "/cube_2_-1" ] )
+
+		# Ray pointing away from everything.
+
+		paths = renderer.command(
+			"gl:queryRay",
+			{
+				"origin" : IECore.V3fData( imath.V3f( 4.1, -2.2, 10 ) ),
+				"direction" : IECore.V3fData( imath.V3f( 0, 0, 1 ) ),
+			}
+		).value
+		self.assertTrue( paths.isEmpty() )
+
+		# Moving an object must be reflected in the queries.
+
+		objects[0].transform( imath.M44f().translate( imath.V3f( 0, 0, 0.5 ) ) )
+		paths = renderer.command(
+			"gl:queryRay",
+			{
+				"origin" : IECore.V3fData( imath.V3f( 0, 0, 10 ) ),
+				"direction" : IECore.V3fData( imath.V3f( 0, 0, -1 ) ),
+			}
+		).value
+		self.assertEqual( set( paths.paths() ), { "/cube_0_0", "/cube_-10_-10" } )
+
+		# Deleting objects must be reflected too.
+
+		del objects[:]
+		paths = renderer.command( "gl:queryFrustum", { "worldToClip" : IECore.M44fData( worldToClip ) } ).value
+		self.assertTrue( paths.isEmpty() )
+
 	def testTransforms( self ) :
 
 		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
@@ -246,5 +326,63 @@ class RendererTest( GafferTest.TestCase ) :
 
 		renderer.render()
 
+	def testMeshProxies( self ) :
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create( "OpenGL" )
+
+		# Dense enough to be drawn via proxies. The proxies don't preserve
+		# "Cs", so we can tell them apart from the original mesh by colour.
+
+		plane = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ), divisions = imath.V2i( 250 ) )
+		self.assertGreater( len( GafferScene.IECoreScenePreview.MeshProxyAlgo.levelTriangleCounts(
+			GafferScene.IECoreScenePreview.MeshProxyAlgo.numTriangles( plane )
+		) ), 1 )
+		plane["Cs"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.Color3fVectorData( [ imath.Color3f( 1, 0, 0 ) ] * plane.variableSize( IECoreScene.PrimitiveVariable.Interpolation.Vertex ) )
+		)
+
+		o = renderer.object( "/plane", plane, renderer.attributes( IECore.CompoundObject() ) )
+
+		def renderCentre( scale ) :
+
+			o.transform( imath.M44f().translate( imath.V3f( 0, 0, -5 ) ).scale( imath.V3f( scale ) ) )
+
+			fileName = os.path.join( self.temporaryDirectory(), "testMeshProxies.exr" )
+			renderer.output( "test", IECoreScene.Output( fileName, "exr", "rgba", {} ) )
+			renderer.render()
+
+			image = IECore.Reader.create( fileName ).read()
+			dimensions = image.dataWindow.size() + imath.V2i( 1 )
+			index = dimensions.x * int( dimensions.y * 0.5 ) + int( dimensions.x * 0.5 )
+			return imath.Color3f( image["R"][index], image["G"][index], image["B"][index] )
+
+		with GafferTest.ParallelAlgoTest.UIThreadCallHandler() as handler :
+
+			# Small on screen, so drawn using the coarsest proxy.
+
+			c = renderCentre( 0.05 )
+			self.assertGreater( c[1], 0 )
+
+			# Filling the screen, so the original mesh is needed. That is
+			# converted in the background, and a proxy is drawn in the meantime.
+
+			c = renderCentre( 2 )
+			self.assertGreater( c[1], 0 )
+
+			# A redraw is requested when the conversion completes, after which
+			# the original mesh is drawn.
+
+			handler.assertCalled()
+			c = renderCentre( 2 )
+			self.assertGreater( c[0], 0 )
+			self.assertEqual( c[1], 0 )
+
+			# Switching back to a proxy doesn't require another conversion.
+
+			c = renderCentre( 0.05 )
+			self.assertGreater( c[1], 0 )
+			handler.assertDone()
+
 if __name__ == "__main__":
 	unittest.main()
@@ -36,6 +36,7 @@
 
 from .RendererTest import RendererTest
 from .VisualiserTest import VisualiserTest
+from .MeshProxyAlgoTest import MeshProxyAlgoTest
 
 if __name__ == "__main__":
 	import unittest
@@ -297,6 +297,68 @@ class InstancerTest( GafferSceneTest.SceneTestCase ) :
 		for i in range( 0, 100 ) :
 			self.assertEqual( instancer["out"].boundHash( "/plane/instances" ), h )
 
+	def testConservativeBounds( self ) :
+
+		r = imath.Rand32( 1 )
+		randomV3f = lambda : imath.V3f( r.nextf(), r.nextf(), r.nextf() )
+		numPoints = 100
+
+		points = IECoreScene.PointsPrimitive( IECore.V3fVectorData( [ randomV3f() * 10 for i in range( 0, numPoints ) ] ) )
+		points["index"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.IntVectorData( [ i % 2 for i in range( 0, numPoints ) ] ),
+		)
+		points["orientation"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.QuatfVectorData( [ imath.Quatf().setAxisAngle( randomV3f() - imath.V3f( 0.5 ), r.nextf( 0, math.pi ) ) for i in range( 0, numPoints ) ] ),
+		)
+		points["scale"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.V3fVectorData( [ randomV3f() * 2 - imath.V3f( 1 ) for i in range( 0, numPoints ) ] ),
+		)
+
+		objectToScene = GafferScene.ObjectToScene()
+		objectToScene["object"].setValue( points )
+
+		sphere = GafferScene.Sphere()
+		sphere["transform"]["translate"].setValue( imath.V3f( 2, 0, 0 ) )
+		cube = GafferScene.Cube()
+		cube["transform"]["rotate"].setValue( imath.V3f( 0, 45, 0 ) )
+
+		prototypes = GafferScene.Parent()
+		prototypes["in"].setInput( sphere["out"] )
+		prototypes["children"][0].setInput( cube["out"] )
+		prototypes["parent"].setValue( "/" )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( objectToScene["out"] )
+		instancer["prototypes"].setInput( prototypes["out"] )
+		instancer["parent"].setValue( "/object" )
+		instancer["prototypeIndex"].setValue( "index" )
+		instancer["orientation"].setValue( "orientation" )
+		instancer["scale"].setValue( "scale" )
+
+		exactBounds = {
+			p : instancer["out"].bound( p )
+			for p in [ "/", "/object", "/object/instances", "/object/instances/sphere", "/object/instances/cube" ]
+		}
+		exactBoundHash = instancer["out"].boundHash( "/object/instances/sphere" )
+
+		cs = GafferTest.CapturingSlot( instancer.plugDirtiedSignal() )
+		instancer["conservativeBounds"].setValue( True )
+		self.assertIn( instancer["out"]["bound"], { x[0] for x in cs } )
+		self.assertNotEqual( instancer["out"].boundHash( "/object/instances/sphere" ), exactBoundHash )
+
+		self.assertSceneValid( instancer["out"] )
+		for path, exactBound in exactBounds.items() :
+			self.assertTrue( IECore.BoxAlgo.contains( instancer["out"].bound( path ), exactBound ) )
+
+		# Bounds below the prototype level are unaffected.
+		instancer["conservativeBounds"].setValue( False )
+		exactInstanceBound = instancer["out"].bound( "/object/instances/cube/1" )
+		instancer["conservativeBounds"].setValue( True )
+		self.assertEqual( instancer["out"].bound( "/object/instances/cube/1" ), exactInstanceBound )
+
 	def testObjectAffectsChildNames( self ) :
 
 		plane = GafferScene.Plane()
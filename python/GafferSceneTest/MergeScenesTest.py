@@ -41,6 +41,7 @@ import imath
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -453,16 +454,21 @@ class MergeScenesTest( GafferSceneTest.SceneTestCase ) :
 		self.assertScenesEqual( sphere["out"], merge["out"] )
 		self.assertSceneHashesEqual( sphere["out"], merge["out"] )
 
-	def testMaxInputs( self ) :
+	def testManyInputs( self ) :
 
 		merge = GafferScene.MergeScenes()
 		spheres = []
 		groups = []
 
-		for i in range( 0, merge["in"].maxSize() ) :
+		# More than the 32 inputs we used to be limited to.
+		numInputs = 100
+		self.assertGreaterEqual( merge["in"].maxSize(), numInputs )
+
+		for i in range( 0, numInputs ) :
 			sphere = GafferScene.Sphere()
 			sphere["name"].setValue( "sphere{}".format( i ) )
 			sphere["sets"].setValue( "set{}".format( i ) )
+			sphere["transform"]["translate"]["x"].setValue( i )
 			group = GafferScene.Group()
 			group["in"][0].setInput( sphere["out"] )
 			merge["in"][i].setInput( group["out"] )
@@ -472,12 +478,89 @@ class MergeScenesTest( GafferSceneTest.SceneTestCase ) :
 		self.assertSceneValid( merge["out"] )
 		self.assertEqual(
 			list( merge["out"].childNames( "/group" ) ),
-			[ "sphere{}".format( i ) for i in range( 0, merge["in"].maxSize() ) ]
+			[ "sphere{}".format( i ) for i in range( 0, numInputs ) ]
 		)
 		self.assertEqual(
 			list( merge["out"].setNames() ),
-			[ "set{}".format( i ) for i in range( 0, merge["in"].maxSize() ) ]
+			[ "set{}".format( i ) for i in range( 0, numInputs ) ]
 		)
+		for i in range( 0, numInputs ) :
+			self.assertEqual(
+				merge["out"].set( "set{}".format( i ) ).value.paths(),
+				[ "/group/sphere{}".format( i ) ]
+			)
+		self.assertEqual( merge["out"].bound( "/" ), imath.Box3f( imath.V3f( -1 ), imath.V3f( numInputs, 1, 1 ) ) )
+
+		# Locations coming from just one of the inputs should
+		# be passed through unchanged.
+		self.assertPathHashesEqual( merge["out"], "/group/sphere50", groups[50]["out"], "/group/sphere50" )
+
+		# Disconnecting inputs should update the result.
+		for i in range( 1, numInputs, 2 ) :
+			merge["in"][i].setInput( None )
+
+		self.assertSceneValid( merge["out"] )
+		self.assertEqual(
+			list( merge["out"].childNames( "/group" ) ),
+			[ "sphere{}".format( i ) for i in range( 0, numInputs, 2 ) ]
+		)
+
+	def __assetScenes( self, numInputs ) :
+
+		# Each "asset" scene is a small hierarchy, with some
+		# locations shared between all assets and others unique
+		# to a single asset, as is common in layout assembly.
+
+		result = []
+		for i in range( 0, numInputs ) :
+
+			sphere = GafferScene.Sphere()
+			sphere["sets"].setValue( "asset{} spheres".format( i ) )
+			cube = GafferScene.Cube()
+
+			asset = GafferScene.Group()
+			asset["name"].setValue( "asset{}".format( i ) )
+			asset["in"][0].setInput( sphere["out"] )
+			asset["in"][1].setInput( cube["out"] )
+
+			world = GafferScene.Group()
+			world["name"].setValue( "world" )
+			world["in"][0].setInput( asset["out"] )
+
+			result.extend( [ sphere, cube, asset, world ] )
+
+		return result
+
+	def __testScalingPerformance( self, numInputs ) :
+
+		nodes = self.__assetScenes( numInputs )
+		merge = GafferScene.MergeScenes()
+		for i, world in enumerate( nodes[3::4] ) :
+			merge["in"][i].setInput( world["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferSceneTest.traverseScene( merge["out"] )
+			merge["out"].set( "spheres" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformanceWith2Inputs( self ) :
+
+		self.__testScalingPerformance( 2 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformanceWith10Inputs( self ) :
+
+		self.__testScalingPerformance( 10 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformanceWith100Inputs( self ) :
+
+		self.__testScalingPerformance( 100 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformanceWith1000Inputs( self ) :
+
+		self.__testScalingPerformance( 1000 )
 
 if __name__ == "__main__":
 	unittest.main()
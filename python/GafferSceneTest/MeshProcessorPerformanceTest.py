@@ -0,0 +1,145 @@
+##########################################################################
+#
+#  Copyright (c) 2021, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import unittest
+
+import imath
+
+import IECore
+import IECoreScene
+
+import Gaffer
+import GafferScene
+import GafferSceneTest
+import GafferTest
+
+## Measures the throughput of the mesh processing nodes on a single
+# large mesh, which is the case where the work can't be spread across
+# locations, and must be parallelised within the object instead.
+@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+class MeshProcessorPerformanceTest( GafferSceneTest.SceneTestCase ) :
+
+	def setUp( self ) :
+
+		GafferSceneTest.SceneTestCase.setUp( self )
+
+		mesh = IECoreScene.MeshPrimitive.createPlane(
+			imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ), imath.V2i( 1000 )
+		)
+
+		mesh["Pref"] = mesh["P"]
+		mesh["euler"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.V3fVectorData( [ imath.V3f( i % 360, 0, 0 ) for i in range( 0, mesh.variableSize( IECoreScene.PrimitiveVariable.Interpolation.Vertex ) ) ] )
+		)
+		mesh["deleteFaces"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Uniform,
+			IECore.IntVectorData( [ i % 2 for i in range( 0, mesh.numFaces() ) ] )
+		)
+
+		self.__objectToScene = GafferScene.ObjectToScene()
+		self.__objectToScene["object"].setValue( mesh )
+
+		self.__filter = GafferScene.PathFilter()
+		self.__filter["paths"].setValue( IECore.StringVectorData( [ "/object" ] ) )
+
+	def __measure( self, node ) :
+
+		node["in"].setInput( self.__objectToScene["out"] )
+		node["filter"].setInput( self.__filter["out"] )
+
+		# Precache the input object so we don't include
+		# it in the performance measurement.
+		node["in"].object( "/object" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			node["out"].object( "/object" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testMeshTangents( self ) :
+
+		self.__measure( GafferScene.MeshTangents() )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testMeshDistortion( self ) :
+
+		self.__measure( GafferScene.MeshDistortion() )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testOrientation( self ) :
+
+		orientation = GafferScene.Orientation()
+		orientation["inMode"].setValue( GafferScene.Orientation.Mode.Euler )
+		orientation["inEuler"].setValue( "euler" )
+		orientation["outMode"].setValue( GafferScene.Orientation.Mode.Aim )
+		orientation["outXAxis"].setValue( "xAxis" )
+		orientation["outYAxis"].setValue( "yAxis" )
+		orientation["outZAxis"].setValue( "zAxis" )
+
+		self.__measure( orientation )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testResamplePrimitiveVariables( self ) :
+
+		resample = GafferScene.ResamplePrimitiveVariables()
+		resample["names"].setValue( "P Pref" )
+		resample["interpolation"].setValue( IECoreScene.PrimitiveVariable.Interpolation.FaceVarying )
+
+		self.__measure( resample )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testDeleteFaces( self ) :
+
+		self.__measure( GafferScene.DeleteFaces() )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testReverseWinding( self ) :
+
+		self.__measure( GafferScene.ReverseWinding() )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testMeshToPoints( self ) :
+
+		self.__measure( GafferScene.MeshToPoints() )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testWireframe( self ) :
+
+		self.__measure( GafferScene.Wireframe() )
+
+if __name__ == "__main__":
+	unittest.main()
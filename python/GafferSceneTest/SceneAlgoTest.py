@@ -1237,5 +1237,75 @@ class SceneAlgoTest( GafferSceneTest.SceneTestCase ) :
 
 		assertNoCanceller( history )
 
+	def testHistoryUpdatesAfterEdits( self ) :
+
+		plane = GafferScene.Plane()
+
+		attributes = GafferScene.CustomAttributes()
+		attributes["in"].setInput( plane["out"] )
+
+		def historyPlugs() :
+
+			result = []
+			history = GafferScene.SceneAlgo.history( attributes["out"]["attributes"], "/plane" )
+			while history is not None :
+				result.append( history.scene )
+				history = history.predecessors[0] if history.predecessors else None
+			return result
+
+		self.assertEqual( historyPlugs(), [ attributes["out"], attributes["in"], plane["out"] ] )
+		self.assertEqual( GafferScene.SceneAlgo.source( attributes["out"], "/plane" ), plane["out"] )
+
+		# Repeated queries should give the same result.
+
+		self.assertEqual( historyPlugs(), [ attributes["out"], attributes["in"], plane["out"] ] )
+
+		# And edits should be reflected in subsequent queries.
+
+		sphere = GafferScene.Sphere()
+		sphere["name"].setValue( "plane" )
+		attributes["in"].setInput( sphere["out"] )
+
+		self.assertEqual( historyPlugs(), [ attributes["out"], attributes["in"], sphere["out"] ] )
+		self.assertEqual( GafferScene.SceneAlgo.source( attributes["out"], "/plane" ), sphere["out"] )
+
+		# As should changes of context.
+
+		with Gaffer.Context() as c :
+			c.setFrame( 10 )
+			history = GafferScene.SceneAlgo.history( attributes["out"]["attributes"], "/plane" )
+			self.assertEqual( history.context.getFrame(), 10 )
+
+	def testModifyingHistoryDoesntAffectSubsequentQueries( self ) :
+
+		plane = GafferScene.Plane()
+		group = GafferScene.Group()
+		group["in"][0].setInput( plane["out"] )
+
+		history = GafferScene.SceneAlgo.history( group["out"]["transform"], "/group/plane" )
+		self.assertEqual( len( history.predecessors ), 1 )
+		del history.predecessors[0]
+		history.context["test"] = 10
+
+		history = GafferScene.SceneAlgo.history( group["out"]["transform"], "/group/plane" )
+		self.assertEqual( len( history.predecessors ), 1 )
+		self.assertNotIn( "test", history.context.names() )
+
+	def testClearHistoryCache( self ) :
+
+		plane = GafferScene.Plane()
+		refCount = plane["out"].refCount()
+
+		GafferScene.SceneAlgo.history( plane["out"]["object"], "/plane" )
+		self.assertGreater( plane["out"].refCount(), refCount )
+
+		GafferScene.SceneAlgo.clearHistoryCache()
+		self.assertEqual( plane["out"].refCount(), refCount )
+
+		# The cache must be repopulated correctly after clearing.
+
+		history = GafferScene.SceneAlgo.history( plane["out"]["object"], "/plane" )
+		self.assertEqual( history.scene, plane["out"] )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -58,6 +58,9 @@ class SceneTestCase( GafferImageTest.ImageTestCase ) :
 		sanitiser.__enter__()
 		self.addCleanup( sanitiser.__exit__, None, None, None )
 
+		# Cached histories keep the plugs of the test's scripts alive.
+		self.addCleanup( GafferScene.SceneAlgo.clearHistoryCache )
+
 	def assertSceneValid( self, scenePlug, assertBuiltInSetsComplete=True ) :
 
 		def walkScene( scenePath ) :
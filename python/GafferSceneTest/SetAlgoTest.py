@@ -41,6 +41,7 @@ import six
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -312,6 +313,70 @@ class SetAlgoTest( GafferSceneTest.SceneTestCase ) :
 
 		self.assertFalse( GafferScene.SetAlgo.affectsSetExpression( Gaffer.IntPlug() ) )
 
+	def testIntersectionsAndDifferencesOfUnions( self ) :
+
+		# Intersections and differences are evaluated lazily, restricting
+		# the evaluation of one operand by the other. Check that this gives
+		# the same results as plain set algebra.
+
+		contents = {
+			"A" : { "/a/{}".format( i ) for i in range( 0, 100 ) },
+			"B" : { "/a/{}".format( i ) for i in range( 50, 150 ) },
+			"C" : { "/a/{}".format( i ) for i in range( 0, 200, 3 ) },
+			"D" : { "/a/{}".format( i ) for i in range( 0, 10 ) } | { "/b" },
+			"E" : { "/a", "/b/c" },
+		}
+
+		sets = []
+		for name, paths in contents.items() :
+			s = GafferScene.Set()
+			s["name"].setValue( name )
+			s["paths"].setValue( IECore.StringVectorData( sorted( paths ) ) )
+			if sets :
+				s["in"].setInput( sets[-1]["out"] )
+			sets.append( s )
+
+		scene = sets[-1]["out"]
+		A, B, C, D, E = [ contents[n] for n in "ABCDE" ]
+
+		self.assertCorrectEvaluation( scene, "(A | B | C) & D", ( A | B | C ) & D )
+		self.assertCorrectEvaluation( scene, "D & (A | B | C)", ( A | B | C ) & D )
+		self.assertCorrectEvaluation( scene, "A & B & C", A & B & C )
+		self.assertCorrectEvaluation( scene, "(A | B) & (C | D)", ( A | B ) & ( C | D ) )
+		self.assertCorrectEvaluation( scene, "D - (A | B | C)", D - ( A | B | C ) )
+		self.assertCorrectEvaluation( scene, "(A | B) - C", ( A | B ) - C )
+		self.assertCorrectEvaluation( scene, "(A - C) & (B - D)", ( A - C ) & ( B - D ) )
+		self.assertCorrectEvaluation( scene, "((A | B) - C) & D", ( ( A | B ) - C ) & D )
+		self.assertCorrectEvaluation( scene, "(A | B | C) & /a/3", ( A | B | C ) & { "/a/3" } )
+		self.assertCorrectEvaluation( scene, "(A | B | C | D) & /b", { "/b" } )
+		self.assertCorrectEvaluation( scene, "[A-C] & D", ( A | B | C ) & D )
+		self.assertCorrectEvaluation( scene, "(A | D) & (A | D) in E", ( A | D ) & { p for p in A | D if p.startswith( "/a/" ) } )
+		self.assertCorrectEvaluation( scene, "(D containing E) & (A | D)", { "/b" } )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testLargeUnionIntersectedWithSmallSetPerformance( self ) :
+
+		sets = []
+		for i in range( 0, 20 ) :
+			s = GafferScene.Set()
+			s["name"].setValue( "large{}".format( i ) )
+			s["paths"].setValue( IECore.StringVectorData( [ "/group{}/object{}".format( i, j ) for j in range( 0, 50000 ) ] ) )
+			if sets :
+				s["in"].setInput( sets[-1]["out"] )
+			sets.append( s )
+
+		small = GafferScene.Set()
+		small["name"].setValue( "small" )
+		small["paths"].setValue( IECore.StringVectorData( [ "/group{}/object0".format( i ) for i in range( 0, 20 ) ] ) )
+		small["in"].setInput( sets[-1]["out"] )
+
+		# Precache the sets, so we measure only the evaluation.
+		GafferScene.SceneAlgo.sets( small["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 100 ) :
+				GafferScene.SetAlgo.evaluateSetExpression( "large* & small", small["out"] )
+
 	def assertCorrectEvaluation( self, scenePlug, expression, expectedContents ) :
 
 		result = set( GafferScene.SetAlgo.evaluateSetExpression( expression, scenePlug ).paths() )
@@ -35,6 +35,7 @@
 ##########################################################################
 
 import unittest
+import six
 import math
 import imath
 
@@ -174,5 +175,102 @@ class UDIMQueryTest( GafferSceneTest.SceneTestCase ) :
 		self.assertNotEqual( initialHash, udimQuery["out"].hash() )
 		self.assertEqual( dictResult(), {'1001': {'/test': {}}} )
 
+	def testEditOneOfManyIdenticalMeshes( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 10, 10 ) )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( plane["out"] )
+		duplicate["target"].setValue( "/plane" )
+		duplicate["copies"].setValue( 2 )
+
+		camera = GafferScene.Camera()
+		camera["transform"]["translate"].setValue( imath.V3f( -1, 0, 0 ) )
+		camera["projection"].setValue( "orthographic" )
+		camera["orthographicAperture"].setValue( imath.V2f( 1 ) )
+
+		parent = GafferScene.Parent()
+		parent["in"].setInput( duplicate["out"] )
+		parent["children"][0].setInput( camera["out"] )
+		parent["parent"].setValue( "/" )
+
+		projectionFilter = GafferScene.PathFilter()
+
+		mapProjection = GafferScene.MapProjection()
+		mapProjection["in"].setInput( parent["out"] )
+		mapProjection["filter"].setInput( projectionFilter["out"] )
+		mapProjection["camera"].setValue( "/camera" )
+
+		allFilter = GafferScene.PathFilter()
+		allFilter["paths"].setValue( IECore.StringVectorData( [ "/..." ] ) )
+
+		udimQuery = GafferScene.UDIMQuery()
+		udimQuery["in"].setInput( mapProjection["out"] )
+		udimQuery["filter"].setInput( allFilter["out"] )
+
+		def result() :
+			return { k : set( v.keys() ) for k, v in udimQuery["out"].getValue().items() }
+
+		# Disable the compute cache, so that every mesh the UDIMQuery
+		# fetches shows up as a compute of `mapProjection["out"]["object"]`.
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( 0 )
+
+		self.assertEqual( result(), { "1001" : { "/plane", "/plane1", "/plane2" } } )
+
+		# Project UVs onto just one of the copies, moving it into another UDIM.
+		# The others should be unaffected, and shouldn't need to be fetched again.
+
+		projectionFilter["paths"].setValue( IECore.StringVectorData( [ "/plane1" ] ) )
+		with Gaffer.PerformanceMonitor() as monitor :
+			self.assertEqual( result(), { "1001" : { "/plane", "/plane2" }, "1002" : { "/plane1" } } )
+		self.assertEqual( monitor.plugStatistics( mapProjection["out"]["object"] ).computeCount, 1 )
+
+		# Reverting the edit restores the original mesh, which was processed
+		# before, so no meshes need fetching at all.
+
+		projectionFilter["paths"].setValue( IECore.StringVectorData( [] ) )
+		with Gaffer.PerformanceMonitor() as monitor :
+			self.assertEqual( result(), { "1001" : { "/plane", "/plane1", "/plane2" } } )
+		self.assertEqual( monitor.plugStatistics( mapProjection["out"]["object"] ).computeCount, 0 )
+
+	def testBadUVsErrorMentionsLocation( self ) :
+
+		mesh = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ) )
+		mesh["uv"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.FaceVarying, IECore.V2fVectorData( [ imath.V2f( 0 ) ] ) )
+
+		objectToScene = GafferScene.ObjectToScene()
+		objectToScene["object"].setValue( mesh )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( objectToScene["out"] )
+		group["in"][1].setInput( objectToScene["out"] )
+
+		pathFilter = GafferScene.PathFilter()
+
+		udimQuery = GafferScene.UDIMQuery()
+		udimQuery["in"].setInput( group["out"] )
+		udimQuery["filter"].setInput( pathFilter["out"] )
+
+		# Both locations have the same mesh, but errors must
+		# report the location being queried.
+		for path in [ "/group/object", "/group/object1" ] :
+			pathFilter["paths"].setValue( IECore.StringVectorData( [ path ] ) )
+			with six.assertRaisesRegex( self, RuntimeError, "Bad uvs at location {}\\.".format( path ) ) :
+				udimQuery["out"].getValue()
+
+	def setUp( self ) :
+
+		GafferSceneTest.SceneTestCase.setUp( self )
+
+		self.__originalCacheMemoryLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+
+	def tearDown( self ) :
+
+		GafferSceneTest.SceneTestCase.tearDown( self )
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+
 if __name__ == "__main__":
 	unittest.main()
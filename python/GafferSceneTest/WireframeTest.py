@@ -172,5 +172,47 @@ class WireframeTest( GafferSceneTest.SceneTestCase ) :
 		self.assertScenesEqual( wireframe["in"], wireframe["out"], checks = { "bound" } )
 		self.assertSceneHashesEqual( wireframe["in"], wireframe["out"], checks = { "bound" } )
 
+	def testLargeMeshMatchesSerialOrdering( self ) :
+
+		# Large enough to use the parallel kernel.
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 160 ) )
+
+		filter = GafferScene.PathFilter()
+		filter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		wireframe = GafferScene.Wireframe()
+		wireframe["in"].setInput( plane["out"] )
+		wireframe["filter"].setInput( filter["out"] )
+
+		mesh = plane["out"].object( "/plane" )
+		curves = wireframe["out"].object( "/plane" )
+
+		# Emulate the serial algorithm, which emits edges in face order,
+		# skipping any that have already been emitted.
+
+		expected = []
+		visited = set()
+		vertexIds = mesh.vertexIds
+		p = mesh["P"].data
+		offset = 0
+		for numVertices in mesh.verticesPerFace :
+			for i in range( 0, numVertices ) :
+				index0 = vertexIds[offset+i]
+				index1 = vertexIds[offset+(i+1)%numVertices]
+				edge = ( min( index0, index1 ), max( index0, index1 ) )
+				if edge not in visited :
+					visited.add( edge )
+					expected.extend( [ p[index0], p[index1] ] )
+			offset += numVertices
+
+		self.assertEqual( len( curves.verticesPerCurve() ), 160 * 161 * 2 )
+		self.assertEqual( list( curves["P"].data ), expected )
+
+		# And results must be repeatable.
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( wireframe["out"].object( "/plane" ), curves )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -306,6 +306,22 @@ Gaffer.Metadata.registerNode(
 
 		],
 
+		"conservativeBounds" : [
+
+			"description",
+			"""
+			Computes the bounds of the instances from the point
+			positions and the maximum scale, rather than by transforming
+			the bound of each individual instance. This avoids evaluating
+			every instance when only the bound is required (for instance,
+			when framing the Viewer), at the expense of producing bounds
+			which may be larger than necessary.
+			""",
+
+			"layout:section", "Settings.Bounds",
+
+		],
+
 	}
 
 )
@@ -138,7 +138,27 @@ Gaffer.Metadata.registerNode(
 			"presetNames", lambda plug : IECore.StringVectorData( GafferImageUI.ImageView.registeredDisplayTransforms() ),
 			"presetValues", lambda plug : IECore.StringVectorData( GafferImageUI.ImageView.registeredDisplayTransforms() ),
 
-		]
+		],
+
+		"textureResolution" : [
+
+			"description",
+			"""
+			The resolution that textures are downsampled to for display.
+			Lower resolutions are quicker to update.
+			""",
+
+			"plugValueWidget:type", "GafferUI.PresetsPlugValueWidget",
+			"label", "",
+			"toolbarLayout:width", 75,
+
+			"preset:128", 128,
+			"preset:256", 256,
+			"preset:512", 512,
+			"preset:1024", 1024,
+			"preset:2048", 2048,
+
+		],
 
 
 	}
@@ -170,6 +170,94 @@ class SceneGadgetTest( GafferUITest.TestCase ) :
 		self.assertObjectAt( sg, imath.V2f( 0.5 ), None )
 		self.assertObjectsAt( sg, imath.Box2f( imath.V2f( 0 ), imath.V2f( 1 ) ), [ "/group" ] )
 
+	def testExpansionDuringUpdate( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["s"] = GafferScene.Sphere()
+		s["d"] = GafferScene.Duplicate()
+		s["d"]["in"].setInput( s["s"]["out"] )
+		s["d"]["target"].setValue( "/sphere" )
+		s["d"]["copies"].setValue( 1000 )
+		s["g"] = GafferScene.Group()
+		s["g"]["in"][0].setInput( s["d"]["out"] )
+
+		sg = GafferSceneUI.SceneGadget()
+		sg.setScene( s["g"]["out"] )
+
+		with GafferUI.Window() as w :
+			gw = GafferUI.GadgetWidget( sg )
+
+		w.setVisible( True )
+		self.waitForIdle( 1000 )
+
+		sg.waitForCompletion()
+		gw.getViewportGadget().frame( sg.bound() )
+		self.assertObjectsAt( sg, imath.Box2f( imath.V2f( 0 ), imath.V2f( 1 ) ), [ "/group" ] )
+
+		# Change the expansion repeatedly, without waiting for the
+		# update to complete in between. Each change should be merged
+		# into the update in progress, and the final result should
+		# reflect the last expansion.
+
+		sg.setExpandedPaths( IECore.PathMatcher( [ "/group" ] ) )
+		self.waitForIdle( 1000 )
+		sg.setExpandedPaths( IECore.PathMatcher( [] ) )
+		self.waitForIdle( 1000 )
+		sg.setExpandedPaths( IECore.PathMatcher( [ "/group" ] ) )
+		self.assertEqual( sg.getExpandedPaths(), IECore.PathMatcher( [ "/group" ] ) )
+
+		sg.waitForCompletion()
+		self.assertEqual( sg.state(), sg.State.Complete )
+		viewportGadget = gw.getViewportGadget()
+		line = viewportGadget.rasterToGadgetSpace( imath.V2f( viewportGadget.getViewport() ) * 0.5, sg )
+		path = [ str( n ) for n in sg.objectAt( line ) ]
+		self.assertEqual( len( path ), 2 )
+		self.assertEqual( path[0], "group" )
+		self.assertIn( path[1], [ str( n ) for n in s["g"]["out"].childNames( "/group" ) ] )
+
+		sg.setExpandedPaths( IECore.PathMatcher( [] ) )
+		sg.waitForCompletion()
+
+		self.assertObjectsAt( sg, imath.Box2f( imath.V2f( 0 ), imath.V2f( 1 ) ), [ "/group" ] )
+
+	def testBoundsFirst( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["s"] = GafferScene.Sphere()
+		s["g"] = GafferScene.Group()
+		s["g"]["in"][0].setInput( s["s"]["out"] )
+
+		sg = GafferSceneUI.SceneGadget()
+		self.assertEqual( sg.getBoundsFirst(), False )
+		sg.setBoundsFirst( True )
+		self.assertEqual( sg.getBoundsFirst(), True )
+
+		sg.setScene( s["g"]["out"] )
+		sg.setExpandedPaths( IECore.PathMatcher( [ "/group" ] ) )
+
+		with GafferUI.Window() as w :
+			gw = GafferUI.GadgetWidget( sg )
+
+		w.setVisible( True )
+		self.waitForIdle( 10000 )
+
+		sg.waitForCompletion()
+		gw.getViewportGadget().frame( sg.bound() )
+		self.waitForIdle( 10000 )
+
+		# Once complete, the placeholder bounds should have been
+		# replaced by the objects themselves.
+
+		self.assertEqual( sg.bound(), s["g"]["out"].bound( "/" ) )
+		self.assertObjectAt( sg, imath.V2f( 0.5 ), IECore.InternedStringVectorData( [ "group", "sphere" ] ) )
+		self.assertObjectsAt( sg, imath.Box2f( imath.V2f( 0 ), imath.V2f( 1 ) ), [ "/group/sphere" ] )
+
+		# And edits should still be reflected as usual.
+
+		s["s"]["transform"]["translate"]["x"].setValue( 1 )
+		sg.waitForCompletion()
+		self.assertEqual( sg.bound(), s["g"]["out"].bound( "/" ) )
+
 	def testExpressions( self ) :
 
 		s = Gaffer.ScriptNode()
@@ -583,5 +583,79 @@ class AnimationTest( GafferTest.TestCase ) :
 				Gaffer.Animation.Key( context.getTime(), context.getTime(), Gaffer.Animation.Type.Linear )
 			)
 
+	def testManyCurves( self ) :
+
+		# Enough curves to trigger batched evaluation.
+
+		s = Gaffer.ScriptNode()
+		s["n"] = Gaffer.Node()
+		s["a"] = Gaffer.Animation()
+
+		curves = []
+		for i in range( 0, 100 ) :
+			s["n"]["user"]["f%d" % i] = Gaffer.FloatPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+			curve = Gaffer.Animation.CurvePlug( "curve%d" % i, flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+			s["a"]["curves"].addChild( curve )
+			curve.addKey( Gaffer.Animation.Key( 0, i, Gaffer.Animation.Type.Linear ) )
+			curve.addKey( Gaffer.Animation.Key( 1, i * 2, Gaffer.Animation.Type.Step if i % 2 else Gaffer.Animation.Type.Linear ) )
+			s["n"]["user"]["f%d" % i].setInput( curve["out"] )
+			curves.append( curve )
+
+		def assertValuesMatchCurves() :
+
+			with Gaffer.Context() as c :
+				for frame in ( -1, 0, 6, 12, 24, 30 ) :
+					c.setFrame( frame )
+					for i, curve in enumerate( curves ) :
+						self.assertEqual( s["n"]["user"]["f%d" % i].getValue(), curve.evaluate( c.getTime() ) )
+
+		assertValuesMatchCurves()
+
+		# Edits must be reflected in subsequent evaluations.
+
+		with Gaffer.UndoScope( s ) :
+			curves[10].getKey( 1 ).setValue( 100 )
+			curves[11].getKey( 0 ).setTime( -1 )
+			curves[12].getKey( 1 ).setType( Gaffer.Animation.Type.Step )
+			curves[13].addKey( Gaffer.Animation.Key( 2, 50 ) )
+			curves[14].removeKey( curves[14].getKey( 0 ) )
+
+		assertValuesMatchCurves()
+
+		s.undo()
+		assertValuesMatchCurves()
+
+		# As must the addition and removal of curves.
+
+		del s["a"]["curves"]["curve0"]
+		curves = curves[1:]
+		for i in range( 0, len( curves ) ) :
+			s["n"]["user"]["f%d" % i].setInput( curves[i]["out"] )
+
+		assertValuesMatchCurves()
+
+	def testSetType( self ) :
+
+		curve = Gaffer.Animation.CurvePlug()
+		key = Gaffer.Animation.Key( 0, 1, Gaffer.Animation.Type.Linear )
+		curve.addKey( key )
+
+		key.setType( Gaffer.Animation.Type.Step )
+		self.assertEqual( key.getType(), Gaffer.Animation.Type.Step )
+		self.assertEqual( key.getValue(), 1 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPlaybackPerformance( self ) :
+
+		a = Gaffer.Animation()
+		for i in range( 0, 20000 ) :
+			curve = Gaffer.Animation.CurvePlug( "curve%d" % i, flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+			a["curves"].addChild( curve )
+			for t in range( 0, 4 ) :
+				curve.addKey( Gaffer.Animation.Key( t, i + t, Gaffer.Animation.Type.Linear ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferTest.playbackAnimation( a, 0, 100 )
+
 if __name__ == "__main__":
 	unittest.main()
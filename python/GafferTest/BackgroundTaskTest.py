@@ -35,6 +35,7 @@
 ##########################################################################
 
 import functools
+import threading
 import time
 
 import IECore
@@ -231,5 +232,108 @@ class BackgroundTaskTest( GafferTest.TestCase ) :
 
 		t.cancelAndWait()
 
+	def testPriority( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = GafferTest.AddNode()
+
+		t = Gaffer.BackgroundTask( s["n"]["sum"], lambda canceller : None )
+		self.assertEqual( t.priority(), t.Priority.Visible )
+		t.wait()
+
+		t = Gaffer.BackgroundTask( s["n"]["sum"], lambda canceller : None, priority = Gaffer.BackgroundTask.Priority.Interactive )
+		self.assertEqual( t.priority(), t.Priority.Interactive )
+		t.wait()
+
+	def __waitForStatus( self, task, status ) :
+
+		startTime = time.time()
+		while task.status() != status :
+			self.assertLess( time.time(), startTime + 10 )
+			time.sleep( 0.01 )
+
+	def testSpeculativeTasksDeferred( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = GafferTest.AddNode()
+
+		event = threading.Event()
+		interactive = Gaffer.BackgroundTask(
+			s["n"]["sum"], lambda canceller : event.wait( 10 ),
+			priority = Gaffer.BackgroundTask.Priority.Interactive
+		)
+		self.__waitForStatus( interactive, interactive.Status.Running )
+
+		speculative = Gaffer.BackgroundTask(
+			s["n"]["sum"], lambda canceller : None,
+			priority = Gaffer.BackgroundTask.Priority.Speculative
+		)
+
+		time.sleep( 0.1 )
+		self.assertEqual( speculative.status(), speculative.Status.Pending )
+
+		event.set()
+		interactive.wait()
+		speculative.wait()
+		self.assertEqual( speculative.status(), speculative.Status.Completed )
+
+	def testSpeculativeTasksPreempted( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = GafferTest.AddNode()
+
+		calls = []
+		def speculativeFunction( canceller ) :
+
+			calls.append( "speculative" )
+			if len( calls ) == 1 :
+				while True :
+					IECore.Canceller.check( canceller )
+
+		speculative = Gaffer.BackgroundTask(
+			s["n"]["sum"], speculativeFunction,
+			priority = Gaffer.BackgroundTask.Priority.Speculative
+		)
+		self.__waitForStatus( speculative, speculative.Status.Running )
+
+		interactive = Gaffer.BackgroundTask(
+			s["n"]["sum"], lambda canceller : calls.append( "interactive" ),
+			priority = Gaffer.BackgroundTask.Priority.Interactive
+		)
+
+		interactive.wait()
+		speculative.wait()
+
+		# Speculative task was interrupted, and then run again
+		# to completion after the interactive task.
+		self.assertEqual( calls, [ "speculative", "interactive", "speculative" ] )
+		self.assertEqual( speculative.status(), speculative.Status.Completed )
+
+	def testCancelPreemptedTask( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = GafferTest.AddNode()
+
+		def f( canceller ) :
+
+			while True :
+				IECore.Canceller.check( canceller )
+
+		speculative = Gaffer.BackgroundTask( s["n"]["sum"], f, priority = Gaffer.BackgroundTask.Priority.Speculative )
+		self.__waitForStatus( speculative, speculative.Status.Running )
+
+		event = threading.Event()
+		interactive = Gaffer.BackgroundTask(
+			s["n"]["sum"], lambda canceller : event.wait( 10 ),
+			priority = Gaffer.BackgroundTask.Priority.Interactive
+		)
+		self.__waitForStatus( speculative, speculative.Status.Pending )
+
+		speculative.cancelAndWait()
+		self.assertEqual( speculative.status(), speculative.Status.Cancelled )
+
+		event.set()
+		interactive.wait()
+
 if __name__ == "__main__":
 	unittest.main()
@@ -726,5 +726,124 @@ class DependencyNodeTest( GafferTest.TestCase ) :
 		self.assertEqual( mh.messages[0].context, "Plug dirty propagation" )
 		six.assertRegex( self, mh.messages[0].message, r"Cycle detected between node.* and node.*" )
 
+	def testPlugsDirtiedSignal( self ) :
+
+		a1 = GafferTest.AddNode()
+		a2 = GafferTest.AddNode()
+		a2["op1"].setInput( a1["sum"] )
+		a2["op2"].setInput( a1["sum"] )
+
+		calls = []
+		def slot( plugs ) :
+			calls.append( ( plugs, list( cs ) ) )
+
+		cs = GafferTest.CapturingSlot( a2.plugDirtiedSignal() )
+		c = a2.plugsDirtiedSignal().connect( slot )
+
+		a1["op1"].setValue( 21 )
+
+		# Called once, with all the dirtied plugs in the same
+		# order as `plugDirtiedSignal()`, and only after all the
+		# individual signals have been emitted.
+		self.assertEqual( len( calls ), 1 )
+		self.assertEqual( calls[0][0], [ a2["op1"], a2["op2"], a2["sum"] ] )
+		self.assertEqual( [ x[0] for x in calls[0][1] ], calls[0][0] )
+
+		# Not called for nodes without dirtied plugs.
+
+		a2["op1"].setInput( None )
+		del calls[:]
+		a2["op1"].setValue( 1 )
+		a1["op2"].setValue( 2 )
+		self.assertEqual( len( calls ), 2 )
+		self.assertEqual( calls[0][0], [ a2["op1"], a2["sum"] ] )
+		self.assertEqual( calls[1][0], [ a2["op2"], a2["sum"] ] )
+
+	def testPlugDirtiedSlotDeletingNode( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["a1"] = GafferTest.AddNode()
+		s["a2"] = GafferTest.AddNode()
+		s["a2"]["op1"].setInput( s["a1"]["sum"] )
+
+		# Slots of `plugDirtiedSignal()` may delete nodes (deliberately,
+		# or via Python garbage collection) before `plugsDirtiedSignal()`
+		# is emitted for them.
+
+		def plugDirtied( plug ) :
+			if "a2" in s :
+				del s["a2"]
+
+		plugsDirtied = []
+		def plugsDirtiedSlot( plugs ) :
+			plugsDirtied.extend( [ p.getName() for p in plugs ] )
+
+		c1 = s["a2"].plugDirtiedSignal().connect( plugDirtied )
+		c2 = s["a2"].plugsDirtiedSignal().connect( plugsDirtiedSlot )
+
+		s["a1"]["op1"].setValue( 1 )
+
+		self.assertNotIn( "a2", s )
+		self.assertEqual( plugsDirtied, [ "op1", "sum" ] )
+
+		# Nodes created after the deletion must not be confused with
+		# the deleted one.
+
+		s["a3"] = GafferTest.AddNode()
+		s["a3"]["op1"].setInput( s["a1"]["sum"] )
+		cs = GafferTest.CapturingSlot( s["a3"].plugsDirtiedSignal() )
+		s["a1"]["op1"].setValue( 2 )
+		self.assertEqual( len( cs ), 1 )
+		self.assertEqual( cs[0][0], [ s["a3"]["op1"], s["a3"]["sum"] ] )
+
+	def testDirtyPropagationAfterConnectionChanges( self ) :
+
+		a1 = GafferTest.AddNode()
+		a2 = GafferTest.AddNode()
+		a3 = GafferTest.AddNode()
+		a2["op1"].setInput( a1["sum"] )
+
+		cs2 = GafferTest.CapturingSlot( a2.plugDirtiedSignal() )
+		cs3 = GafferTest.CapturingSlot( a3.plugDirtiedSignal() )
+
+		for i in range( 1, 3 ) :
+			del cs2[:]
+			a1["op1"].setValue( i )
+			self.assertEqual( [ x[0] for x in cs2 ], [ a2["op1"], a2["sum"] ] )
+
+		a3["op1"].setInput( a2["sum"] )
+		del cs2[:]
+		del cs3[:]
+		a1["op1"].setValue( 10 )
+		self.assertEqual( [ x[0] for x in cs2 ], [ a2["op1"], a2["sum"] ] )
+		self.assertEqual( [ x[0] for x in cs3 ], [ a3["op1"], a3["sum"] ] )
+
+		a2["op1"].setInput( None )
+		del cs2[:]
+		del cs3[:]
+		a1["op1"].setValue( 11 )
+		self.assertEqual( cs2, [] )
+		self.assertEqual( cs3, [] )
+
+		a2["op1"].setInput( a1["sum"] )
+		a3["op1"].setFlags( Gaffer.Plug.Flags.AcceptsDependencyCycles, True )
+		del cs2[:]
+		del cs3[:]
+		a1["op1"].setValue( 12 )
+		self.assertEqual( [ x[0] for x in cs2 ], [ a2["op1"], a2["sum"] ] )
+		self.assertEqual( [ x[0] for x in cs3 ], [ a3["op1"], a3["sum"] ] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testRepeatedDirtyPropagationPerformance( self ) :
+
+		nodes = [ GafferTest.AddNode() for i in range( 0, 1000 ) ]
+		for i in range( 1, len( nodes ) ) :
+			nodes[i]["op1"].setInput( nodes[i-1]["sum"] )
+			nodes[i]["op2"].setInput( nodes[i-1]["sum"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 1, 1001 ) :
+				nodes[0]["op1"].setValue( i )
+
 if __name__ == "__main__":
 	unittest.main()
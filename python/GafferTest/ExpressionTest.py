@@ -36,6 +36,7 @@
 ##########################################################################
 
 import os
+import math
 import inspect
 import unittest
 import imath
@@ -1475,5 +1476,191 @@ class ExpressionTest( GafferTest.TestCase ) :
 			s["n"]["user"]["p"].getValue
 		)
 
+	def __compilesNatively( self, expressionNode, expression ) :
+
+		engine = Gaffer.PythonExpressionEngine()
+		inPlugs, outPlugs = [], []
+		engine.parse( expressionNode, expression, inPlugs, outPlugs, [] )
+		return engine._compileNative( expressionNode, expression, inPlugs, outPlugs )
+
+	def testNativeEvaluation( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		s["a"] = Gaffer.Node()
+		s["a"]["user"]["i"] = Gaffer.IntPlug( defaultValue = 3, flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["a"]["user"]["f"] = Gaffer.FloatPlug( defaultValue = 2.5, flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["a"]["user"]["s"] = Gaffer.StringPlug( defaultValue = "abc", flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["a"]["user"]["b"] = Gaffer.BoolPlug( defaultValue = True, flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+
+		# Evaluated natively.
+		s["n"] = Gaffer.Node()
+		# Forced to evaluate in Python, for comparison.
+		s["p"] = Gaffer.Node()
+
+		for node in ( s["n"], s["p"] ) :
+			node["user"]["i"] = Gaffer.IntPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+			node["user"]["f"] = Gaffer.FloatPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+			node["user"]["s"] = Gaffer.StringPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+			node["user"]["b"] = Gaffer.BoolPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+
+		s["en"] = Gaffer.Expression()
+		s["ep"] = Gaffer.Expression()
+
+		expressions = [
+
+			( "i", "parent['a']['user']['i'] * 2 + 1" ),
+			( "i", "parent['a']['user']['i'] // 2" ),
+			( "i", "-7 // 2" ),
+			( "i", "-7 % 3" ),
+			( "i", "7 % -3" ),
+			( "i", "2 ** 10" ),
+			( "i", "int( parent['a']['user']['f'] * 3 )" ),
+			( "i", "int( -2.5 )" ),
+			( "i", "int( ' 42 ' )" ),
+			( "i", "abs( -5 )" ),
+			( "i", "max( 1, parent['a']['user']['i'], 2 )" ),
+			( "i", "min( 4, 3 )" ),
+			( "i", "int( round( 2.5 ) ) + int( round( 3.5 ) )" ),
+			( "i", "int( context.getFrame() ) + 1" ),
+			( "i", "1 if parent['a']['user']['b'] else 2" ),
+			( "i", "parent['a']['user']['b'] + 1" ),
+			( "i", "2.7" ),
+
+			( "f", "parent['a']['user']['f'] / 3" ),
+			( "f", "7 / 2" ),
+			( "f", "7.5 // 2" ),
+			( "f", "-7.5 % 2" ),
+			( "f", "2 ** -1" ),
+			( "f", "2.0 ** 0.5" ),
+			( "f", "context.getTime()" ),
+			( "f", "context.getFramesPerSecond()" ),
+			( "f", "context.get( 'missing', 1.5 )" ),
+			( "f", "float( parent['a']['user']['i'] ) / 7" ),
+			( "f", "float( '1e-3' )" ),
+			( "f", "-parent['a']['user']['f']" ),
+			( "f", "10" ),
+
+			( "s", "'%s_%04d' % ( parent['a']['user']['s'], parent['a']['user']['i'] )" ),
+			( "s", "'%.3f' % parent['a']['user']['f']" ),
+			( "s", "'%5s|%-5s|%x|%X|%+d|%e|%g|%%' % ( 'a', 'b', 255, 255, 3, 1234.5, 0.0001 )" ),
+			( "s", "str( 0.1 )" ),
+			( "s", "str( 1e20 )" ),
+			( "s", "str( 1.0 / 3 )" ),
+			( "s", "str( 123456789.0 )" ),
+			( "s", "str( -0.00001 )" ),
+			( "s", "str( 2.0 ** 60 )" ),
+			( "s", "str( 100 )" ),
+			( "s", "str( None )" ),
+			( "s", "str( True )" ),
+			( "s", "parent['a']['user']['s'] + '_' + str( parent['a']['user']['i'] )" ),
+			( "s", "'a' 'b' \"c\\\"\"" ),
+			( "s", "context['s']" ),
+			( "s", "context.get( 's' )" ),
+			( "s", "parent['a']['user']['s'] or 'empty'" ),
+			( "s", "'' or 'empty'" ),
+
+			( "b", "parent['a']['user']['i'] > 2 and parent['a']['user']['f'] < 3" ),
+			( "b", "1 < parent['a']['user']['i'] < 4" ),
+			( "b", "3 < parent['a']['user']['i'] < 4" ),
+			( "b", "'frame' in context" ),
+			( "b", "'missing' not in context" ),
+			( "b", "not parent['a']['user']['b']" ),
+			( "b", "'abc' < 'abd'" ),
+			( "b", "1 == 1.0" ),
+			( "b", "1 == '1'" ),
+			( "b", "None != 0" ),
+			( "b", "bool( '' )" ),
+
+		]
+
+		# Exercise statements as well as expressions.
+		expressions.append( ( "s", "''\nx = parent['a']['user']['i']\nif x > 5 :\n    y = 'big'\nelif x > 2 :\n    y = 'medium'\nelse :\n    y = 'small'\nparent['{node}']['user']['s'] = y" ) )
+		expressions.append( ( "i", "0\nif parent['a']['user']['b'] : parent['{node}']['user']['i'] = 10; pass\n" ) )
+
+		context = Gaffer.Context()
+		context.setFrame( 10.5 )
+		context.setFramesPerSecond( 48 )
+		context["s"] = "contextString"
+
+		with context :
+
+			for output, rhs in expressions :
+
+				expression = "parent['{node}']['user']['" + output + "'] = " + rhs
+				nativeExpression = expression.replace( "{node}", "n" )
+				pythonExpression = "import os\n" + expression.replace( "{node}", "p" )
+
+				s["en"].setExpression( nativeExpression )
+				s["ep"].setExpression( pythonExpression )
+
+				self.assertTrue( self.__compilesNatively( s["en"], nativeExpression ), nativeExpression )
+				self.assertFalse( self.__compilesNatively( s["ep"], pythonExpression ), pythonExpression )
+
+				self.assertEqual(
+					s["n"]["user"][output].getValue(),
+					s["p"]["user"][output].getValue(),
+					nativeExpression
+				)
+
+	def testNativeEvaluationFallback( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = Gaffer.Node()
+		s["n"]["user"]["i"] = Gaffer.IntPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n"]["user"]["f"] = Gaffer.FloatPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n"]["user"]["v"] = Gaffer.V3fPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["e"] = Gaffer.Expression()
+
+		# Unsupported at compile time. These are evaluated entirely
+		# by Python.
+
+		for expression, plug, value in [
+			( "import math; parent['n']['user']['f'] = math.pi", "f", math.pi ),
+			( "parent['n']['user']['i'] = len( 'abc' )", "i", 3 ),
+			( "parent['n']['user']['i'] = 0x10", "i", 16 ),
+			( "x = [ 1, 2 ]; parent['n']['user']['i'] = x[1]", "i", 2 ),
+			( "parent['n']['user']['f'] = float( '{}'.format( 1.5 ) )", "f", 1.5 ),
+			( "parent['n']['user']['v'] = imath.V3f( 1, 2, 3 )", "v", imath.V3f( 1, 2, 3 ) ),
+		] :
+			s["e"].setExpression( expression )
+			self.assertFalse( self.__compilesNatively( s["e"], expression ), expression )
+			if isinstance( value, float ) :
+				self.assertAlmostEqual( s["n"]["user"][plug].getValue(), value, places = 5 )
+			else :
+				self.assertEqual( s["n"]["user"][plug].getValue(), value )
+
+		# Unsupported at runtime. These defer to Python for the
+		# evaluation, so that errors are reported consistently.
+
+		s["e"].setExpression( "parent['n']['user']['i'] = 2 ** 40" )
+		self.assertTrue( self.__compilesNatively( s["e"], "parent['n']['user']['i'] = 2 ** 40" ) )
+		self.assertRaises( Gaffer.ProcessException, s["n"]["user"]["i"].getValue )
+
+		s["e"].setExpression( "parent['n']['user']['f'] = 1 / ( context.getFrame() - 1 )" )
+		with Gaffer.Context() as c :
+			c.setFrame( 2 )
+			self.assertEqual( s["n"]["user"]["f"].getValue(), 1 )
+			c.setFrame( 1 )
+			six.assertRaisesRegex( self, Gaffer.ProcessException, ".*ZeroDivisionError", s["n"]["user"]["f"].getValue )
+
+		s["e"].setExpression( "parent['n']['user']['f'] = context['missing']" )
+		six.assertRaisesRegex( self, Gaffer.ProcessException, ".*missing", s["n"]["user"]["f"].getValue )
+
+		s["e"].setExpression( "parent['n']['user']['i'] = None" )
+		six.assertRaisesRegex( self, Gaffer.ProcessException, ".*Unsupported type for result", s["n"]["user"]["i"].getValue )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testNativeEvaluationPerformance( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = Gaffer.Node()
+		s["n"]["user"]["i"] = Gaffer.IntPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression( "parent['n']['user']['i'] = int( context.getFrame() ) + 10" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferTest.parallelGetValueForFrames( s["n"]["user"]["i"], 500000 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -308,6 +308,92 @@ class FileSystemPathTest( GafferTest.TestCase ) :
 		c = p.children()
 		self.assertEqual( len( c ), 8 )
 
+	def testChildrenReflectDirectoryChanges( self ) :
+
+		p = Gaffer.FileSystemPath( self.temporaryDirectory() )
+
+		with open( self.temporaryDirectory() + "/a", "w" ) as f :
+			f.write( "AAAA" )
+
+		self.assertEqual( [ str( c ) for c in p.children() ], [ self.temporaryDirectory() + "/a" ] )
+
+		with open( self.temporaryDirectory() + "/b", "w" ) as f :
+			f.write( "BBBB" )
+
+		self.assertEqual(
+			sorted( str( c ) for c in p.children() ),
+			[ self.temporaryDirectory() + "/a", self.temporaryDirectory() + "/b" ]
+		)
+
+		os.remove( self.temporaryDirectory() + "/a" )
+		self.assertEqual( [ str( c ) for c in p.children() ], [ self.temporaryDirectory() + "/b" ] )
+
+	def testChildValidityReflectsRemoval( self ) :
+
+		with open( self.temporaryDirectory() + "/a", "w" ) as f :
+			f.write( "AAAA" )
+
+		p = Gaffer.FileSystemPath( self.temporaryDirectory() )
+		c = p.children()
+		self.assertEqual( len( c ), 1 )
+		self.assertTrue( c[0].isValid() )
+
+		os.remove( self.temporaryDirectory() + "/a" )
+		self.assertFalse( c[0].isValid() )
+
+	def testChildPropertiesReflectRewrites( self ) :
+
+		with open( self.temporaryDirectory() + "/a", "w" ) as f :
+			f.write( "AAAA" )
+
+		p = Gaffer.FileSystemPath( self.temporaryDirectory() )
+		c = p.children()
+		self.assertEqual( len( c ), 1 )
+		self.assertEqual( c[0].property( "fileSystem:size" ), 4 )
+
+		with open( self.temporaryDirectory() + "/a", "w" ) as f :
+			f.write( "AAAAAAAA" )
+		os.utime( self.temporaryDirectory() + "/a", ( 1000000000, 1000000000 ) )
+
+		self.assertEqual( c[0].property( "fileSystem:size" ), 8 )
+		self.assertEqual(
+			c[0].property( "fileSystem:modificationTime" ),
+			datetime.datetime.utcfromtimestamp( 1000000000 )
+		)
+
+	@unittest.skipIf( os.geteuid() != 0, "Changing file ownership requires root" )
+	def testSequenceOwnerAndGroupAreMostCommon( self ) :
+
+		for i in range( 1, 4 ) :
+			with open( self.temporaryDirectory() + "/a.00{}.txt".format( i ), "w" ) as f :
+				f.write( "AAAA" )
+
+		# Give the last file a different owner and group. The
+		# properties should still reflect the other two.
+
+		st = os.stat( self.temporaryDirectory() + "/a.001.txt" )
+		os.chown( self.temporaryDirectory() + "/a.003.txt", st.st_uid + 1000, st.st_gid + 1000 )
+
+		p = Gaffer.FileSystemPath( self.temporaryDirectory() + "/a.###.txt", includeSequences = True )
+		self.assertEqual( p.property( "fileSystem:owner" ), pwd.getpwuid( st.st_uid ).pw_name )
+		self.assertEqual( p.property( "fileSystem:group" ), grp.getgrgid( st.st_gid ).gr_name )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testChildPropertiesPerformance( self ) :
+
+		for i in range( 0, 10000 ) :
+			with open( self.temporaryDirectory() + "/file{}.txt".format( i ), "w" ) as f :
+				f.write( "A" )
+
+		p = Gaffer.FileSystemPath( self.temporaryDirectory(), includeSequences = True )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for c in p.children() :
+				c.isLeaf()
+				c.property( "fileSystem:size" )
+				c.property( "fileSystem:modificationTime" )
+				c.property( "fileSystem:owner" )
+
 	def setUp( self ) :
 
 		GafferTest.TestCase.setUp( self )
@@ -992,6 +992,102 @@ class GraphComponentTest( GafferTest.TestCase ) :
 			c = s[n]
 			self.assertEqual( c.getName(), n )
 
+	def testGetChildWithManyChildren( self ) :
+
+		# Enough children for `getChild()` to use an index,
+		# which must be kept up to date as children are added,
+		# removed and renamed.
+
+		s = Gaffer.ScriptNode()
+		for i in range( 0, 200 ) :
+			s.addChild( Gaffer.Node( "n{}".format( i ) ) )
+
+		for i in range( 0, 200 ) :
+			self.assertEqual( s["n{}".format( i )].getName(), "n{}".format( i ) )
+		self.assertIsNone( s.getChild( "n200" ) )
+		self.assertEqual( s.descendant( "n100" ), s["n100"] )
+
+		# Adding a child with a clashing name.
+
+		n = Gaffer.Node( "n10" )
+		s.addChild( n )
+		self.assertEqual( n.getName(), "n200" )
+		self.assertTrue( s["n200"].isSame( n ) )
+		self.assertTrue( s["n10"].isSame( s.children( Gaffer.Node )[10] ) )
+
+		# Renaming.
+
+		with Gaffer.UndoScope( s ) :
+			s["n5"].setName( "renamed" )
+
+		self.assertIsNone( s.getChild( "n5" ) )
+		self.assertTrue( s["renamed"].isSame( s.children( Gaffer.Node )[5] ) )
+
+		self.assertEqual( s["n6"].setName( "renamed" ), "renamed1" )
+		self.assertTrue( s["renamed1"].isSame( s.children( Gaffer.Node )[6] ) )
+		self.assertTrue( s["renamed"].isSame( s.children( Gaffer.Node )[5] ) )
+
+		# Removing.
+
+		with Gaffer.UndoScope( s ) :
+			c = s["n20"]
+			s.removeChild( c )
+
+		self.assertIsNone( s.getChild( "n20" ) )
+		s.undo()
+		self.assertTrue( s["n20"].isSame( c ) )
+		s.undo() # Undo renaming of `n5`
+		self.assertIsNone( s.getChild( "renamed" ) )
+		self.assertTrue( s["n5"].isSame( s.children( Gaffer.Node )[5] ) )
+
+		# Reparenting.
+
+		s2 = Gaffer.ScriptNode()
+		s2.addChild( s["n30"] )
+		self.assertIsNone( s.getChild( "n30" ) )
+		self.assertTrue( isinstance( s2["n30"], Gaffer.Node ) )
+
+		# Removing enough children to drop below the threshold
+		# for indexing.
+
+		for c in list( s.children( Gaffer.Node ) )[10:] :
+			s.removeChild( c )
+
+		names = [ "n0", "n1", "n2", "n3", "n4", "n5", "renamed1", "n7", "n8", "n9" ]
+		self.assertEqual( [ c.getName() for c in s.children( Gaffer.Node ) ], names )
+		for name in names :
+			self.assertEqual( s[name].getName(), name )
+		self.assertIsNone( s.getChild( "n100" ) )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetChildWithManyChildrenPerformance( self ) :
+
+		s = Gaffer.ScriptNode()
+		for i in range( 0, 10000 ) :
+			s.addChild( GafferTest.AddNode( "AddNode" + str( i ) ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 10000 ) :
+				s["AddNode" + str( i )]
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testLoadManyChildren( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["b"] = Gaffer.Box()
+		for i in range( 0, 10000 ) :
+			s["b"].addChild( GafferTest.AddNode( "AddNode" + str( i ) ) )
+			if i :
+				s["b"]["AddNode" + str( i )]["op1"].setInput( s["b"]["AddNode" + str( i - 1 )]["sum"] )
+
+		serialisation = s.serialise()
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			s2 = Gaffer.ScriptNode()
+			s2.execute( serialisation )
+
+		self.assertEqual( len( s2["b"].children( Gaffer.Node ) ), 10000 )
+
 	def testNoneIsNotAGraphComponent( self ) :
 
 		g = Gaffer.GraphComponent()
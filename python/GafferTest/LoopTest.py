@@ -282,5 +282,79 @@ class LoopTest( GafferTest.TestCase ) :
 		for plug, value in valuesWhenDirtied.items() :
 			self.assertEqual( plugValue( plug ), value )
 
+	def testManyIterations( self ) :
+
+		loop = self.intLoop()
+		add = GafferTest.AddNode()
+
+		loop["in"].setValue( 0 )
+		loop["next"].setInput( add["sum"] )
+		add["op1"].setInput( loop["previous"] )
+		add["op2"].setValue( 1 )
+
+		# Enough iterations to exhaust the stack if
+		# they were evaluated recursively.
+		loop["iterations"].setValue( 20000 )
+		self.assertEqual( loop["out"].getValue(), 20000 )
+
+		loop["iterations"].setValue( 20001 )
+		self.assertEqual( loop["out"].getValue(), 20001 )
+
+	def testManyIterationsWithoutCache( self ) :
+
+		loop = self.intLoop()
+		add = GafferTest.AddNode()
+
+		loop["in"].setValue( 0 )
+		loop["next"].setInput( add["sum"] )
+		add["op1"].setInput( loop["previous"] )
+		add["op2"].setValue( 2 )
+		loop["iterations"].setValue( 5000 )
+
+		# Even if the results of previous iterations are evicted
+		# from the cache immediately, they are pinned for the
+		# duration of the next iteration, so evaluation doesn't
+		# need to recurse back through the whole loop.
+
+		cacheMemoryLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		try :
+			Gaffer.ValuePlug.setCacheMemoryLimit( 0 )
+			self.assertEqual( loop["out"].getValue(), 10000 )
+		finally :
+			Gaffer.ValuePlug.setCacheMemoryLimit( cacheMemoryLimit )
+
+	def testIterationProgressIsMonitored( self ) :
+
+		loop = self.intLoop()
+		add = GafferTest.AddNode()
+
+		loop["in"].setValue( 0 )
+		loop["next"].setInput( add["sum"] )
+		add["op1"].setInput( loop["previous"] )
+		add["op2"].setValue( 1 )
+		loop["iterations"].setValue( 100 )
+
+		with Gaffer.ContextMonitor( loop ) as monitor :
+			self.assertEqual( loop["out"].getValue(), 100 )
+
+		# Each of the preceding iterations is reported as a separate
+		# process on the `next` plug, in the context for that iteration.
+		self.assertEqual( monitor.plugStatistics( loop["next"] ).numUniqueValues( "loop:index" ), 99 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManyIterationsPerformance( self ) :
+
+		loop = self.intLoop()
+		add = GafferTest.AddNode()
+
+		loop["in"].setValue( 0 )
+		loop["next"].setInput( add["sum"] )
+		add["op1"].setInput( loop["previous"] )
+		add["op2"].setValue( 1 )
+		loop["iterations"].setValue( 100000 )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			self.assertEqual( loop["out"].getValue(), 100000 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -1213,5 +1213,49 @@ class MetadataTest( GafferTest.TestCase ) :
 		with six.assertRaisesRegex( self, Exception, r"did not match C\+\+ signature" ) :
 			Gaffer.Metadata.value( None, "test" )
 
+	def testDeregistrationAfterLookup( self ) :
+
+		derivedAdd = self.DerivedAddNode()
+
+		Gaffer.Metadata.registerValue( GafferTest.AddNode, "deregistrationTest", "Base class value" )
+		Gaffer.Metadata.registerValue( self.DerivedAddNode, "deregistrationTest", "Derived class value" )
+		Gaffer.Metadata.registerValue( GafferTest.AddNode, "op*", "deregistrationTest", "Base class wildcard value" )
+		Gaffer.Metadata.registerValue( self.DerivedAddNode, "op1", "deregistrationTest", "Derived class plug value" )
+
+		self.assertEqual( Gaffer.Metadata.value( derivedAdd, "deregistrationTest" ), "Derived class value" )
+		self.assertEqual( Gaffer.Metadata.value( derivedAdd["op1"], "deregistrationTest" ), "Derived class plug value" )
+		self.assertEqual( Gaffer.Metadata.value( derivedAdd["op2"], "deregistrationTest" ), "Base class wildcard value" )
+
+		Gaffer.Metadata.deregisterValue( self.DerivedAddNode, "deregistrationTest" )
+		Gaffer.Metadata.deregisterValue( self.DerivedAddNode, "op1", "deregistrationTest" )
+
+		self.assertEqual( Gaffer.Metadata.value( derivedAdd, "deregistrationTest" ), "Base class value" )
+		self.assertEqual( Gaffer.Metadata.value( derivedAdd["op1"], "deregistrationTest" ), "Base class wildcard value" )
+		self.assertEqual( Gaffer.Metadata.value( derivedAdd["op2"], "deregistrationTest" ), "Base class wildcard value" )
+
+		Gaffer.Metadata.deregisterValue( GafferTest.AddNode, "deregistrationTest" )
+		Gaffer.Metadata.deregisterValue( GafferTest.AddNode, "op*", "deregistrationTest" )
+
+		self.assertEqual( Gaffer.Metadata.value( derivedAdd, "deregistrationTest" ), None )
+		self.assertEqual( Gaffer.Metadata.value( derivedAdd["op1"], "deregistrationTest" ), None )
+		self.assertEqual( Gaffer.Metadata.value( derivedAdd["op2"], "deregistrationTest" ), None )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testValuePerformance( self ) :
+
+		s = Gaffer.Spreadsheet()
+		for i in range( 0, 20 ) :
+			s["rows"].addColumn( Gaffer.IntPlug( "c{}".format( i ) ) )
+		s["rows"].addRows( 200 )
+
+		keys = [
+			"description", "layout:section", "layout:index", "layout:visibilityActivator",
+			"plugValueWidget:type", "nodule:type", "noduleLayout:visible", "spreadsheet:columnWidth",
+		]
+
+		GafferTest.parallelMetadataValues( s, keys, 1 )
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferTest.parallelMetadataValues( s, keys, 100 )
+
 if __name__ == "__main__":
 	unittest.main()
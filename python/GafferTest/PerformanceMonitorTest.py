@@ -37,6 +37,7 @@
 import os
 import gc
 import time
+import threading
 import unittest
 
 import IECore
@@ -135,6 +136,83 @@ class PerformanceMonitorTest( GafferTest.TestCase ) :
 		self.assertEqual( s.hashDuration, 200 )
 		self.assertEqual( s.computeDuration, 300 )
 
+		s = Gaffer.PerformanceMonitor.Statistics( computeWaitCount = 5, computeWaitDuration = 500 )
+		self.assertEqual( s.computeWaitCount, 5 )
+		self.assertEqual( s.computeWaitDuration, 500 )
+
+		s.computeWaitCount = 6
+		s.computeWaitDuration = 600
+		self.assertEqual( s.computeWaitCount, 6 )
+		self.assertEqual( s.computeWaitDuration, 600 )
+
+		self.assertNotEqual( s, Gaffer.PerformanceMonitor.Statistics() )
+
+	class SlowNode( Gaffer.ComputeNode ) :
+
+		def __init__( self, name = "SlowNode" ) :
+
+			Gaffer.ComputeNode.__init__( self, name )
+
+			self["in"] = Gaffer.IntPlug()
+			self["out"] = Gaffer.IntPlug( direction = Gaffer.Plug.Direction.Out )
+
+			self.numComputes = 0
+
+		def affects( self, input ) :
+
+			outputs = Gaffer.ComputeNode.affects( self, input )
+			if input == self["in"] :
+				outputs.append( self["out"] )
+
+			return outputs
+
+		def hash( self, output, context, h ) :
+
+			if output == self["out"] :
+				self["in"].hash( h )
+
+		def compute( self, plug, context ) :
+
+			if plug == self["out"] :
+				self.numComputes += 1
+				time.sleep( 0.5 )
+				plug.setValue( self["in"].getValue() )
+			else :
+				Gaffer.ComputeNode.compute( self, plug, context )
+
+	IECore.registerRunTimeTyped( SlowNode )
+
+	def testConcurrentLegacyComputesAreShared( self ) :
+
+		n = self.SlowNode()
+		n["in"].setValue( 10 )
+
+		m = Gaffer.PerformanceMonitor()
+		results = []
+
+		def getValue() :
+
+			with m :
+				results.append( n["out"].getValue() )
+
+		threads = [ threading.Thread( target = getValue ) for i in range( 0, 8 ) ]
+		for t in threads :
+			t.start()
+		for t in threads :
+			t.join()
+
+		# All threads get the result, but only one of them does the work.
+		# The others either wait for it, or find it in the cache.
+
+		self.assertEqual( results, [ 10 ] * 8 )
+		self.assertEqual( n.numComputes, 1 )
+
+		s = m.plugStatistics( n["out"] )
+		self.assertEqual( s.computeCount, 1 )
+		self.assertGreater( s.computeWaitCount, 0 )
+		self.assertLessEqual( s.computeWaitCount, 7 )
+		self.assertGreater( s.computeWaitDuration, 0 )
+
 	def testEnterReturnValue( self ) :
 
 		m = Gaffer.PerformanceMonitor()
@@ -76,6 +76,27 @@ class ReferenceTest( GafferTest.TestCase ) :
 		self.assertTrue( "n1" in s["r"] )
 		self.assertTrue( s["r"]["sum"].getInput().isSame( s["r"]["n1"]["sum"] ) )
 
+	def testLoadLegacyImathTypes( self ) :
+
+		# References exported before version 0.42 used the `IECore` bindings
+		# for Imath types. These must still load now that reference files are
+		# compiled before execution.
+
+		with open( os.path.join( self.temporaryDirectory(), "legacy.grf" ), "w" ) as f :
+			f.write( """import Gaffer
+import IECore
+
+parent.addChild( Gaffer.V3fPlug( "p", defaultValue = IECore.V3f( 1, 2, 3 ), flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic, ) )
+parent["p"].setValue( IECore.V3f( 4, 5, 6 ) )
+""" )
+
+		s = Gaffer.ScriptNode()
+		s["r"] = Gaffer.Reference()
+		s["r"].load( os.path.join( self.temporaryDirectory(), "legacy.grf" ) )
+
+		self.assertEqual( s["r"]["p"].defaultValue(), imath.V3f( 1, 2, 3 ) )
+		self.assertEqual( s["r"]["p"].getValue(), imath.V3f( 4, 5, 6 ) )
+
 	def testSerialisation( self ) :
 
 		s = Gaffer.ScriptNode()
@@ -1692,6 +1713,64 @@ class ReferenceTest( GafferTest.TestCase ) :
 		script2.execute( script.serialise() )
 		assertExpectedChildren( script2["reference"] )
 
+	def testManyReferencesToSameFile( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["b"] = Gaffer.Box()
+		s["b"]["n"] = GafferTest.AddNode()
+		s["b"]["n"]["op1"].setValue( 1 )
+		Gaffer.PlugAlgo.promote( s["b"]["n"]["op2"] )
+		Gaffer.PlugAlgo.promoteWithName( s["b"]["n"]["sum"], "sum" )
+
+		fileName = os.path.join( self.temporaryDirectory(), "test.grf" )
+		s["b"].exportForReference( fileName )
+
+		s2 = Gaffer.ScriptNode()
+		for i in range( 0, 20 ) :
+			r = Gaffer.Reference( "r{}".format( i ) )
+			s2.addChild( r )
+			r.load( fileName )
+			r["op2"].setValue( i )
+
+		for i in range( 0, 20 ) :
+			self.assertEqual( s2["r{}".format( i )]["sum"].getValue(), i + 1 )
+
+		# Edits to the file must be picked up by subsequent loads,
+		# even though the previous contents were shared.
+
+		s["b"]["n"]["op1"].setValue( 100 )
+		s["b"].exportForReference( fileName )
+
+		s2["r0"].load( fileName )
+		self.assertEqual( s2["r0"]["sum"].getValue(), 100 )
+		self.assertEqual( s2["r1"]["sum"].getValue(), 2 )
+
+		s2["r20"] = Gaffer.Reference()
+		s2["r20"].load( fileName )
+		self.assertEqual( s2["r20"]["sum"].getValue(), 100 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManyReferencesToSameFilePerformance( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["b"] = Gaffer.Box()
+		for i in range( 0, 100 ) :
+			s["b"]["n{}".format( i )] = GafferTest.AddNode()
+			if i :
+				s["b"]["n{}".format( i )]["op1"].setInput( s["b"]["n{}".format( i - 1 )]["sum"] )
+		Gaffer.PlugAlgo.promote( s["b"]["n0"]["op1"] )
+
+		fileName = os.path.join( self.temporaryDirectory(), "test.grf" )
+		s["b"].exportForReference( fileName )
+
+		s2 = Gaffer.ScriptNode()
+		for i in range( 0, 200 ) :
+			s2["r{}".format( i )] = Gaffer.Reference()
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 200 ) :
+				s2["r{}".format( i )].load( fileName )
+
 	def tearDown( self ) :
 
 		GafferTest.TestCase.tearDown( self )
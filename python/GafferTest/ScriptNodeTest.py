@@ -1580,5 +1580,94 @@ class ScriptNodeTest( GafferTest.TestCase ) :
 		p["name"].setValue( "" )
 		self.assertNotIn( "testTwo", s.context() )
 
+	def testBinarySerialisation( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n1"] = GafferTest.AddNode()
+		s["n1"]["op1"].setValue( 10 )
+		s["n2"] = GafferTest.AddNode()
+		s["n2"]["op1"].setInput( s["n1"]["sum"] )
+		s["n2"]["op2"].setValue( 2 )
+		s["n2"]["user"]["p"] = Gaffer.V3fPlug( defaultValue = imath.V3f( 1, 2, 3 ), flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		Gaffer.Metadata.registerValue( s["n2"], "description", "binary" )
+
+		fileName = os.path.join( self.temporaryDirectory(), "test.gfrb" )
+		s["fileName"].setValue( fileName )
+		s.save()
+
+		with open( fileName, "rb" ) as f :
+			self.assertTrue( f.read().startswith( b"GAFFERB\n" ) )
+
+		def assertLoaded( script ) :
+
+			self.assertEqual( script["n1"]["op1"].getValue(), 10 )
+			self.assertTrue( script["n2"]["op1"].getInput().isSame( script["n1"]["sum"] ) )
+			self.assertEqual( script["n2"]["sum"].getValue(), 12 )
+			self.assertEqual( script["n2"]["user"]["p"].getValue(), imath.V3f( 1, 2, 3 ) )
+			self.assertEqual( Gaffer.Metadata.value( script["n2"], "description" ), "binary" )
+
+		s2 = Gaffer.ScriptNode()
+		s2["fileName"].setValue( fileName )
+		self.assertFalse( s2.load() )
+		assertLoaded( s2 )
+
+		s3 = Gaffer.ScriptNode()
+		s3["fileName"].setValue( fileName )
+		self.assertFalse( s3.load( continueOnError = True ) )
+		assertLoaded( s3 )
+
+		s4 = Gaffer.ScriptNode()
+		s4.executeFile( fileName )
+		assertLoaded( s4 )
+
+		s5 = Gaffer.ScriptNode()
+		s5.importFile( fileName )
+		assertLoaded( s5 )
+
+		# Text and binary serialisations should load identically.
+
+		textFileName = os.path.join( self.temporaryDirectory(), "test.gfr" )
+		s.serialiseToFile( textFileName )
+		s6 = Gaffer.ScriptNode()
+		s6.executeFile( textFileName )
+		self.assertEqual( s6.serialise(), s2.serialise() )
+
+	def __writeLoadPerformanceScript( self, fileName ) :
+
+		s = Gaffer.ScriptNode()
+		s["b"] = Gaffer.Box()
+		previous = None
+		for i in range( 0, 10000 ) :
+			n = GafferTest.AddNode()
+			n["op2"].setValue( i )
+			if previous is not None :
+				n["op1"].setInput( previous["sum"] )
+			s["b"].addChild( n )
+			previous = n
+
+		s.serialiseToFile( fileName )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testTextLoadPerformance( self ) :
+
+		fileName = os.path.join( self.temporaryDirectory(), "test.gfr" )
+		self.__writeLoadPerformanceScript( fileName )
+
+		s = Gaffer.ScriptNode()
+		s["fileName"].setValue( fileName )
+		with GafferTest.TestRunner.PerformanceScope() :
+			s.load()
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testBinaryLoadPerformance( self ) :
+
+		fileName = os.path.join( self.temporaryDirectory(), "test.gfrb" )
+		self.__writeLoadPerformanceScript( fileName )
+
+		s = Gaffer.ScriptNode()
+		s["fileName"].setValue( fileName )
+		with GafferTest.TestRunner.PerformanceScope() :
+			s.load()
+
 if __name__ == "__main__":
 	unittest.main()
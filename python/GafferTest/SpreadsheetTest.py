@@ -620,6 +620,42 @@ class SpreadsheetTest( GafferTest.TestCase ) :
 		row2["name"].setValue( "ca*" )
 		self.assertEqual( s["out"]["v"].getValue(), 2 )
 
+	def testManyWildcards( self ) :
+
+		s = Gaffer.Spreadsheet()
+		s["rows"].addColumn( Gaffer.IntPlug( "v" ) )
+
+		names = [
+			"cat", "ca*", "*t", "c?t", "[bc]at", "[!c]at", "d*g c*w", "*", "c\\*t", "*a*", "mo?se",
+			"cow dog", "c[a-o]w", "a*b*c", "c* ", "[ab-]x", "d\\ g", "cat", "**", "h?rse*",
+		]
+		for i, name in enumerate( names ) :
+			row = s["rows"].addRow()
+			row["name"].setValue( name )
+			row["cells"]["v"]["value"].setValue( i + 1 )
+
+		s["rows"][5]["enabled"].setValue( False )
+
+		def expectedValue( selector ) :
+			for i, name in enumerate( names ) :
+				if s["rows"][i+1]["enabled"].getValue() and IECore.StringAlgo.matchMultiple( selector, name ) :
+					return i + 1
+			return 0
+
+		for selector in [
+			"cat", "bat", "hat", "cot", "cow", "dog", "dig", "c*t", "mouse", "horses",
+			"abc", "axbxc", "", "x", "-x", "bx", "d g", "caat", "c t",
+		] :
+			s["selector"].setValue( selector )
+			self.assertEqual( s["out"]["v"].getValue(), expectedValue( selector ), selector )
+
+		# Disable the catch-all `*` row, so that later rows get a chance
+		# to match.
+		s["rows"][8]["enabled"].setValue( False )
+		for selector in [ "abc", "axbxc", "", "x", "horses", "caat" ] :
+			s["selector"].setValue( selector )
+			self.assertEqual( s["out"]["v"].getValue(), expectedValue( selector ), selector )
+
 	def testSelectorVariablesRemovedFromRowNameContext( self ) :
 
 		s = Gaffer.ScriptNode()
@@ -944,6 +980,50 @@ class SpreadsheetTest( GafferTest.TestCase ) :
 					c["index"] = i
 					self.assertEqual( out.getValue(), i )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testWildcardRowIndexPerformance( self ) :
+
+		s = Gaffer.Spreadsheet()
+		s["selector"].setValue( "${name}" )
+
+		numRows = 1000
+
+		s["rows"].addColumn( Gaffer.IntPlug( "v" ) )
+		for i in range( 0, numRows ) :
+			row = s["rows"].addRow()
+			row["name"].setValue( "prefix{0}_*_suffix{0}".format( i ) )
+			row["cells"]["v"]["value"].setValue( i )
+
+		c = Gaffer.Context()
+		out = s["out"]["v"]
+		with c :
+			with GafferTest.TestRunner.PerformanceScope() :
+				for i in range( 0, numRows ) :
+					c["name"] = "prefix{0}_middle_suffix{0}".format( i )
+					self.assertEqual( out.getValue(), i )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testWildcardPathRowIndexPerformance( self ) :
+
+		s = Gaffer.Spreadsheet()
+		s["selector"].setValue( "${scene:path}" )
+
+		numRows = 1000
+
+		s["rows"].addColumn( Gaffer.IntPlug( "v" ) )
+		for i in range( 0, numRows ) :
+			row = s["rows"].addRow()
+			row["name"].setValue( "/world/.../asset{0}/*Geo".format( i ) )
+			row["cells"]["v"]["value"].setValue( i )
+
+		c = Gaffer.Context()
+		out = s["out"]["v"]
+		with c :
+			with GafferTest.TestRunner.PerformanceScope() :
+				for i in range( 0, numRows ) :
+					c["scene:path"] = IECore.InternedStringVectorData( [ "world", "group", "asset{0}".format( i ), "bodyGeo" ] )
+					self.assertEqual( out.getValue(), i )
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testRowAccessorPerformance( self ) :
 
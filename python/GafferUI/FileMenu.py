@@ -247,7 +247,7 @@ def saveAs( menu ) :
 		return
 
 	path = str( path )
-	if not path.endswith( ".gfr" ) :
+	if not path.endswith( ( ".gfr", ".gfrb" ) ) :
 		path += ".gfr"
 
 	script["fileName"].setValue( path )
@@ -312,7 +312,7 @@ def exportSelection( menu ) :
 		return
 
 	path = str( path )
-	if not path.endswith( ".gfr" ) :
+	if not path.endswith( ( ".gfr", ".gfrb" ) ) :
 		path += ".gfr"
 
 	script.serialiseToFile( path, parent, script.selection() )
@@ -400,6 +400,6 @@ def __pathAndBookmarks( scriptWindow ) :
 	else :
 		path = Gaffer.FileSystemPath( bookmarks.getDefault( scriptWindow ) )
 
-	path.setFilter( Gaffer.FileSystemPath.createStandardFilter( [ "gfr" ] ) )
+	path.setFilter( Gaffer.FileSystemPath.createStandardFilter( [ "gfr", "gfrb" ] ) )
 
 	return path, bookmarks
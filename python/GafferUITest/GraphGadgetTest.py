@@ -1406,5 +1406,67 @@ class GraphGadgetTest( GafferUITest.TestCase ) :
 		Gaffer.Metadata.registerValue( s["b"]["n"], "nodeGadget:type", "GafferUI::AuxiliaryNodeGadget" )
 		self.assertIsNone( g.nodeGadget( s["b"]["n"] ) )
 
+	def testGadgetsInRegion( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n1"] = GafferTest.AddNode()
+		s["n2"] = GafferTest.AddNode()
+		s["n2"]["op1"].setInput( s["n1"]["sum"] )
+
+		g = GafferUI.GraphGadget( s )
+		g.setNodePosition( s["n1"], imath.V2f( 0 ) )
+		g.setNodePosition( s["n2"], imath.V2f( 0, -20 ) )
+
+		def nodesInRegion( region ) :
+			return { n.node() for n in g.nodeGadgetsInRegion( region ) }
+
+		everywhere = imath.Box2f( imath.V2f( -1000 ), imath.V2f( 1000 ) )
+		self.assertEqual( nodesInRegion( everywhere ), { s["n1"], s["n2"] } )
+		self.assertEqual( nodesInRegion( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ) ), { s["n1"] } )
+		self.assertEqual( nodesInRegion( imath.Box2f( imath.V2f( -1, -21 ), imath.V2f( 1, -19 ) ) ), { s["n2"] } )
+		self.assertEqual( nodesInRegion( imath.Box2f( imath.V2f( 500 ), imath.V2f( 600 ) ) ), set() )
+
+		self.assertEqual( g.connectionGadgetsInRegion( everywhere ), [ g.connectionGadget( s["n2"]["op1"] ) ] )
+		self.assertEqual( g.connectionGadgetsInRegion( imath.Box2f( imath.V2f( 500 ), imath.V2f( 600 ) ) ), [] )
+
+		# Index must be updated when nodes move.
+
+		g.setNodePosition( s["n2"], imath.V2f( 550 ) )
+		self.assertEqual( nodesInRegion( imath.Box2f( imath.V2f( 500 ), imath.V2f( 600 ) ) ), { s["n2"] } )
+		self.assertEqual( nodesInRegion( imath.Box2f( imath.V2f( -1, -21 ), imath.V2f( 1, -19 ) ) ), set() )
+		self.assertEqual(
+			g.connectionGadgetsInRegion( imath.Box2f( imath.V2f( 500 ), imath.V2f( 600 ) ) ),
+			[ g.connectionGadget( s["n2"]["op1"] ) ]
+		)
+
+		# And when they are added and removed.
+
+		s["n3"] = GafferTest.AddNode()
+		g.setNodePosition( s["n3"], imath.V2f( -300 ) )
+		self.assertEqual( nodesInRegion( imath.Box2f( imath.V2f( -310 ), imath.V2f( -290 ) ) ), { s["n3"] } )
+
+		del s["n1"]
+		self.assertEqual( nodesInRegion( everywhere ), { s["n2"], s["n3"] } )
+		self.assertEqual( g.connectionGadgetsInRegion( everywhere ), [] )
+
+		# And when they are hidden by the filter.
+
+		g.setFilter( Gaffer.StandardSet( [ s["n3"] ] ) )
+		self.assertEqual( nodesInRegion( everywhere ), { s["n3"] } )
+
+	def testNodeGadgetAtEmptySpace( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = GafferTest.AddNode()
+
+		g = GafferUI.GraphGadget( s )
+		g.setNodePosition( s["n"], imath.V2f( 0 ) )
+
+		# No GL selection is needed to determine that there
+		# is nothing at a position far from any node.
+		line = IECore.LineSegment3f( imath.V3f( 500, 500, 1 ), imath.V3f( 500, 500, 0 ) )
+		self.assertIsNone( g.nodeGadgetAt( line ) )
+		self.assertIsNone( g.connectionGadgetAt( line ) )
+
 if __name__ == "__main__":
 	unittest.main()
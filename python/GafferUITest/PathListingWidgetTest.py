@@ -35,6 +35,7 @@
 #
 ##########################################################################
 
+import time
 import unittest
 
 import IECore
@@ -45,6 +46,8 @@ import GafferTest
 import GafferUI
 import GafferUITest
 
+from Qt import QtCore
+
 class PathListingWidgetTest( GafferUITest.TestCase ) :
 
 	def testExpandedPaths( self ) :
@@ -317,5 +320,46 @@ class PathListingWidgetTest( GafferUITest.TestCase ) :
 		self.assertEqual( len( s ), 1 )
 		self.assertEqual( str( s[0] ), "/a" )
 
+	def testChildrenListedInBackground( self ) :
+
+		d = { str( i ) : i for i in range( 0, 1000 ) }
+		p = Gaffer.DictPath( d, "/" )
+
+		w = GafferUI.PathListingWidget( p, displayMode = GafferUI.PathListingWidget.DisplayMode.Tree )
+		model = w._qtWidget().model()
+
+		# Children are listed and sorted by name in the background,
+		# and only become visible to Qt once complete.
+
+		self.__waitFor( lambda : model.rowCount() == 1000 )
+		self.assertEqual(
+			[ model.data( model.index( i, 0 ) ) for i in range( 0, 1000 ) ],
+			sorted( d.keys() )
+		)
+
+		# Resorting also happens in the background.
+
+		model.sort( 0, QtCore.Qt.DescendingOrder )
+		self.__waitFor( lambda : model.data( model.index( 0, 0 ) ) == "999" )
+		self.assertEqual(
+			[ model.data( model.index( i, 0 ) ) for i in range( 0, 1000 ) ],
+			sorted( d.keys(), reverse = True )
+		)
+
+		# But methods which find items by path list
+		# children synchronously.
+
+		d = { "a" : { "b" : { "c" : 10 } } }
+		w.setPath( Gaffer.DictPath( d, "/" ) )
+		w.setPathExpanded( Gaffer.DictPath( d, "/a/b" ), True )
+		self.assertTrue( w.getPathExpanded( Gaffer.DictPath( d, "/a/b" ) ) )
+
+	def __waitFor( self, condition, timeout = 10 ) :
+
+		startTime = time.time()
+		while not condition() :
+			self.assertLess( time.time() - startTime, timeout )
+			self.waitForIdle()
+
 if __name__ == "__main__":
 	unittest.main()
@@ -105,5 +105,38 @@ class StandardStyleTest( GafferUITest.TestCase ) :
 		s.setFont( GafferUI.Style.TextType.LabelText, f )
 		self.assertEqual( len( cs ), 3 )
 
+	def testTextBound( self ) :
+
+		s = GafferUI.StandardStyle()
+		t = GafferUI.Style.TextType.LabelText
+
+		b = s.textBound( t, "iiii" )
+		self.assertFalse( b.isEmpty() )
+		self.assertEqual( s.textBound( t, "iiii" ), b )
+		self.assertGreater( s.textBound( t, "iiiiiiii" ).size().x, b.size().x )
+
+		# Cached layouts must be discarded when the font changes.
+
+		s.setFontScale( t, 2 )
+		self.assertEqual( s.getFontScale( t ), 2 )
+		self.assertEqual( s.textBound( t, "iiii" ), imath.Box3f( b.min() * 2, b.max() * 2 ) )
+
+		s.setFontScale( t, 1 )
+		self.assertEqual( s.textBound( t, "iiii" ), b )
+
+		s.setFont( t, IECoreGL.FontLoader.defaultFontLoader().load( "VeraMono.ttf" ) )
+		self.assertNotEqual( s.textBound( t, "iiii" ), b )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testTextBoundPerformance( self ) :
+
+		s = GafferUI.StandardStyle()
+		labels = [ "node{}".format( i ) for i in range( 0, 1000 ) ]
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 100 ) :
+				for l in labels :
+					s.textBound( GafferUI.Style.TextType.LabelText, l )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -38,11 +38,20 @@
 
 #include "Gaffer/Action.h"
 #include "Gaffer/Context.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
 
 #include "OpenEXR/ImathFun.h"
 
 #include "boost/bind.hpp"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -83,7 +92,7 @@ void Animation::Key::setTime( float time )
 						key->m_time = time;
 					}
 				);
-				curve->propagateDirtiness( curve->outPlug() );
+				curve->keysChanged();
 			},
 			// Undo
 			[ curve, previousTime, time ] {
@@ -93,7 +102,7 @@ void Animation::Key::setTime( float time )
 						key->m_time = previousTime;
 					}
 				);
-				curve->propagateDirtiness( curve->outPlug() );
+				curve->keysChanged();
 			}
 		);
 	}
@@ -119,12 +128,12 @@ void Animation::Key::setValue( float value )
 			// Do
 			[ k, value ] {
 				k->m_value = value;
-				k->m_parent->propagateDirtiness( k->m_parent->outPlug() );
+				k->m_parent->keysChanged();
 			},
 			// Undo
 			[ k, previousValue ] {
 				k->m_value = previousValue;
-				k->m_parent->propagateDirtiness( k->m_parent->outPlug() );
+				k->m_parent->keysChanged();
 			}
 		);
 	}
@@ -149,13 +158,13 @@ void Animation::Key::setType( Type type )
 			m_parent,
 			// Do
 			[ k, type ] {
-				k->m_value = type;
-				k->m_parent->propagateDirtiness( k->m_parent->outPlug() );
+				k->m_type = type;
+				k->m_parent->keysChanged();
 			},
 			// Undo
 			[ k, previousType ] {
 				k->m_type = previousType;
-				k->m_parent->propagateDirtiness( k->m_parent->outPlug() );
+				k->m_parent->keysChanged();
 			}
 		);
 	}
@@ -222,13 +231,13 @@ void Animation::CurvePlug::addKey( const KeyPtr &key )
 		[this, key] {
 			m_keys.insert( key );
 			key->m_parent = this;
-			propagateDirtiness( outPlug() );
+			keysChanged();
 		},
 		// Undo
 		[this, key] {
 			m_keys.erase( key->getTime() );
 			key->m_parent = nullptr;
-			propagateDirtiness( outPlug() );
+			keysChanged();
 		}
 	);
 }
@@ -271,13 +280,13 @@ void Animation::CurvePlug::removeKey( const KeyPtr &key )
 		[ this, key ] {
 			m_keys.erase( key->getTime() );
 			key->m_parent = nullptr;
-			propagateDirtiness( outPlug() );
+			keysChanged();
 		},
 		// Undo
 		[ this, key ] {
 			m_keys.insert( key );
 			key->m_parent = this;
-			propagateDirtiness( outPlug() );
+			keysChanged();
 		}
 	);
 }
@@ -423,6 +432,215 @@ const FloatPlug *Animation::CurvePlug::outPlug() const
 	return getChild<FloatPlug>( 0 );
 }
 
+void Animation::CurvePlug::parentChanging( Gaffer::GraphComponent *newParent )
+{
+	ValuePlug::parentChanging( newParent );
+
+	// Our old and new Animation nodes must recompile
+	// their curves to account for us.
+	if( Animation *animation = IECore::runTimeCast<Animation>( node() ) )
+	{
+		animation->invalidateCompiledCurves();
+	}
+
+	if( newParent )
+	{
+		Animation *animation = IECore::runTimeCast<Animation>( newParent );
+		if( !animation )
+		{
+			animation = newParent->ancestor<Animation>();
+		}
+		if( animation )
+		{
+			animation->invalidateCompiledCurves();
+		}
+	}
+}
+
+void Animation::CurvePlug::keysChanged()
+{
+	if( Animation *animation = IECore::runTimeCast<Animation>( node() ) )
+	{
+		animation->invalidateCompiledCurves();
+	}
+	propagateDirtiness( outPlug() );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// CompiledCurves implementation
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// When scrubbing a heavily animated rig, every curve is evaluated
+// for the same frame. For nodes with many curves, we evaluate all
+// the curves in one parallel batch the first time any one of them
+// is requested, and cache the values together. Nodes with only a few
+// curves are evaluated one curve at a time.
+const size_t g_minCurvesForBatching = 64;
+// Measured in curve values.
+const size_t g_batchCacheSize = 10000000;
+
+typedef std::vector<float> CurveValues;
+typedef std::shared_ptr<const CurveValues> ConstCurveValuesPtr;
+
+} // namespace
+
+struct Animation::CompiledCurves
+{
+
+	CompiledCurves( const Plug *curvesPlug )
+	{
+		offsets.push_back( 0 );
+		for( const auto &child : curvesPlug->children() )
+		{
+			const CurvePlug *curve = IECore::runTimeCast<const CurvePlug>( child.get() );
+			if( !curve )
+			{
+				continue;
+			}
+			indices[curve] = offsets.size() - 1;
+			for( const auto &key : *curve )
+			{
+				times.push_back( key.getTime() );
+				values.push_back( key.getValue() );
+				types.push_back( key.getType() );
+			}
+			offsets.push_back( times.size() );
+		}
+
+		for( auto offset : offsets )
+		{
+			hash.append( (uint64_t)offset );
+		}
+		hash.append( times.data(), times.size() );
+		hash.append( values.data(), values.size() );
+		for( auto type : types )
+		{
+			hash.append( (int)type );
+		}
+	}
+
+	size_t numCurves() const
+	{
+		return offsets.size() - 1;
+	}
+
+	// Equivalent to `CurvePlug::evaluate()` for the curve
+	// with the specified index.
+	float evaluate( size_t curveIndex, float time ) const
+	{
+		const size_t begin = offsets[curveIndex];
+		const size_t end = offsets[curveIndex+1];
+		if( begin == end )
+		{
+			return 0;
+		}
+
+		const size_t right = std::lower_bound( times.data() + begin, times.data() + end, time ) - times.data();
+		if( right == end )
+		{
+			return values[end-1];
+		}
+
+		if( times[right] == time || right == begin )
+		{
+			return values[right];
+		}
+
+		const size_t left = right - 1;
+		if( types[right] == Linear )
+		{
+			const float t = ( time - times[left] ) / ( times[right] - times[left] );
+			return Imath::lerp( values[left], values[right], t );
+		}
+		else
+		{
+			return values[left];
+		}
+	}
+
+	// As above, but evaluating and caching all curves at once
+	// when there are many of them.
+	float evaluateBatched( size_t curveIndex, float time ) const
+	{
+		if( numCurves() < g_minCurvesForBatching )
+		{
+			return evaluate( curveIndex, time );
+		}
+
+		ConstCurveValuesPtr batch = batchCache().get( BatchKey( this, time ) );
+		return (*batch)[curveIndex];
+	}
+
+	// Keys for all curves, stored in order of curve and then time.
+	// Keys for curve `i` are in the range `[ offsets[i], offsets[i+1] )`.
+	std::vector<float> times;
+	std::vector<float> values;
+	std::vector<Type> types;
+	std::vector<size_t> offsets;
+
+	std::unordered_map<const CurvePlug *, size_t> indices;
+	// Hash of all the key data. Identical hashes guarantee
+	// identical results from `evaluate()`, so batches can be
+	// cached by hash and shared between nodes.
+	IECore::MurmurHash hash;
+
+	private :
+
+		struct BatchKey
+		{
+
+			BatchKey( const CompiledCurves *curves, float time )
+				:	curves( curves ), time( time ), hash( curves->hash )
+			{
+				hash.append( time );
+			}
+
+			operator const IECore::MurmurHash & () const
+			{
+				return hash;
+			}
+
+			const CompiledCurves *curves;
+			float time;
+			IECore::MurmurHash hash;
+
+		};
+
+		typedef IECorePreview::LRUCache<IECore::MurmurHash, ConstCurveValuesPtr, IECorePreview::LRUCachePolicy::Parallel, BatchKey> BatchCache;
+
+		static BatchCache &batchCache()
+		{
+			static BatchCache g_cache( evaluateBatch, g_batchCacheSize );
+			return g_cache;
+		}
+
+		static ConstCurveValuesPtr evaluateBatch( const BatchKey &key, size_t &cost )
+		{
+			auto result = std::make_shared<CurveValues>( key.curves->numCurves() );
+			// Isolated so that we can't steal outer tasks that
+			// might be waiting on this cache entry.
+			tbb::this_task_arena::isolate(
+				[&key, &result] {
+					tbb::parallel_for(
+						tbb::blocked_range<size_t>( 0, result->size() ),
+						[&key, &result] ( const tbb::blocked_range<size_t> &r ) {
+							for( size_t i = r.begin(); i != r.end(); ++i )
+							{
+								(*result)[i] = key.curves->evaluate( i, key.time );
+							}
+						}
+					);
+				}
+			);
+			cost = result->size();
+			return result;
+		}
+
+};
+
 //////////////////////////////////////////////////////////////////////////
 // Animation implementation
 //////////////////////////////////////////////////////////////////////////
@@ -432,7 +650,7 @@ GAFFER_NODE_DEFINE_TYPE( Animation );
 size_t Animation::g_firstPlugIndex = 0;
 
 Animation::Animation( const std::string &name )
-	:	ComputeNode( name )
+	:	ComputeNode( name ), m_compiledCurves( nullptr )
 {
 	storeIndexOfNextChild( g_firstPlugIndex );
 
@@ -441,6 +659,7 @@ Animation::Animation( const std::string &name )
 
 Animation::~Animation()
 {
+	delete m_compiledCurves.load();
 }
 
 Plug *Animation::curvesPlug()
@@ -570,6 +789,48 @@ const Animation::CurvePlug *Animation::inputCurve( const ValuePlug *plug )
 	return inputCurve( const_cast<ValuePlug *>( plug ) );
 }
 
+const Animation::CompiledCurves *Animation::compiledCurves() const
+{
+	const CompiledCurves *result = m_compiledCurves.load( std::memory_order_acquire );
+	if( result )
+	{
+		return result;
+	}
+
+	// Several threads may compile concurrently, in which case
+	// only the first to finish publishes its result.
+	const CompiledCurves *compiled = new CompiledCurves( curvesPlug() );
+	if( m_compiledCurves.compare_exchange_strong( result, compiled, std::memory_order_acq_rel ) )
+	{
+		return compiled;
+	}
+	delete compiled;
+	return result;
+}
+
+void Animation::invalidateCompiledCurves()
+{
+	// Curves are edited on the UI thread, and edits cancel
+	// any computes that depend on them, so no other thread
+	// can be using the compiled curves. This is the same
+	// assumption that allows `CurvePlug::m_keys` to be
+	// edited without locking.
+	delete m_compiledCurves.exchange( nullptr );
+}
+
+float Animation::evaluate( const CurvePlug *curve, float time ) const
+{
+	const CompiledCurves *compiled = compiledCurves();
+	auto it = compiled->indices.find( curve );
+	if( it == compiled->indices.end() )
+	{
+		// Not one of our curves.
+		return curve->evaluate( time );
+	}
+
+	return compiled->evaluateBatched( it->second, time );
+}
+
 void Animation::affects( const Plug *input, AffectedPlugsContainer &outputs ) const
 {
 	ComputeNode::affects( input, outputs );
@@ -581,7 +842,7 @@ void Animation::hash( const ValuePlug *output, const Context *context, IECore::M
 
 	if( const CurvePlug *parent = output->parent<CurvePlug>() )
 	{
-		h.append( parent->evaluate( context->getTime() ) );
+		h.append( evaluate( parent, context->getTime() ) );
 	}
 }
 
@@ -589,7 +850,7 @@ void Animation::compute( ValuePlug *output, const Context *context ) const
 {
 	if( const CurvePlug *parent = output->parent<CurvePlug>() )
 	{
-		static_cast<FloatPlug *>( output )->setValue( parent->evaluate( context->getTime() ) );
+		static_cast<FloatPlug *>( output )->setValue( evaluate( parent, context->getTime() ) );
 		return;
 	}
 
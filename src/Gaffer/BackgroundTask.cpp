@@ -47,6 +47,12 @@
 #include "boost/multi_index_container.hpp"
 
 #include "tbb/task.h"
+#include "tbb/task_arena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <unordered_set>
 
 using namespace IECore;
 using namespace Gaffer;
@@ -142,55 +148,195 @@ ActiveTasks &activeTasks()
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
-// BackgroundTask
+// TaskData
 //////////////////////////////////////////////////////////////////////////
 
 struct BackgroundTask::TaskData : public boost::noncopyable
 {
-	TaskData( Function *function )
-		:	function( function ), status( Pending )
+	TaskData( Function *function, Priority priority )
+		:	function( function ), priority( priority ), canceller( new IECore::Canceller ),
+			cancelRequested( false ), preempted( false ), status( Pending )
 	{
 	}
 
 	Function *function;
-	IECore::Canceller canceller;
-	std::mutex mutex; // Protects `conditionVariable` and `status`
+	const Priority priority;
+	// Replaced when a preempted task is requeued, because
+	// a Canceller can't be reset.
+	std::unique_ptr<IECore::Canceller> canceller;
+	std::mutex mutex; // Protects `canceller`, `cancelRequested`, `conditionVariable` and `status`
+	bool cancelRequested;
+	std::atomic_bool preempted;
 	std::condition_variable conditionVariable;
 	Status status;
 };
 
-BackgroundTask::BackgroundTask( const Plug *subject, const Function &function )
-	:	m_function( function ), m_taskData( std::make_shared<TaskData>( &m_function ) )
+//////////////////////////////////////////////////////////////////////////
+// Scheduler
+//////////////////////////////////////////////////////////////////////////
+
+// Rather than enqueue each task with TBB directly, we hold pending tasks
+// in our own queues, one per priority. For each pending task we enqueue a
+// generic TBB task, which runs the most urgent pending task when a worker
+// becomes available. Speculative tasks run in a dedicated arena so that
+// they can't occupy the whole thread pool.
+class BackgroundTask::Scheduler : public boost::noncopyable
 {
-	activeTasks().insert( ActiveTask{ this, scriptNode( subject ) } );
 
-	auto taskData = m_taskData;
-	tbb::task *functionTask = new( tbb::task::allocate_root() ) FunctionTask(
-		[taskData] {
+	public :
+
+		static Scheduler &instance()
+		{
+			static Scheduler *g_scheduler = new Scheduler;
+			return *g_scheduler;
+		}
+
+		void launch( const std::shared_ptr<TaskData> &taskData )
+		{
+			{
+				std::lock_guard<std::mutex> lock( m_mutex );
+				m_queues[taskData->priority].push_back( taskData );
+				if( taskData->priority != Speculative )
+				{
+					// Preempt running speculative tasks, so that their
+					// threads become available promptly. Safe to access
+					// `canceller` without locking `taskData->mutex`, because
+					// it is only replaced after removal from `m_runningSpeculative`.
+					for( auto t : m_runningSpeculative )
+					{
+						t->preempted = true;
+						t->canceller->cancel();
+					}
+				}
+			}
+			enqueueRunner();
+		}
+
+	private :
+
+		Scheduler()
+			:	m_runningUrgent( 0 ), m_deferred( 0 ),
+				m_speculativeArena( std::max( 1, tbb::this_task_arena::max_concurrency() / 2 ) )
+		{
+		}
+
+		void enqueueRunner()
+		{
+			tbb::task *runnerTask = new( tbb::task::allocate_root() ) FunctionTask(
+				[this] { runNext(); }
+			);
+			tbb::task::enqueue( *runnerTask );
+		}
+
+		void runNext()
+		{
+			std::shared_ptr<TaskData> taskData;
+			{
+				std::lock_guard<std::mutex> lock( m_mutex );
+				for( int p = Interactive; p >= Speculative && !taskData; --p )
+				{
+					if( m_queues[p].size() )
+					{
+						taskData = m_queues[p].front();
+						m_queues[p].pop_front();
+					}
+				}
+
+				if( !taskData )
+				{
+					return;
+				}
+
+				if( taskData->priority == Speculative && m_runningUrgent )
+				{
+					// Defer until the urgent tasks have completed.
+					m_queues[Speculative].push_front( taskData );
+					m_deferred++;
+					return;
+				}
+
+				// Early out if we were cancelled before the task
+				// even started.
+				std::unique_lock<std::mutex> taskLock( taskData->mutex );
+				if( taskData->status == Cancelled )
+				{
+					return;
+				}
+
+				// Otherwise do the work.
+
+				taskData->status = Running;
+				if( taskData->priority == Speculative )
+				{
+					m_runningSpeculative.insert( taskData.get() );
+				}
+				else
+				{
+					m_runningUrgent++;
+				}
+			}
+
+			Status status = Errored;
+			if( taskData->priority == Speculative )
+			{
+				m_speculativeArena.execute( [&taskData, &status] { status = run( *taskData ); } );
+			}
+			else
+			{
+				status = run( *taskData );
+			}
 
-			// Early out if we were cancelled before the task
-			// even started.
-			std::unique_lock<std::mutex> lock( taskData->mutex );
-			if( taskData->status == Cancelled )
+			size_t numRunners = 0;
 			{
-				return;
+				std::lock_guard<std::mutex> lock( m_mutex );
+				if( taskData->priority == Speculative )
+				{
+					m_runningSpeculative.erase( taskData.get() );
+				}
+				else if( --m_runningUrgent == 0 )
+				{
+					std::swap( numRunners, m_deferred );
+				}
 			}
 
-			// Otherwise do the work.
+			std::unique_lock<std::mutex> taskLock( taskData->mutex );
+			if( status == Cancelled && taskData->preempted && !taskData->cancelRequested )
+			{
+				// Preempted rather than cancelled. Queue to run
+				// again from the start.
+				taskData->canceller.reset( new IECore::Canceller );
+				taskData->preempted = false;
+				taskData->status = Pending;
+				taskLock.unlock();
+
+				std::lock_guard<std::mutex> lock( m_mutex );
+				m_queues[Speculative].push_back( taskData );
+				numRunners++;
+			}
+			else
+			{
+				taskData->status = status;
+				taskData->conditionVariable.notify_one();
+				taskLock.unlock();
+			}
 
-			taskData->status = Running;
-			lock.unlock();
+			for( size_t i = 0; i < numRunners; ++i )
+			{
+				enqueueRunner();
+			}
+		}
 
+		static Status run( TaskData &taskData )
+		{
 			// Reset thread state rather then inherit the random
 			// one that TBB task-stealing might present us with.
 			const ThreadState defaultThreadState;
 			ThreadState::Scope threadStateScope( defaultThreadState );
 
-			Status status;
 			try
 			{
-				(*taskData->function)( taskData->canceller );
-				status = Completed;
+				(*taskData.function)( *taskData.canceller );
+				return Completed;
 			}
 			catch( const std::exception &e )
 			{
@@ -199,12 +345,12 @@ BackgroundTask::BackgroundTask( const Plug *subject, const Function &function )
 					"BackgroundTask",
 					e.what()
 				);
-				status = Errored;
+				return Errored;
 			}
 			catch( const IECore::Cancelled &e )
 			{
 				// No need to do anything
-				status = Cancelled;
+				return Cancelled;
 			}
 			catch( ... )
 			{
@@ -213,15 +359,34 @@ BackgroundTask::BackgroundTask( const Plug *subject, const Function &function )
 					"BackgroundTask",
 					"Unknown error"
 				);
-				status = Errored;
+				return Errored;
 			}
-
-			lock.lock();
-			taskData->status = status;
-			taskData->conditionVariable.notify_one();
 		}
-	);
-	tbb::task::enqueue( *functionTask );
+
+		// Protects all the members below.
+		std::mutex m_mutex;
+		// Pending tasks, indexed by priority.
+		std::deque<std::shared_ptr<TaskData>> m_queues[Interactive + 1];
+		std::unordered_set<TaskData *> m_runningSpeculative;
+		// Number of running tasks with priority above Speculative.
+		size_t m_runningUrgent;
+		// Number of runners that returned without running a
+		// speculative task, because urgent tasks were running.
+		size_t m_deferred;
+
+		tbb::task_arena m_speculativeArena;
+
+};
+
+//////////////////////////////////////////////////////////////////////////
+// BackgroundTask
+//////////////////////////////////////////////////////////////////////////
+
+BackgroundTask::BackgroundTask( const Plug *subject, const Function &function, Priority priority )
+	:	m_function( function ), m_taskData( std::make_shared<TaskData>( &m_function, priority ) )
+{
+	activeTasks().insert( ActiveTask{ this, scriptNode( subject ) } );
+	Scheduler::instance().launch( m_taskData );
 }
 
 BackgroundTask::~BackgroundTask()
@@ -236,7 +401,8 @@ void BackgroundTask::cancel()
 	{
 		m_taskData->status = Cancelled;
 	}
-	m_taskData->canceller.cancel();
+	m_taskData->cancelRequested = true;
+	m_taskData->canceller->cancel();
 }
 
 void BackgroundTask::wait()
@@ -303,6 +469,11 @@ BackgroundTask::Status BackgroundTask::status() const
 	return m_taskData->status;
 }
 
+BackgroundTask::Priority BackgroundTask::priority() const
+{
+	return m_taskData->priority;
+}
+
 void BackgroundTask::cancelAffectedTasks( const GraphComponent *actionSubject )
 {
 	const ActiveTasks &a = activeTasks();
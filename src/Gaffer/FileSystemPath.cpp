@@ -41,6 +41,7 @@
 #include "Gaffer/FileSequencePathFilter.h"
 #include "Gaffer/MatchPatternPathFilter.h"
 #include "Gaffer/PathFilter.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
 
 #include "IECore/DateTimeData.h"
 #include "IECore/FileSequenceFunctions.h"
@@ -51,6 +52,13 @@
 #include "boost/filesystem.hpp"
 #include "boost/filesystem/operations.hpp"
 
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include <dirent.h>
+#include <fcntl.h>
 #include <grp.h>
 #include <pwd.h>
 #include <sys/stat.h>
@@ -70,6 +78,361 @@ static InternedString g_modificationTimePropertyName( "fileSystem:modificationTi
 static InternedString g_sizePropertyName( "fileSystem:size" );
 static InternedString g_frameRangePropertyName( "fileSystem:frameRange" );
 
+//////////////////////////////////////////////////////////////////////////
+// Directory cache
+//
+// Listing a directory and then querying the properties of each child
+// individually can be very slow on network filesystems. So we read each
+// directory in a single pass, gathering the stat data for every entry as
+// we go, and share the result between all FileSystemPaths via a cache.
+// Cached listings are discarded when the directory's modification time
+// changes, which it does whenever entries are added or removed, and also
+// expire after a short time. Because none of this accounts for changes
+// to the entries themselves, their stat data is only used by the call
+// that performed the scan.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+const std::chrono::steady_clock::duration g_directoryListingLifetime = std::chrono::seconds( 2 );
+// Measured in directory entries.
+const size_t g_directoryCacheSize = 1000000;
+// Filesystems may take timestamps from a coarse clock, so a directory
+// modified just after we read it can keep the same modification time.
+// Like git's "racily clean" index entries, we never trust a listing for
+// a directory modified within this interval of the scan.
+const std::chrono::nanoseconds g_timestampGranularity = std::chrono::seconds( 1 );
+
+std::chrono::nanoseconds toNanoseconds( const timespec &t )
+{
+	return std::chrono::seconds( t.tv_sec ) + std::chrono::nanoseconds( t.tv_nsec );
+}
+
+std::chrono::nanoseconds modificationTime( const struct stat &s )
+{
+#ifdef __APPLE__
+	return toNanoseconds( s.st_mtimespec );
+#else
+	return toNanoseconds( s.st_mtim );
+#endif
+}
+
+std::chrono::nanoseconds changeTime( const struct stat &s )
+{
+#ifdef __APPLE__
+	return toNanoseconds( s.st_ctimespec );
+#else
+	return toNanoseconds( s.st_ctim );
+#endif
+}
+
+class DirectoryListing
+{
+
+	public :
+
+		struct Entry
+		{
+			std::string name;
+			// False if `stat()` failed, as it will for
+			// broken symbolic links.
+			bool statValid;
+			struct stat stat;
+		};
+
+		// Reads the directory, using `fstatat()` relative to the open directory
+		// so that the kernel doesn't need to resolve the full path of each entry.
+		DirectoryListing( const std::string &directory )
+			:	m_directoryStat(), m_scanTime( std::chrono::steady_clock::now() ), m_racy( false )
+		{
+			const std::chrono::nanoseconds scanStart = std::chrono::system_clock::now().time_since_epoch();
+
+			DIR *dir = opendir( directory.c_str() );
+			if( !dir )
+			{
+				return;
+			}
+
+			const int fd = dirfd( dir );
+			if( fstat( fd, &m_directoryStat ) != 0 )
+			{
+				m_directoryStat = {};
+			}
+
+			m_racy =
+				modificationTime( m_directoryStat ) > scanStart - g_timestampGranularity ||
+				changeTime( m_directoryStat ) > scanStart - g_timestampGranularity
+			;
+
+			while( const dirent *d = readdir( dir ) )
+			{
+				if( d->d_name[0] == '.' && ( d->d_name[1] == '\0' || ( d->d_name[1] == '.' && d->d_name[2] == '\0' ) ) )
+				{
+					continue;
+				}
+				m_entries.push_back( Entry() );
+				Entry &entry = m_entries.back();
+				entry.name = d->d_name;
+				entry.statValid = fstatat( fd, d->d_name, &entry.stat, 0 ) == 0;
+			}
+
+			closedir( dir );
+
+			m_entryIndices.reserve( m_entries.size() );
+			for( size_t i = 0; i < m_entries.size(); ++i )
+			{
+				m_entryIndices[m_entries[i].name] = i;
+			}
+		}
+
+		const std::vector<Entry> &entries() const
+		{
+			return m_entries;
+		}
+
+		const Entry *entry( const std::string &name ) const
+		{
+			auto it = m_entryIndices.find( name );
+			return it != m_entryIndices.end() ? &m_entries[it->second] : nullptr;
+		}
+
+		struct Sequence
+		{
+			ConstFileSequencePtr sequence;
+			bool isDirectory;
+		};
+
+		// The sequences formed by the entries. These are computed on
+		// first access, because most clients don't need them.
+		const std::vector<Sequence> &sequences() const
+		{
+			std::call_once(
+				m_sequencesOnceFlag,
+				[this] {
+					std::vector<std::string> names;
+					names.reserve( m_entries.size() );
+					for( const auto &entry : m_entries )
+					{
+						names.push_back( entry.name );
+					}
+
+					std::vector<FileSequencePtr> sequences;
+					IECore::findSequences( names, sequences, /* minSequenceSize = */ 1 );
+
+					m_sequences.reserve( sequences.size() );
+					for( const auto &sequence : sequences )
+					{
+						std::vector<FrameList::Frame> frames;
+						sequence->getFrameList()->asList( frames );
+						const Entry *firstEntry = entry( sequence->fileNameForFrame( frames[0] ) );
+						m_sequenceIndices[sequence->getFileName()] = m_sequences.size();
+						m_sequences.push_back( { sequence, firstEntry && firstEntry->statValid && S_ISDIR( firstEntry->stat.st_mode ) } );
+					}
+				}
+			);
+			return m_sequences;
+		}
+
+		const FileSequence *sequence( const std::string &fileName ) const
+		{
+			const std::vector<Sequence> &s = sequences();
+			auto it = m_sequenceIndices.find( fileName );
+			return it != m_sequenceIndices.end() ? s[it->second].sequence.get() : nullptr;
+		}
+
+		// Returns true if the listing hasn't expired, and
+		// `directoryStat` shows the directory to be unchanged.
+		bool current( const struct stat &directoryStat ) const
+		{
+			return
+				!m_racy &&
+				std::chrono::steady_clock::now() - m_scanTime < g_directoryListingLifetime &&
+				directoryStat.st_ino == m_directoryStat.st_ino &&
+				directoryStat.st_dev == m_directoryStat.st_dev &&
+				directoryStat.st_nlink == m_directoryStat.st_nlink &&
+				modificationTime( directoryStat ) == modificationTime( m_directoryStat ) &&
+				changeTime( directoryStat ) == changeTime( m_directoryStat )
+			;
+		}
+
+		// Returns true if the directory was read at or after `time`.
+		bool scannedSince( std::chrono::steady_clock::time_point time ) const
+		{
+			return m_scanTime >= time;
+		}
+
+	private :
+
+		std::vector<Entry> m_entries;
+		std::unordered_map<std::string, size_t> m_entryIndices;
+
+		struct stat m_directoryStat;
+		const std::chrono::steady_clock::time_point m_scanTime;
+		bool m_racy;
+
+		mutable std::once_flag m_sequencesOnceFlag;
+		mutable std::vector<Sequence> m_sequences;
+		mutable std::unordered_map<std::string, size_t> m_sequenceIndices;
+
+};
+
+typedef std::shared_ptr<const DirectoryListing> ConstDirectoryListingPtr;
+typedef IECorePreview::LRUCache<std::string, ConstDirectoryListingPtr> DirectoryCache;
+
+DirectoryCache &directoryCache()
+{
+	static DirectoryCache g_cache(
+		[] ( const std::string &directory, size_t &cost ) {
+			ConstDirectoryListingPtr result = std::make_shared<DirectoryListing>( directory );
+			cost = result->entries().size() + 1;
+			return result;
+		},
+		g_directoryCacheSize
+	);
+	return g_cache;
+}
+
+// Returns an up to date listing for `directory`, or null if
+// it is not a directory. This costs a single `stat()` call if
+// a current listing is cached. The entry names are up to date,
+// but their stat data is only guaranteed to be so if the listing
+// was `scannedSince()` the call.
+ConstDirectoryListingPtr directoryListing( const std::string &directory )
+{
+	struct stat s;
+	if( stat( directory.c_str(), &s ) != 0 || !S_ISDIR( s.st_mode ) )
+	{
+		return nullptr;
+	}
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	DirectoryCache &cache = directoryCache();
+	ConstDirectoryListingPtr result = cache.get( directory );
+	if( !result->scannedSince( start ) && !result->current( s ) )
+	{
+		cache.erase( directory );
+		result = cache.get( directory );
+	}
+	return result;
+}
+
+bool isDirectory( const FileSystemPath &path )
+{
+	struct stat s;
+	return stat( path.string().c_str(), &s ) == 0 && S_ISDIR( s.st_mode );
+}
+
+// `getpwuid()` and `getgrgid()` may perform slow network queries,
+// and aren't threadsafe, so we cache their results.
+
+std::string userName( uid_t uid )
+{
+	static std::mutex g_mutex;
+	static std::unordered_map<uid_t, std::string> g_names;
+
+	std::lock_guard<std::mutex> lock( g_mutex );
+	auto it = g_names.find( uid );
+	if( it != g_names.end() )
+	{
+		return it->second;
+	}
+
+	std::vector<char> buffer( 16384 );
+	struct passwd pw;
+	struct passwd *result = nullptr;
+	getpwuid_r( uid, &pw, buffer.data(), buffer.size(), &result );
+	return g_names[uid] = result ? result->pw_name : "";
+}
+
+std::string groupName( gid_t gid )
+{
+	static std::mutex g_mutex;
+	static std::unordered_map<gid_t, std::string> g_names;
+
+	std::lock_guard<std::mutex> lock( g_mutex );
+	auto it = g_names.find( gid );
+	if( it != g_names.end() )
+	{
+		return it->second;
+	}
+
+	std::vector<char> buffer( 16384 );
+	struct group gr;
+	struct group *result = nullptr;
+	getgrgid_r( gid, &gr, buffer.data(), buffer.size(), &result );
+	return g_names[gid] = result ? result->gr_name : "";
+}
+
+// Calls `f( statValid, stat )` for each file represented by `path` - either
+// the file itself, or every file in its sequence.
+template<typename F>
+void visitFileStats( const FileSystemPath &path, bool includeSequences, F &&f )
+{
+	if( includeSequences && path.names().size() && !isDirectory( path ) )
+	{
+		const std::string directory = path.parent()->string();
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		if( auto listing = directoryListing( directory ) )
+		{
+			if( const FileSequence *sequence = listing->sequence( path.names().back().string() ) )
+			{
+				// The stat data in the listing is only up to date if
+				// we scanned the directory ourselves.
+				const bool statsCurrent = listing->scannedSince( start );
+				std::vector<std::string> files;
+				sequence->fileNames( files );
+				for( const auto &file : files )
+				{
+					const DirectoryListing::Entry *entry = statsCurrent ? listing->entry( file ) : nullptr;
+					if( entry )
+					{
+						f( entry->statValid, entry->stat );
+					}
+					else
+					{
+						struct stat s;
+						const bool valid = stat( ( boost::filesystem::path( directory ) / file ).c_str(), &s ) == 0;
+						f( valid, s );
+					}
+				}
+				return;
+			}
+		}
+	}
+
+	struct stat s;
+	const bool valid = stat( path.string().c_str(), &s ) == 0;
+	f( valid, s );
+}
+
+template<typename F>
+std::string mostCommonName( const FileSystemPath &path, bool includeSequences, F &&nameFunction )
+{
+	std::map<std::string, size_t> counts;
+	size_t maxCount = 0;
+	std::string result;
+	visitFileStats(
+		path, includeSequences,
+		[&] ( bool valid, const struct stat &s ) {
+			const std::string name = valid ? nameFunction( s ) : "";
+			const size_t count = ++counts[name];
+			if( count > maxCount )
+			{
+				maxCount = count;
+				result = name;
+			}
+		}
+	);
+	return result;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// FileSystemPath
+//////////////////////////////////////////////////////////////////////////
+
 FileSystemPath::FileSystemPath( PathFilterPtr filter, bool includeSequences )
 	:	Path( filter ), m_includeSequences( includeSequences )
 {
@@ -107,7 +470,7 @@ bool FileSystemPath::isValid() const
 
 bool FileSystemPath::isLeaf() const
 {
-	return isValid() && !is_directory( path( this->string() ) );
+	return isValid() && !isDirectory( *this );
 }
 
 bool FileSystemPath::getIncludeSequences() const
@@ -122,7 +485,7 @@ void FileSystemPath::setIncludeSequences( bool includeSequences )
 
 bool FileSystemPath::isFileSequence() const
 {
-	if( !m_includeSequences || is_directory( path( this->string() ) ) )
+	if( !m_includeSequences || isDirectory( *this ) )
 	{
 		return false;
 	}
@@ -140,14 +503,26 @@ bool FileSystemPath::isFileSequence() const
 
 FileSequencePtr FileSystemPath::fileSequence() const
 {
-	if( !m_includeSequences || is_directory( path( this->string() ) ) )
+	if( !m_includeSequences || names().empty() || isDirectory( *this ) )
+	{
+		return nullptr;
+	}
+
+	ConstDirectoryListingPtr listing = directoryListing( parent()->string() );
+	if( !listing )
+	{
+		return nullptr;
+	}
+
+	const FileSequence *sequence = listing->sequence( names().back().string() );
+	if( !sequence )
 	{
 		return nullptr;
 	}
 
-	FileSequencePtr sequence = nullptr;
-	IECore::ls( this->string(), sequence, /* minSequenceSize = */ 1 );
-	return sequence;
+	FileSequencePtr result = sequence->copy();
+	result->setFileName( this->string() );
+	return result;
 }
 
 void FileSystemPath::propertyNames( std::vector<IECore::InternedString> &names ) const
@@ -169,135 +544,48 @@ IECore::ConstRunTimeTypedPtr FileSystemPath::property( const IECore::InternedStr
 {
 	if( name == g_ownerPropertyName )
 	{
-		if( m_includeSequences )
-		{
-			FileSequencePtr sequence = fileSequence();
-			if( sequence )
-			{
-				std::vector<std::string> files;
-				sequence->fileNames( files );
-
-				size_t maxCount = 0;
-				std::string mostCommon = "";
-				std::map<std::string,size_t> ownerCounter;
-				for( std::vector<std::string>::iterator it = files.begin(); it != files.end(); ++it )
-				{
-					struct stat s;
-					stat( it->c_str(), &s );
-					struct passwd *pw = getpwuid( s.st_uid );
-					std::string value = pw ? pw->pw_name : "";
-					std::pair<std::map<std::string,size_t>::iterator,bool> oIt = ownerCounter.insert( std::pair<std::string,size_t>( value, 0 ) );
-					oIt.first->second++;
-					if( oIt.first->second > maxCount )
-					{
-						mostCommon = value;
-					}
-				}
-
-				return new StringData( mostCommon );
-			}
-		}
-
-		std::string n = this->string();
-		struct stat s;
-		stat( n.c_str(), &s );
-		struct passwd *pw = getpwuid( s.st_uid );
-		return new StringData( pw ? pw->pw_name : "" );
+		return new StringData(
+			mostCommonName( *this, m_includeSequences, [] ( const struct stat &s ) { return userName( s.st_uid ); } )
+		);
 	}
 	else if( name == g_groupPropertyName )
 	{
-		if( m_includeSequences )
-		{
-			FileSequencePtr sequence = fileSequence();
-			if( sequence )
-			{
-				std::vector<std::string> files;
-				sequence->fileNames( files );
-
-				size_t maxCount = 0;
-				std::string mostCommon = "";
-				std::map<std::string,size_t> ownerCounter;
-				for( std::vector<std::string>::iterator it = files.begin(); it != files.end(); ++it )
-				{
-					struct stat s;
-					stat( it->c_str(), &s );
-					struct group *gr = getgrgid( s.st_gid );
-					std::string value = gr ? gr->gr_name : "";
-					std::pair<std::map<std::string,size_t>::iterator,bool> oIt = ownerCounter.insert( std::pair<std::string,size_t>( value, 0 ) );
-					oIt.first->second++;
-					if( oIt.first->second > maxCount )
-					{
-						mostCommon = value;
-					}
-				}
-
-				return new StringData( mostCommon );
-			}
-		}
-
-		std::string n = this->string();
-		struct stat s;
-		stat( n.c_str(), &s );
-		struct group *gr = getgrgid( s.st_gid );
-		return new StringData( gr ? gr->gr_name : "" );
+		return new StringData(
+			mostCommonName( *this, m_includeSequences, [] ( const struct stat &s ) { return groupName( s.st_gid ); } )
+		);
 	}
 	else if( name == g_modificationTimePropertyName )
 	{
-		boost::system::error_code e;
-
-		if( m_includeSequences )
-		{
-			FileSequencePtr sequence = fileSequence();
-			if( sequence )
-			{
-				std::vector<std::string> files;
-				sequence->fileNames( files );
-
-				std::time_t newest = 0;
-				for( std::vector<std::string>::iterator it = files.begin(); it != files.end(); ++it )
+		// Matches the result of `boost::filesystem::last_write_time()`
+		// for a file that doesn't exist.
+		std::time_t newest = -1;
+		bool first = true;
+		visitFileStats(
+			*this, m_includeSequences,
+			[&] ( bool valid, const struct stat &s ) {
+				const std::time_t t = valid ? s.st_mtime : -1;
+				if( first || t > newest )
 				{
-					std::time_t t = last_write_time( path( *it ), e );
-					if( t > newest )
-					{
-						newest = t;
-					}
+					newest = t;
+					first = false;
 				}
-
-				return new DateTimeData( from_time_t( newest ) );
 			}
-		}
-
-		std::time_t t = last_write_time( path( this->string() ), e );
-		return new DateTimeData( from_time_t( t ) );
+		);
+		return new DateTimeData( from_time_t( newest ) );
 	}
 	else if( name == g_sizePropertyName )
 	{
-		boost::system::error_code e;
-
-		if( m_includeSequences )
-		{
-			FileSequencePtr sequence = fileSequence();
-			if( sequence )
-			{
-				std::vector<std::string> files;
-				sequence->fileNames( files );
-
-				uintmax_t total = 0;
-				for( std::vector<std::string>::iterator it = files.begin(); it != files.end(); ++it )
+		uint64_t total = 0;
+		visitFileStats(
+			*this, m_includeSequences,
+			[&total] ( bool valid, const struct stat &s ) {
+				if( valid && S_ISREG( s.st_mode ) )
 				{
-					uintmax_t s = file_size( path( *it ), e );
-					if( !e )
-					{
-						total += s;
-					}
+					total += s.st_size;
 				}
-
-				return new UInt64Data( total );
 			}
-		}
-
-		uintmax_t s = file_size( path( this->string() ), e );
-		return new UInt64Data( !e ? s : 0 );
+		);
+		return new UInt64Data( total );
 	}
 	else if( name == g_frameRangePropertyName )
 	{
@@ -320,29 +608,31 @@ PathPtr FileSystemPath::copy() const
 
 void FileSystemPath::doChildren( std::vector<PathPtr> &children ) const
 {
-	path p( this->string() );
-
-	if( !is_directory( p ) )
+	ConstDirectoryListingPtr listing = directoryListing( this->string() );
+	if( !listing )
 	{
 		return;
 	}
 
-	for( directory_iterator it( p ), eIt; it != eIt; ++it )
+	PathFilter *filter = const_cast<PathFilter *>( getFilter() );
+	Names childNames = names();
+	childNames.push_back( InternedString() );
+
+	children.reserve( listing->entries().size() );
+	for( const auto &entry : listing->entries() )
 	{
-		children.push_back( new FileSystemPath( it->path().string(), const_cast<PathFilter *>( getFilter() ), m_includeSequences ) );
+		childNames.back() = entry.name;
+		children.push_back( new FileSystemPath( childNames, root(), filter, m_includeSequences ) );
 	}
 
 	if( m_includeSequences )
 	{
-		std::vector<FileSequencePtr> sequences;
-		IECore::ls( p.string(), sequences, /* minSequenceSize */ 1 );
-		for( std::vector<FileSequencePtr>::iterator it = sequences.begin(); it != sequences.end(); ++it )
+		for( const auto &sequence : listing->sequences() )
 		{
-			std::vector<FrameList::Frame> frames;
-			(*it)->getFrameList()->asList( frames );
-			if ( !is_directory( path( (*it)->fileNameForFrame( frames[0] ) ) ) )
+			if( !sequence.isDirectory )
 			{
-				children.push_back( new FileSystemPath( path( p / (*it)->getFileName() ).string(), const_cast<PathFilter *>( getFilter() ), m_includeSequences ) );
+				childNames.back() = sequence.sequence->getFileName();
+				children.push_back( new FileSystemPath( childNames, root(), filter, m_includeSequences ) );
 			}
 		}
 	}
@@ -49,6 +49,7 @@
 #include "boost/regex.hpp"
 
 #include <set>
+#include <unordered_map>
 
 using namespace Gaffer;
 using namespace IECore;
@@ -111,6 +112,12 @@ void validateName( const InternedString &name )
 	throw IECore::Exception( what );
 }
 
+// Above this number of children, we maintain an index to accelerate
+// `getChild()`. Below it, a linear search is quicker. We only discard
+// the index when the number of children falls well below the threshold,
+// to avoid repeatedly building and discarding it.
+const size_t g_childIndexThreshold = 64;
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -144,6 +151,36 @@ struct GraphComponent::Signals : boost::noncopyable
 
 };
 
+//////////////////////////////////////////////////////////////////////////
+// GraphComponent::ChildIndex
+//////////////////////////////////////////////////////////////////////////
+
+struct GraphComponent::ChildIndex : boost::noncopyable
+{
+
+	// Names are unique among siblings except transiently, during
+	// `addChildInternal()`, before the name of the new child has been
+	// made unique. So we only add children once their name is unique,
+	// and we only remove entries that refer to the child in question.
+
+	void add( GraphComponent *child )
+	{
+		map[child->m_name] = child;
+	}
+
+	void remove( const IECore::InternedString &name, const GraphComponent *child )
+	{
+		auto it = map.find( name );
+		if( it != map.end() && it->second == child )
+		{
+			map.erase( it );
+		}
+	}
+
+	std::unordered_map<IECore::InternedString, GraphComponent *> map;
+
+};
+
 //////////////////////////////////////////////////////////////////////////
 // GraphComponent
 //////////////////////////////////////////////////////////////////////////
@@ -183,12 +220,20 @@ const IECore::InternedString &GraphComponent::setName( const IECore::InternedStr
 	if( m_parent )
 	{
 		bool uniqueAlready = true;
-		for( ChildContainer::const_iterator it=m_parent->m_children.begin(), eIt=m_parent->m_children.end(); it != eIt; it++ )
+		if( m_parent->m_childIndex )
+		{
+			const GraphComponent *sibling = m_parent->getChildInternal( newName );
+			uniqueAlready = !sibling || sibling == this;
+		}
+		else
 		{
-			if( *it != this && (*it)->m_name == newName )
+			for( ChildContainer::const_iterator it=m_parent->m_children.begin(), eIt=m_parent->m_children.end(); it != eIt; it++ )
 			{
-				uniqueAlready = false;
-				break;
+				if( *it != this && (*it)->m_name == newName )
+				{
+					uniqueAlready = false;
+					break;
+				}
 			}
 		}
 
@@ -240,7 +285,16 @@ const IECore::InternedString &GraphComponent::setName( const IECore::InternedStr
 
 void GraphComponent::setNameInternal( const IECore::InternedString &name )
 {
-	m_name = name;
+	if( m_parent && m_parent->m_childIndex )
+	{
+		m_parent->m_childIndex->remove( m_name, this );
+		m_name = name;
+		m_parent->m_childIndex->add( this );
+	}
+	else
+	{
+		m_name = name;
+	}
 	Signals::emitLazily( m_signals.get(), &Signals::nameChangedSignal, this );
 }
 
@@ -398,6 +452,11 @@ void GraphComponent::addChildInternal( GraphComponentPtr child, size_t index )
 	m_children.insert( m_children.begin() + min( index, m_children.size() ), child );
 	child->m_parent = this;
 	child->setName( child->m_name.value() ); // to force uniqueness
+	if( m_childIndex )
+	{
+		m_childIndex->add( child.get() );
+	}
+	updateChildIndex();
 	Signals::emitLazily( m_signals.get(), &Signals::childAddedSignal, this, child.get() );
 	child->parentChanged( previousParent );
 	Signals::emitLazily( child->m_signals.get(), &Signals::parentChangedSignal, child.get(), previousParent );
@@ -460,6 +519,11 @@ void GraphComponent::removeChildInternal( GraphComponentPtr child, bool emitPare
 		throw Exception( boost::str( boost::format( "GraphComponent::removeChildInternal : \"%s\" is not a child of \"%s\"." ) % child->fullName() % fullName() ) );
 	}
 	m_children.erase( it );
+	if( m_childIndex )
+	{
+		m_childIndex->remove( child->m_name, child.get() );
+	}
+	updateChildIndex();
 	child->m_parent = nullptr;
 	Signals::emitLazily( m_signals.get(), &Signals::childRemovedSignal, this, child.get() );
 	if( emitParentChanged )
@@ -481,6 +545,43 @@ const GraphComponent::ChildContainer &GraphComponent::children() const
 	return m_children;
 }
 
+const GraphComponent *GraphComponent::getChildInternal( const IECore::InternedString &name ) const
+{
+	if( m_childIndex )
+	{
+		auto it = m_childIndex->map.find( name );
+		return it != m_childIndex->map.end() ? it->second : nullptr;
+	}
+
+	for( ChildContainer::const_iterator it=m_children.begin(), eIt=m_children.end(); it!=eIt; it++ )
+	{
+		if( (*it)->m_name==name )
+		{
+			return it->get();
+		}
+	}
+	return nullptr;
+}
+
+void GraphComponent::updateChildIndex()
+{
+	if( !m_childIndex && m_children.size() > g_childIndexThreshold )
+	{
+		m_childIndex.reset( new ChildIndex );
+		m_childIndex->map.reserve( m_children.size() );
+		for( const auto &child : m_children )
+		{
+			// Using `emplace()` so that the first of any
+			// duplicates wins, matching a linear search.
+			m_childIndex->map.emplace( child->m_name, child.get() );
+		}
+	}
+	else if( m_childIndex && m_children.size() < g_childIndexThreshold / 2 )
+	{
+		m_childIndex.reset();
+	}
+}
+
 GraphComponent *GraphComponent::ancestor( IECore::TypeId type )
 {
 	GraphComponent *a = m_parent;
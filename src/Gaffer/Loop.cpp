@@ -38,9 +38,112 @@
 
 #include "Gaffer/ContextAlgo.h"
 #include "Gaffer/MetadataAlgo.h"
+#include "Gaffer/Process.h"
+
+#include "IECore/Canceller.h"
 
 #include "boost/bind.hpp"
 
+#include "tbb/concurrent_hash_map.h"
+
+namespace
+{
+
+// Loops with more iterations than this are evaluated iteratively,
+// bottom-up, rather than by relying solely on recursion from the
+// last iteration back to the first.
+const int g_iterativeEvaluationThreshold = 16;
+
+// Process used to report the progress of iterative evaluation
+// to Monitors. Each iteration is evaluated within a process whose
+// context contains the index variable for that iteration.
+class IterationProcess : public Gaffer::Process
+{
+
+	public :
+
+		IterationProcess( const Gaffer::Plug *plug )
+			:	Process( staticType, plug )
+		{
+		}
+
+		static const IECore::InternedString staticType;
+
+};
+
+const IECore::InternedString IterationProcess::staticType( "loop:iteration" );
+
+// Results of previous iterations, keyed by hash. These are held while
+// the subsequent iteration is computed, so that `Loop::compute()` can
+// return them even if they have been evicted from the ValuePlug cache,
+// rather than recursing back through all the preceding iterations.
+struct PinnedValue
+{
+	IECore::ConstObjectPtr value;
+	size_t count;
+};
+
+using PinnedValues = tbb::concurrent_hash_map<IECore::MurmurHash, PinnedValue>;
+PinnedValues g_pinnedValues;
+
+class Pin : boost::noncopyable
+{
+
+	public :
+
+		~Pin()
+		{
+			release();
+		}
+
+		void set( const IECore::MurmurHash &hash, const IECore::ConstObjectPtr &value )
+		{
+			release();
+			PinnedValues::accessor a;
+			if( g_pinnedValues.insert( a, hash ) )
+			{
+				a->second.value = value;
+				a->second.count = 0;
+			}
+			a->second.count++;
+			m_hash = hash;
+			m_pinned = true;
+		}
+
+		static IECore::ConstObjectPtr find( const IECore::MurmurHash &hash )
+		{
+			PinnedValues::const_accessor a;
+			if( g_pinnedValues.find( a, hash ) )
+			{
+				return a->second.value;
+			}
+			return nullptr;
+		}
+
+	private :
+
+		void release()
+		{
+			if( !m_pinned )
+			{
+				return;
+			}
+
+			PinnedValues::accessor a;
+			if( g_pinnedValues.find( a, m_hash ) && !--a->second.count )
+			{
+				g_pinnedValues.erase( a );
+			}
+			m_pinned = false;
+		}
+
+		IECore::MurmurHash m_hash;
+		bool m_pinned = false;
+
+};
+
+} // namespace
+
 namespace Gaffer
 {
 
@@ -194,6 +297,17 @@ void Loop::hash( const ValuePlug *output, const Context *context, IECore::Murmur
 	IECore::InternedString indexVariable;
 	if( const ValuePlug *plug = sourcePlug( output, context, index, indexVariable ) )
 	{
+		if( index >= g_iterativeEvaluationThreshold && isOutput( output ) )
+		{
+			// Hash the preceding iterations in order, so that the hash for
+			// each one is already cached when the next is computed, and the
+			// recursion through `previousPlug()` is only ever one iteration deep.
+			iterate(
+				plug, context, indexVariable, index,
+				[] ( const ValuePlug *plug, const IECore::MurmurHash &hash ) {}
+			);
+		}
+
 		Context::EditableScope tmpContext( context );
 		if( index >= 0 )
 		{
@@ -216,6 +330,21 @@ void Loop::compute( ValuePlug *output, const Context *context ) const
 	IECore::InternedString indexVariable;
 	if( const ValuePlug *plug = sourcePlug( output, context, index, indexVariable ) )
 	{
+		Pin pin;
+		if( index >= g_iterativeEvaluationThreshold && isOutput( output ) )
+		{
+			// Compute the preceding iterations in order, pinning the result of
+			// each until the next has been computed. This bounds the recursion
+			// through `previousPlug()` to a single iteration, even if results
+			// are evicted from the cache.
+			iterate(
+				plug, context, indexVariable, index,
+				[&pin] ( const ValuePlug *plug, const IECore::MurmurHash &hash ) {
+					pin.set( hash, plug->getObjectValue( &hash ) );
+				}
+			);
+		}
+
 		Context::EditableScope tmpContext( context );
 		if( index >= 0 )
 		{
@@ -225,6 +354,17 @@ void Loop::compute( ValuePlug *output, const Context *context ) const
 		{
 			tmpContext.remove( indexVariable );
 		}
+
+		if( index >= 0 && !g_pinnedValues.empty() )
+		{
+			const IECore::MurmurHash hash = plug->hash();
+			if( IECore::ConstObjectPtr pinned = Pin::find( hash ) )
+			{
+				output->setObjectValue( pinned );
+				return;
+			}
+		}
+
 		output->setFrom( plug );
 		return;
 	}
@@ -232,6 +372,26 @@ void Loop::compute( ValuePlug *output, const Context *context ) const
 	ComputeNode::compute( output, context );
 }
 
+bool Loop::isOutput( const ValuePlug *plug ) const
+{
+	std::vector<IECore::InternedString> relativeName;
+	return ancestorPlug( plug, relativeName ) == outPlug();
+}
+
+template<typename F>
+void Loop::iterate( const ValuePlug *plug, const Context *context, const IECore::InternedString &indexVariable, int lastIndex, F &&f ) const
+{
+	Context::EditableScope iterationContext( context );
+	for( int i = 0; i < lastIndex; ++i )
+	{
+		IECore::Canceller::check( context->canceller() );
+		iterationContext.set<int>( indexVariable, i );
+		IterationProcess process( plug );
+		const IECore::MurmurHash hash = plug->hash();
+		f( plug, hash );
+	}
+}
+
 void Loop::childAdded()
 {
 	setupPlugs();
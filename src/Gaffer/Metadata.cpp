@@ -45,14 +45,17 @@
 #include "IECore/StringAlgo.h"
 
 #include "boost/bind.hpp"
+#include "boost/functional/hash.hpp"
 #include "boost/multi_index/member.hpp"
 #include "boost/multi_index/ordered_index.hpp"
 #include "boost/multi_index/sequenced_index.hpp"
 #include "boost/multi_index_container.hpp"
 #include "boost/optional.hpp"
 
+#include "tbb/concurrent_unordered_map.h"
 #include "tbb/tbb.h"
 
+#include <memory>
 #include <unordered_map>
 
 using namespace std;
@@ -217,7 +220,7 @@ typedef multi_index::multi_index_container<
 	>
 > Values;
 
-typedef std::map<IECore::InternedString, Values> MetadataMap;
+typedef std::unordered_map<IECore::InternedString, Values> MetadataMap;
 
 MetadataMap &metadataMap()
 {
@@ -269,6 +272,141 @@ GraphComponentMetadataMap &graphComponentMetadataMap()
 	return *g_m;
 }
 
+// Flattened lookups for type-based targets
+// ========================================
+//
+// Retrieving a type-based value means searching the registrations for
+// every type in the inheritance hierarchy of the target, and for plugs,
+// for every type in the hierarchy of every ancestor. Lookups vastly
+// outnumber registrations, so we cache a flattened view of the
+// registrations for each type, with inheritance already resolved and
+// everything indexed by key. The cache is populated lazily by lookups,
+// which may be concurrent, and is discarded by any type-based
+// registration. Like the registrations themselves, this relies on
+// type-based registrations not being made concurrently with lookups.
+
+struct MatchPatternPathHash
+{
+
+	size_t operator()( const StringAlgo::MatchPatternPath &path ) const
+	{
+		size_t result = 0;
+		for( const auto &name : path )
+		{
+			boost::hash_combine( result, std::hash<InternedString>()( name ) );
+		}
+		return result;
+	}
+
+};
+
+const InternedString g_ellipsis( "..." );
+
+bool hasWildcards( const StringAlgo::MatchPatternPath &path )
+{
+	for( const auto &name : path )
+	{
+		if( name == g_ellipsis || StringAlgo::hasWildcards( name.string() ) )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+struct FlattenedMetadata
+{
+
+	// Values registered to the type or any of its base types. Registrations
+	// for more derived types take precedence. Pointers refer to the functions
+	// stored in `graphComponentMetadataMap()`, which remain valid until the
+	// next registration.
+	std::unordered_map<InternedString, const Metadata::GraphComponentValueFunction *> values;
+
+	// Plug path registrations for a single key.
+	struct PlugValues
+	{
+		// Paths without wildcards, which can be looked up directly.
+		std::unordered_map<StringAlgo::MatchPatternPath, const Metadata::PlugValueFunction *, MatchPatternPathHash> paths;
+		// Paths with wildcards, which must be matched in order.
+		std::vector<std::pair<const StringAlgo::MatchPatternPath *, const Metadata::PlugValueFunction *>> patterns;
+	};
+
+	// Plug path registrations indexed by key, with one entry for each
+	// type in the hierarchy that has registrations, ordered from most derived
+	// to least derived.
+	using PlugValuesMap = std::unordered_map<InternedString, PlugValues>;
+	std::vector<PlugValuesMap> plugValues;
+
+};
+
+using FlattenedMetadataPtr = std::shared_ptr<const FlattenedMetadata>;
+using FlattenedMetadataMap = tbb::concurrent_unordered_map<IECore::TypeId, FlattenedMetadataPtr>;
+
+FlattenedMetadataMap &flattenedMetadataMap()
+{
+	static auto g_m = new FlattenedMetadataMap;
+	return *g_m;
+}
+
+const FlattenedMetadata &flattenedMetadata( IECore::TypeId typeId )
+{
+	FlattenedMetadataMap &m = flattenedMetadataMap();
+	auto it = m.find( typeId );
+	if( it != m.end() )
+	{
+		return *it->second;
+	}
+
+	auto flattened = std::make_shared<FlattenedMetadata>();
+	const GraphComponentMetadataMap &gm = graphComponentMetadataMap();
+	for( IECore::TypeId t = typeId; t != InvalidTypeId; t = RunTimeTyped::baseTypeId( t ) )
+	{
+		auto gIt = gm.find( t );
+		if( gIt == gm.end() )
+		{
+			continue;
+		}
+
+		for( const auto &v : gIt->second.values )
+		{
+			// Doesn't replace values already inserted for more derived types.
+			flattened->values.insert( { v.first, &v.second } );
+		}
+
+		FlattenedMetadata::PlugValuesMap plugValues;
+		for( const auto &p : gIt->second.plugPathsToValues )
+		{
+			const bool wildcards = hasWildcards( p.first );
+			for( const auto &v : p.second )
+			{
+				FlattenedMetadata::PlugValues &pv = plugValues[v.first];
+				if( wildcards )
+				{
+					pv.patterns.push_back( { &p.first, &v.second } );
+				}
+				else
+				{
+					pv.paths[p.first] = &v.second;
+				}
+			}
+		}
+		if( plugValues.size() )
+		{
+			flattened->plugValues.push_back( std::move( plugValues ) );
+		}
+	}
+
+	// If another thread got here first, `insert()` returns its
+	// result and ours is discarded.
+	return *m.insert( { typeId, flattened } ).first->second;
+}
+
+void typeRegistrationsChanged()
+{
+	flattenedMetadataMap().clear();
+}
+
 // Value storage for instance targets
 // ==================================
 
@@ -306,22 +444,24 @@ InstanceValues *instanceMetadata( const GraphComponent *instance, bool createIfM
 {
 	InstanceMetadataMap &m = instanceMetadataMap();
 
-	InstanceMetadataMap::accessor accessor;
-	if( m.find( accessor, instance ) )
-	{
-		return accessor->second;
-	}
-	else
+	if( !createIfMissing )
 	{
-		if( createIfMissing )
+		// Use a `const_accessor` so that concurrent lookups
+		// don't contend for exclusive access.
+		InstanceMetadataMap::const_accessor accessor;
+		if( m.find( accessor, instance ) )
 		{
-			m.insert( accessor, instance );
-			accessor->second = new InstanceValues();
 			return accessor->second;
 		}
+		return nullptr;
 	}
 
-	return nullptr;
+	InstanceMetadataMap::accessor accessor;
+	if( m.insert( accessor, instance ) )
+	{
+		accessor->second = new InstanceValues();
+	}
+	return accessor->second;
 }
 
 // It's valid to register null as an instance value and expect it to override
@@ -549,6 +689,7 @@ void Metadata::registerValue( IECore::TypeId typeId, IECore::InternedString key,
 		m.replace( it, namedValue );
 	}
 
+	typeRegistrationsChanged();
 	emitValueChangedSignals( typeId, key, Metadata::ValueChangedReason::StaticRegistration );
 }
 
@@ -562,6 +703,7 @@ void Metadata::deregisterValue( IECore::TypeId typeId, IECore::InternedString ke
 	}
 
 	m.erase( it );
+	typeRegistrationsChanged();
 	emitValueChangedSignals( typeId, key, Metadata::ValueChangedReason::StaticDeregistration );
 }
 
@@ -578,6 +720,7 @@ void Metadata::deregisterValue( IECore::TypeId ancestorTypeId, const StringAlgo:
 	}
 
 	plugValues.erase( it );
+	typeRegistrationsChanged();
 
 	emitPlugValueChangedSignals( ancestorTypeId, plugPath, matchPatternPath, key, Metadata::ValueChangedReason::StaticDeregistration );
 }
@@ -646,6 +789,7 @@ void Metadata::registerValue( IECore::TypeId ancestorTypeId, const StringAlgo::M
 		plugValues.replace( it, namedValue );
 	}
 
+	typeRegistrationsChanged();
 	emitPlugValueChangedSignals( ancestorTypeId, plugPath, matchPatternPath, key, Metadata::ValueChangedReason::StaticRegistration );
 }
 
@@ -775,38 +919,29 @@ IECore::ConstDataPtr Metadata::valueInternal( const GraphComponent *target, IECo
 		vector<InternedString> plugPath( { plug->getName() } );
 		while( ancestor )
 		{
-			IECore::TypeId typeId = ancestor->typeId();
-			while( typeId != InvalidTypeId )
+			const FlattenedMetadata &f = flattenedMetadata( ancestor->typeId() );
+			for( const auto &plugValues : f.plugValues )
 			{
-				auto nIt = graphComponentMetadataMap().find( typeId );
-				if( nIt != graphComponentMetadataMap().end() )
+				auto pvIt = plugValues.find( key );
+				if( pvIt == plugValues.end() )
 				{
-					// First do a direct lookup using the plug path.
-					auto it = nIt->second.plugPathsToValues.find( plugPath );
-					const auto eIt = nIt->second.plugPathsToValues.end();
-					if( it != eIt )
-					{
-						auto vIt = it->second.find( key );
-						if( vIt != it->second.end() )
-						{
-							return vIt->second( plug );
-						}
-					}
-					// And only if the direct lookup fails, do a full search using
-					// wildcard matches.
-					for( it = nIt->second.plugPathsToValues.begin(); it != eIt; ++it )
+					continue;
+				}
+				// First do a direct lookup using the plug path.
+				auto it = pvIt->second.paths.find( plugPath );
+				if( it != pvIt->second.paths.end() )
+				{
+					return (*it->second)( plug );
+				}
+				// And only if the direct lookup fails, do a full search using
+				// wildcard matches.
+				for( const auto &pattern : pvIt->second.patterns )
+				{
+					if( StringAlgo::match( plugPath, *pattern.first ) )
 					{
-						if( StringAlgo::match( plugPath, it->first ) )
-						{
-							auto vIt = it->second.find( key );
-							if( vIt != it->second.end() )
-							{
-								return vIt->second( plug );
-							}
-						}
+						return (*pattern.second)( plug );
 					}
 				}
-				typeId = RunTimeTyped::baseTypeId( typeId );
 			}
 
 			plugPath.insert( plugPath.begin(), ancestor->getName() );
@@ -816,19 +951,11 @@ IECore::ConstDataPtr Metadata::valueInternal( const GraphComponent *target, IECo
 
 	// Finally look for values registered to the type
 
-	IECore::TypeId typeId = target->typeId();
-	while( typeId != InvalidTypeId )
+	const FlattenedMetadata &f = flattenedMetadata( target->typeId() );
+	auto vIt = f.values.find( key );
+	if( vIt != f.values.end() )
 	{
-		auto nIt = graphComponentMetadataMap().find( typeId );
-		if( nIt != graphComponentMetadataMap().end() )
-		{
-			auto vIt = nIt->second.values.find( key );
-			if( vIt != nIt->second.values.end() )
-			{
-				return vIt->second( target );
-			}
-		}
-		typeId = RunTimeTyped::baseTypeId( typeId );
+		return (*vIt->second)( target );
 	}
 
 	return nullptr;
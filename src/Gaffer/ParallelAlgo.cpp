@@ -95,7 +95,7 @@ void ParallelAlgo::popUIThreadCallHandler()
 	}
 }
 
-GAFFER_API std::unique_ptr<BackgroundTask> ParallelAlgo::callOnBackgroundThread( const Plug *subject, BackgroundFunction function )
+GAFFER_API std::unique_ptr<BackgroundTask> ParallelAlgo::callOnBackgroundThread( const Plug *subject, BackgroundFunction function, BackgroundTask::Priority priority )
 {
 	ContextPtr backgroundContext = new Context( *Context::current() );
 	Monitor::MonitorSet backgroundMonitors = Monitor::current();
@@ -112,7 +112,9 @@ GAFFER_API std::unique_ptr<BackgroundTask> ParallelAlgo::callOnBackgroundThread(
 
 			function();
 
-		}
+		},
+
+		priority
 
 	);
 }
@@ -245,6 +245,11 @@ PathPtr Path::copy() const
 	return new Path( m_names, m_root, m_filter );
 }
 
+const Plug *Path::cancellationSubject() const
+{
+	return nullptr;
+}
+
 void Path::append( const IECore::InternedString &name )
 {
 	checkName( name );
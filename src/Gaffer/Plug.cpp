@@ -53,6 +53,10 @@
 
 #include "tbb/enumerable_thread_specific.h"
 
+#include <atomic>
+#include <limits>
+#include <unordered_map>
+
 using namespace boost;
 using namespace Gaffer;
 
@@ -88,6 +92,18 @@ class ScopedAssignment : boost::noncopyable
 
 };
 
+// Incremented whenever a change is made that might affect the results
+// of a DownstreamIterator, invalidating the downstream closures cached
+// by `Plug::DirtyPlugs`.
+std::atomic<uint64_t> g_topologyGeneration( 0 );
+// Limit on the total number of entries in the cached closures.
+const size_t g_maxClosuresSize = 1000000;
+
+void topologyChanged()
+{
+	g_topologyGeneration++;
+}
+
 bool allDescendantInputsAreNull( const Plug *plug )
 {
 	for( RecursivePlugIterator it( plug ); !it.done(); ++it )
@@ -116,6 +132,7 @@ Plug::Plug( const std::string &name, Direction direction, unsigned flags )
 
 Plug::~Plug()
 {
+	topologyChanged();
 	setInputInternal( nullptr, false );
 	for( OutputContainer::iterator it=m_outputs.begin(); it!=m_outputs.end(); )
 	{
@@ -220,6 +237,7 @@ void Plug::setFlags( unsigned flags, bool enable )
 void Plug::setFlagsInternal( unsigned flags )
 {
 	m_flags = flags;
+	topologyChanged();
 
 	if( Node *n = node() )
 	{
@@ -480,6 +498,7 @@ void Plug::setInputInternal( PlugPtr input, bool emit )
 	{
 		m_input->m_outputs.push_back( this );
 	}
+	topologyChanged();
 	if( emit )
 	{
 		// We must emit inputChanged prior to propagating
@@ -600,6 +619,7 @@ void Plug::parentChanging( Gaffer::GraphComponent *newParent )
 	// essential that exceptions don't prevent us getting to `parentChanged()`
 	// where we pop scope, so propateDirtiness() takes care of handling
 	// exceptions thrown by `DependencyNode::affects()`.
+	topologyChanged();
 	pushDirtyPropagationScope();
 	if( node() )
 	{
@@ -685,6 +705,7 @@ void Plug::parentChanging( Gaffer::GraphComponent *newParent )
 void Plug::parentChanged( Gaffer::GraphComponent *oldParent )
 {
 	GraphComponent::parentChanged( oldParent );
+	topologyChanged();
 
 	if( node() )
 	{
@@ -737,7 +758,7 @@ class Plug::DirtyPlugs
 	public :
 
 		DirtyPlugs()
-			:	m_scopeCount( 0 ), m_emitting( false )
+			:	m_scopeCount( 0 ), m_emitting( false ), m_closuresGeneration( g_topologyGeneration ), m_closuresSize( 0 )
 		{
 		}
 
@@ -755,28 +776,8 @@ class Plug::DirtyPlugs
 				return;
 			}
 
-			for( DownstreamIterator it( plugToDirty ); !it.done(); ++it )
-			{
-				// The `const_casts()` are harmless because we're starting iteration from
-				// a non-const plug. But they are necessary because DownstreamIterator
-				// doesn't currently have a non-const form, and always yields const plugs.
-				InsertedVertex v = insertVertex( const_cast<Plug *>( &*it ) );
-				if( !it->getFlags( Plug::AcceptsDependencyCycles ) )
-				{
-					add_edge(
-						v.first,
-						insertVertex( const_cast<Plug *>( it.upstream() ) ).first,
-						m_graph
-					);
-				}
-
-				if( !v.second )
-				{
-					// Already visited this plug by another path,
-					// so we can prune the iteration.
-					it.prune();
-				}
-			}
+			const Closure &closure = downstreamClosure( plugToDirty );
+			insertClosure( closure, 0, closure.size() );
 		}
 
 		void pushScope()
@@ -867,9 +868,153 @@ class Plug::DirtyPlugs
 			return InsertedVertex( result, true );
 		}
 
+		// Downstream closures
+		// ===================
+		//
+		// Visiting the dependents of a plug with DownstreamIterator requires
+		// many calls to `DependencyNode::affects()`, and tends to be repeated
+		// for the same plugs over and over again, as the user edits a value or
+		// scrubs the timeline. We therefore cache the results of the traversal
+		// for each plug, and replay them in `insert()` for as long as the
+		// topology of the graph remains unchanged.
+
+		struct ClosureEntry
+		{
+			// Plug yielded by the DownstreamIterator.
+			Plug *plug;
+			// The plug that dirtied `plug`, or null if `plug` accepts
+			// dependency cycles and no edge should be recorded.
+			Plug *upstream;
+			// Index of the first entry after the dependents of `plug`.
+			size_t end;
+			// Index of the entry followed by the dependents of `plug`.
+			// This differs from the entry's own index when `plug`
+			// was visited previously by another path.
+			size_t dependents;
+		};
+		using Closure = std::vector<ClosureEntry>;
+
+		const Closure &downstreamClosure( Plug *plug )
+		{
+			const uint64_t generation = g_topologyGeneration;
+			if( generation != m_closuresGeneration || m_closuresSize > g_maxClosuresSize )
+			{
+				Closures emptyClosures;
+				m_closures.swap( emptyClosures );
+				m_closuresGeneration = generation;
+				m_closuresSize = 0;
+			}
+
+			auto inserted = m_closures.insert( { plug, Closure() } );
+			Closure &closure = inserted.first->second;
+			if( !inserted.second )
+			{
+				return closure;
+			}
+
+			// Record the traversal in depth-first order, storing the
+			// first visit of each plug so that repeat visits can refer
+			// back to it.
+
+			std::vector<size_t> depths;
+			std::unordered_map<const Plug *, size_t> visited;
+			visited[plug] = std::numeric_limits<size_t>::max();
+			for( DownstreamIterator it( plug ); !it.done(); ++it )
+			{
+				// The `const_casts()` are harmless because we're starting iteration from
+				// a non-const plug. But they are necessary because DownstreamIterator
+				// doesn't currently have a non-const form, and always yields const plugs.
+				const size_t index = closure.size();
+				closure.push_back( {
+					const_cast<Plug *>( &*it ),
+					it->getFlags( Plug::AcceptsDependencyCycles ) ? nullptr : const_cast<Plug *>( it.upstream() ),
+					index + 1,
+					index
+				} );
+				depths.push_back( it.depth() );
+
+				auto v = visited.insert( { &*it, index } );
+				if( !v.second )
+				{
+					// Already visited this plug by another path,
+					// so we can prune the iteration.
+					if( v.first->second != std::numeric_limits<size_t>::max() )
+					{
+						closure.back().dependents = v.first->second;
+					}
+					it.prune();
+				}
+			}
+
+			// The dependents of each entry are all the entries following it
+			// with a greater depth.
+			std::vector<size_t> stack;
+			for( size_t i = 0; i < closure.size(); ++i )
+			{
+				while( stack.size() && depths[stack.back()] >= depths[i] )
+				{
+					closure[stack.back()].end = i;
+					stack.pop_back();
+				}
+				stack.push_back( i );
+			}
+			for( auto i : stack )
+			{
+				closure[i].end = closure.size();
+			}
+
+			m_closuresSize += closure.size();
+			return closure;
+		}
+
+		// Inserts the entries in the range `[begin, end)`, skipping the
+		// dependents of any plug that has already been inserted.
+		void insertClosure( const Closure &closure, size_t begin, size_t end )
+		{
+			for( size_t i = begin; i < end; )
+			{
+				const ClosureEntry &entry = closure[i];
+				InsertedVertex v = insertVertex( entry.plug );
+				if( entry.upstream )
+				{
+					add_edge( v.first, insertVertex( entry.upstream ).first, m_graph );
+				}
+
+				if( !v.second )
+				{
+					// Already visited this plug by another path,
+					// so we can skip its dependents.
+					i = entry.end;
+					continue;
+				}
+
+				if( entry.dependents != i )
+				{
+					// First visit in this propagation, but the dependents
+					// were recorded against an earlier visit.
+					insertClosure( closure, entry.dependents + 1, closure[entry.dependents].end );
+				}
+				i++;
+			}
+		}
+
+		// Emission
+		// ========
+
+		// Nodes are held by reference, because `plugDirtiedSignal()` slots
+		// may cause them to be deleted before `plugsDirtiedSignal()` is
+		// emitted. This also means a node's address can't be reused by
+		// another node while it is in `nodeIndices`.
+		typedef std::vector<std::pair<NodePtr, std::vector<Plug *>>> NodePlugs;
+
 		struct EmitVisitor : public default_dfs_visitor
 		{
 
+			EmitVisitor( NodePlugs &nodePlugs, std::unordered_map<const Node *, size_t> &nodeIndices )
+				:	m_nodePlugs( nodePlugs ), m_nodeIndices( nodeIndices )
+			{
+			}
+
 			void back_edge( const EdgeDescriptor &e, const Graph &graph )
 			{
 				IECore::msg(
@@ -885,12 +1030,28 @@ class Plug::DirtyPlugs
 			void finish_vertex( const VertexDescriptor &u, const Graph &graph )
 			{
 				Plug *plug = graph[u].get();
-				if( Node *node = plug->node() )
+				if( NodePtr node = plug->node() )
 				{
-					node->plugDirtiedSignal()( plug );
+					if( !node->plugDirtiedSignal().empty() )
+					{
+						node->plugDirtiedSignal()( plug );
+					}
+
+					// Accumulate plugs for `plugsDirtiedSignal()`.
+					auto inserted = m_nodeIndices.insert( { node.get(), m_nodePlugs.size() } );
+					if( inserted.second )
+					{
+						m_nodePlugs.push_back( { node, {} } );
+					}
+					m_nodePlugs[inserted.first->second].second.push_back( plug );
 				}
 			}
 
+			private :
+
+				NodePlugs &m_nodePlugs;
+				std::unordered_map<const Node *, size_t> &m_nodeIndices;
+
 		};
 
 		void emit()
@@ -919,7 +1080,13 @@ class Plug::DirtyPlugs
 
 			try
 			{
-				depth_first_search( m_graph, visitor( EmitVisitor() ) );
+				NodePlugs nodePlugs;
+				std::unordered_map<const Node *, size_t> nodeIndices;
+				depth_first_search( m_graph, visitor( EmitVisitor( nodePlugs, nodeIndices ) ) );
+				for( const auto &n : nodePlugs )
+				{
+					n.first->plugsDirtiedSignal()( n.second );
+				}
 			}
 			catch( const std::exception &e )
 			{
@@ -952,6 +1119,14 @@ class Plug::DirtyPlugs
 		size_t m_scopeCount;
 		bool m_emitting;
 
+		// Raw pointers are safe because `topologyChanged()` is called
+		// when any plug is destroyed, and we discard the closures when
+		// that happens.
+		using Closures = std::unordered_map<const Plug *, Closure>;
+		Closures m_closures;
+		uint64_t m_closuresGeneration;
+		size_t m_closuresSize;
+
 };
 
 void Plug::propagateDirtiness( Plug *plugToDirty )
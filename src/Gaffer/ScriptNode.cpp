@@ -44,6 +44,7 @@
 #include "Gaffer/Context.h"
 #include "Gaffer/DependencyNode.h"
 #include "Gaffer/MetadataAlgo.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
 #include "Gaffer/StandardSet.h"
 #include "Gaffer/StringPlug.h"
 #include "Gaffer/TypedPlug.h"
@@ -58,6 +59,9 @@
 #include "boost/filesystem/path.hpp"
 
 #include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
 
 #include <unistd.h>
 
@@ -204,14 +208,32 @@ IE_CORE_DEFINERUNTIMETYPED( ScriptNode::CompoundAction );
 namespace
 {
 
+bool isBinaryFileName( const std::string &fileName )
+{
+	return boost::filesystem::path( fileName ).extension() == ".gfrb";
+}
+
 std::string readFile( const std::string &fileName )
 {
-	std::ifstream f( fileName.c_str() );
+	const bool binary = isBinaryFileName( fileName );
+	std::ifstream f( fileName.c_str(), binary ? std::ios::in | std::ios::binary : std::ios::in );
 	if( !f.good() )
 	{
 		throw IECore::IOException( "Unable to open file \"" + fileName + "\"" );
 	}
 
+	if( binary )
+	{
+		// Binary serialisations must be read verbatim, without
+		// any line-based processing.
+		std::string s( ( std::istreambuf_iterator<char>( f ) ), std::istreambuf_iterator<char>() );
+		if( f.bad() )
+		{
+			throw IECore::IOException( "Failed to read from \"" + fileName + "\"" );
+		}
+		return s;
+	}
+
 	std::string s;
 	while( !f.eof() )
 	{
@@ -228,6 +250,56 @@ std::string readFile( const std::string &fileName )
 	return s;
 }
 
+// The same file is often executed many times, most commonly when a
+// script contains many References to the same asset. Compilation is
+// a significant fraction of the execution cost, so we share compiled
+// serialisations between calls. The cache is keyed on the contents
+// of the file, so that edits are always seen.
+
+typedef std::shared_ptr<const std::string> ConstCompiledSerialisationPtr;
+
+struct CompiledSerialisationCacheGetterKey
+{
+
+	CompiledSerialisationCacheGetterKey( const std::string &serialisation, const std::function<std::string ( const std::string & )> &compileFunction )
+		:	serialisation( serialisation ), compileFunction( compileFunction )
+	{
+		hash.append( serialisation );
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return hash;
+	}
+
+	const std::string &serialisation;
+	const std::function<std::string ( const std::string & )> &compileFunction;
+	IECore::MurmurHash hash;
+
+};
+
+ConstCompiledSerialisationPtr compiledSerialisationGetter( const CompiledSerialisationCacheGetterKey &key, size_t &cost )
+{
+	std::string compiled;
+	try
+	{
+		compiled = key.compileFunction( key.serialisation );
+	}
+	catch( ... )
+	{
+		// Syntax errors. Cache the original serialisation, so that
+		// execution can report the errors in the usual way.
+		compiled = key.serialisation;
+	}
+
+	cost = compiled.size();
+	return std::make_shared<const std::string>( std::move( compiled ) );
+}
+
+typedef IECorePreview::LRUCache<IECore::MurmurHash, ConstCompiledSerialisationPtr, IECorePreview::LRUCachePolicy::Parallel, CompiledSerialisationCacheGetterKey> CompiledSerialisationCache;
+// Cache cost is in bytes
+CompiledSerialisationCache g_compiledSerialisationCache( compiledSerialisationGetter, 1024 * 1024 * 100 );
+
 const IECore::InternedString g_scriptName( "script:name" );
 const IECore::InternedString g_frame( "frame" );
 const IECore::InternedString g_frameStart( "frameRange:start" );
@@ -245,6 +317,7 @@ GAFFER_NODE_DEFINE_TYPE( ScriptNode );
 size_t ScriptNode::g_firstPlugIndex = 0;
 ScriptNode::SerialiseFunction ScriptNode::g_serialiseFunction;
 ScriptNode::ExecuteFunction ScriptNode::g_executeFunction;
+ScriptNode::CompileFunction ScriptNode::g_compileFunction;
 
 ScriptNode::ScriptNode( const std::string &name )
 	:
@@ -680,7 +753,17 @@ void ScriptNode::serialiseToFile( const std::string &fileName, const Node *paren
 {
 	std::string s = serialiseInternal( parent, filter );
 
-	std::ofstream f( fileName.c_str() );
+	const bool binary = isBinaryFileName( fileName );
+	if( binary )
+	{
+		if( !g_compileFunction )
+		{
+			throw IECore::Exception( "Binary serialisation not available - please link to libGafferBindings." );
+		}
+		s = g_compileFunction( s );
+	}
+
+	std::ofstream f( fileName.c_str(), binary ? std::ios::out | std::ios::binary : std::ios::out );
 	if( !f.good() )
 	{
 		throw IECore::IOException( "Unable to open file \"" + fileName + "\"" );
@@ -702,7 +785,16 @@ bool ScriptNode::execute( const std::string &serialisation, Node *parent, bool c
 bool ScriptNode::executeFile( const std::string &fileName, Node *parent, bool continueOnError )
 {
 	const std::string serialisation = readFile( fileName );
-	return executeInternal( serialisation, parent, continueOnError, fileName );
+	if( !g_compileFunction || isBinaryFileName( fileName ) )
+	{
+		return executeInternal( serialisation, parent, continueOnError, fileName );
+	}
+
+	// Share compilation between repeated executions of the same file.
+	// See `compiledSerialisationGetter()`.
+	CompiledSerialisationCacheGetterKey key( serialisation, g_compileFunction );
+	ConstCompiledSerialisationPtr compiled = g_compiledSerialisationCache.get( key );
+	return executeInternal( *compiled, parent, continueOnError, fileName );
 }
 
 bool ScriptNode::load( bool continueOnError)
@@ -48,6 +48,8 @@
 #include "boost/multi_index_container.hpp"
 #include "boost/variant.hpp"
 
+#include <limits>
+#include <memory>
 #include <unordered_map>
 
 using namespace std;
@@ -79,6 +81,398 @@ void appendLeafPlugs( const Gaffer::Plug *p, DependencyNode::AffectedPlugsContai
 	}
 }
 
+const size_t g_noRow = std::numeric_limits<size_t>::max();
+InternedString g_ellipsis( "..." );
+
+// Compiled form of the `StringAlgo::matchMultiple()` patterns for a set
+// of rows, used to find the first row matching a string without testing
+// each row in turn. The patterns are stored in a trie so that common
+// prefixes are shared, and each node records the lowest row index
+// beneath it, so that we can stop searching as soon as no better match
+// is possible.
+class NamePatternMatcher
+{
+
+	public :
+
+		NamePatternMatcher()
+			:	m_root( new Node )
+		{
+		}
+
+		// Rows must be added in order of increasing index. Returns false
+		// if `patterns` can't be compiled, in which case the caller must
+		// use `StringAlgo::matchMultiple()` instead.
+		bool add( const std::string &patterns, size_t index )
+		{
+			vector<vector<Element>> compiled;
+			if( !compile( patterns, compiled ) )
+			{
+				return false;
+			}
+
+			for( const auto &elements : compiled )
+			{
+				Node *node = m_root.get();
+				node->minIndex = std::min( node->minIndex, index );
+				for( const auto &element : elements )
+				{
+					node = node->child( element );
+					node->minIndex = std::min( node->minIndex, index );
+				}
+				node->terminalIndex = std::min( node->terminalIndex, index );
+			}
+			return true;
+		}
+
+		// Updates `result` if a row with a lower index matches `s`.
+		void match( const std::string &s, size_t &result ) const
+		{
+			match( *m_root, s.c_str(), result );
+		}
+
+	private :
+
+		struct Element
+		{
+			enum Type
+			{
+				Literal,
+				// `?` or `[...]`, matched using `StringAlgo::match()`.
+				Class,
+				Star
+			};
+
+			Type type;
+			char c;
+			std::string pattern;
+		};
+
+		struct Node
+		{
+
+			Node()
+				:	terminalIndex( g_noRow ), minIndex( g_noRow )
+			{
+			}
+
+			Node *child( const Element &element )
+			{
+				switch( element.type )
+				{
+					case Element::Literal : {
+						auto &c = literalChildren[element.c];
+						if( !c )
+						{
+							c.reset( new Node );
+						}
+						return c.get();
+					}
+					case Element::Class :
+						for( auto &c : classChildren )
+						{
+							if( c.first == element.pattern )
+							{
+								return c.second.get();
+							}
+						}
+						classChildren.push_back( { element.pattern, std::unique_ptr<Node>( new Node ) } );
+						return classChildren.back().second.get();
+					default :
+						if( !starChild )
+						{
+							starChild.reset( new Node );
+						}
+						return starChild.get();
+				}
+			}
+
+			size_t terminalIndex;
+			size_t minIndex;
+			std::unordered_map<char, std::unique_ptr<Node>> literalChildren;
+			// Because rows are added in index order, these are sorted
+			// by `minIndex`.
+			std::vector<std::pair<std::string, std::unique_ptr<Node>>> classChildren;
+			std::unique_ptr<Node> starChild;
+
+		};
+
+		// Splits space-separated patterns and compiles each into a sequence
+		// of elements. We conservatively reject anything where our
+		// interpretation might differ from `StringAlgo::matchMultiple()`.
+		static bool compile( const std::string &patterns, vector<vector<Element>> &result )
+		{
+			if( patterns.find( "\\ " ) != string::npos )
+			{
+				return false;
+			}
+
+			size_t start = 0;
+			while( true )
+			{
+				const size_t end = patterns.find( ' ', start );
+				const std::string pattern = patterns.substr( start, end == string::npos ? string::npos : end - start );
+				if( pattern.empty() )
+				{
+					return false;
+				}
+
+				result.push_back( vector<Element>() );
+				vector<Element> &elements = result.back();
+				for( size_t i = 0; i < pattern.size(); )
+				{
+					const char c = pattern[i];
+					if( c == '*' )
+					{
+						// Consecutive stars are equivalent to a single one.
+						if( elements.empty() || elements.back().type != Element::Star )
+						{
+							elements.push_back( { Element::Star, 0, "" } );
+						}
+						i++;
+					}
+					else if( c == '?' )
+					{
+						elements.push_back( { Element::Class, 0, "?" } );
+						i++;
+					}
+					else if( c == '[' )
+					{
+						size_t close = i + 1;
+						if( close < pattern.size() && pattern[close] == '!' )
+						{
+							close++;
+						}
+						close = pattern.find( ']', close );
+						if( close == string::npos || pattern[close-1] == '-' )
+						{
+							return false;
+						}
+						const std::string characterClass = pattern.substr( i, close - i + 1 );
+						if( characterClass.find( '\\' ) != string::npos )
+						{
+							return false;
+						}
+						elements.push_back( { Element::Class, 0, characterClass } );
+						i = close + 1;
+					}
+					else if( c == '\\' )
+					{
+						if( i + 1 >= pattern.size() )
+						{
+							return false;
+						}
+						elements.push_back( { Element::Literal, pattern[i+1], "" } );
+						i += 2;
+					}
+					else
+					{
+						elements.push_back( { Element::Literal, c, "" } );
+						i++;
+					}
+				}
+
+				if( end == string::npos )
+				{
+					break;
+				}
+				start = end + 1;
+			}
+
+			return true;
+		}
+
+		static void match( const Node &node, const char *s, size_t &result )
+		{
+			if( node.minIndex >= result )
+			{
+				return;
+			}
+
+			if( !*s )
+			{
+				result = std::min( result, node.terminalIndex );
+			}
+
+			if( node.starChild )
+			{
+				for( const char *c = s; ; ++c )
+				{
+					match( *node.starChild, c, result );
+					if( !*c )
+					{
+						break;
+					}
+				}
+			}
+
+			if( !*s )
+			{
+				return;
+			}
+
+			auto it = node.literalChildren.find( *s );
+			if( it != node.literalChildren.end() )
+			{
+				match( *it->second, s + 1, result );
+			}
+
+			const char c[2] = { *s, '\0' };
+			for( const auto &child : node.classChildren )
+			{
+				if( child.second->minIndex >= result )
+				{
+					break;
+				}
+				if( StringAlgo::match( c, child.first ) )
+				{
+					match( *child.second, s + 1, result );
+				}
+			}
+		}
+
+		std::unique_ptr<Node> m_root;
+
+};
+
+// As above, but compiling the `StringAlgo::MatchPatternPath` for
+// each row, for PathMatcher-style matching against paths.
+class PathPatternMatcher
+{
+
+	public :
+
+		PathPatternMatcher()
+			:	m_root( new Node )
+		{
+		}
+
+		// Rows must be added in order of increasing index.
+		void add( const StringAlgo::MatchPatternPath &path, size_t index )
+		{
+			Node *node = m_root.get();
+			node->minIndex = std::min( node->minIndex, index );
+			for( const auto &element : path )
+			{
+				node = node->child( element );
+				node->minIndex = std::min( node->minIndex, index );
+			}
+			node->terminalIndex = std::min( node->terminalIndex, index );
+		}
+
+		// Updates `result` if a row with a lower index matches `path`.
+		void match( const vector<InternedString> &path, size_t &result ) const
+		{
+			match( *m_root, path.begin(), path.end(), result );
+		}
+
+	private :
+
+		struct Node
+		{
+
+			Node()
+				:	terminalIndex( g_noRow ), minIndex( g_noRow )
+			{
+			}
+
+			Node *child( const InternedString &element )
+			{
+				if( element == g_ellipsis )
+				{
+					if( !ellipsisChild )
+					{
+						ellipsisChild.reset( new Node );
+					}
+					return ellipsisChild.get();
+				}
+				else if( StringAlgo::hasWildcards( element.c_str() ) )
+				{
+					for( auto &c : wildcardChildren )
+					{
+						if( c.first == element )
+						{
+							return c.second.get();
+						}
+					}
+					wildcardChildren.push_back( { element, std::unique_ptr<Node>( new Node ) } );
+					return wildcardChildren.back().second.get();
+				}
+				else
+				{
+					auto &c = plainChildren[element];
+					if( !c )
+					{
+						c.reset( new Node );
+					}
+					return c.get();
+				}
+			}
+
+			size_t terminalIndex;
+			size_t minIndex;
+			std::unordered_map<InternedString, std::unique_ptr<Node>> plainChildren;
+			// Sorted by `minIndex`, because rows are added in index order.
+			std::vector<std::pair<InternedString, std::unique_ptr<Node>>> wildcardChildren;
+			std::unique_ptr<Node> ellipsisChild;
+
+		};
+
+		using Iterator = vector<InternedString>::const_iterator;
+
+		static void match( const Node &node, Iterator begin, Iterator end, size_t &result )
+		{
+			if( node.minIndex >= result )
+			{
+				return;
+			}
+
+			if( begin == end )
+			{
+				result = std::min( result, node.terminalIndex );
+			}
+
+			if( node.ellipsisChild )
+			{
+				// Ellipsis matches any number of elements, including none.
+				for( Iterator it = begin; ; ++it )
+				{
+					match( *node.ellipsisChild, it, end, result );
+					if( it == end )
+					{
+						break;
+					}
+				}
+			}
+
+			if( begin == end )
+			{
+				return;
+			}
+
+			auto it = node.plainChildren.find( *begin );
+			if( it != node.plainChildren.end() )
+			{
+				match( *it->second, begin + 1, end, result );
+			}
+
+			for( const auto &child : node.wildcardChildren )
+			{
+				if( child.second->minIndex >= result )
+				{
+					break;
+				}
+				if( StringAlgo::match( begin->c_str(), child.first.c_str() ) )
+				{
+					match( *child.second, begin + 1, end, result );
+				}
+			}
+		}
+
+		std::unique_ptr<Node> m_root;
+
+};
+
 // Data type stored on `rowsMapPlug()` and used for quickly
 // finding the right row for a selector.
 class RowsMap : public IECore::Data
@@ -104,25 +498,19 @@ class RowsMap : public IECore::Data
 				const std::string name = row->namePlug()->getValue();
 				activeRowNames.push_back( name );
 
-				const bool hasWildcards = StringAlgo::hasWildcards( name );
-				if( hasWildcards || name.find( ' ' ) != string::npos )
+				if( StringAlgo::hasWildcards( name ) || name.find( ' ' ) != string::npos )
 				{
-					m_wildcardRows.push_back( { name, i } );
+					if( !m_wildcardRowsMatcher.add( name, i ) )
+					{
+						m_wildcardRows.push_back( { name, i } );
+					}
 				}
 				else
 				{
 					m_plainRows.insert( { name, i } );
 				}
 
-				const StringAlgo::MatchPatternPath path = StringAlgo::matchPatternPath( name );
-				if( hasWildcards || name.find( "..." ) != string::npos )
-				{
-					m_wildcardPathRows.push_back( { path, i } );
-				}
-				else
-				{
-					m_plainPathRows.insert( { path, i } );
-				}
+				m_pathRowsMatcher.add( StringAlgo::matchPatternPath( name ), i );
 			}
 		}
 
@@ -152,7 +540,7 @@ class RowsMap : public IECore::Data
 
 		size_t rowIndex( const Selector &selector ) const
 		{
-			size_t result = 0;
+			size_t result = g_noRow;
 			if( auto s = get<string>( &selector ) )
 			{
 				auto it = m_plainRows.find( *s );
@@ -160,9 +548,10 @@ class RowsMap : public IECore::Data
 				{
 					result = it->second;
 				}
+				m_wildcardRowsMatcher.match( *s, result );
 				for( auto &row : m_wildcardRows )
 				{
-					if( result && row.index > result )
+					if( row.index > result )
 					{
 						break;
 					}
@@ -176,26 +565,9 @@ class RowsMap : public IECore::Data
 			}
 			else if( auto p = get<const vector<InternedString> *>( selector ) )
 			{
-				auto it = m_plainPathRows.find( *p );
-				if( it != m_plainPathRows.end() )
-				{
-					result = it->second;
-				}
-				for( auto &row : m_wildcardPathRows )
-				{
-					if( result && row.index > result )
-					{
-						break;
-					}
-
-					if( StringAlgo::match( *p, row.path ) )
-					{
-						result = row.index;
-						break;
-					}
-				}
+				m_pathRowsMatcher.match( *p, result );
 			}
-			return result;
+			return result == g_noRow ? 0 : result;
 		}
 
 		const StringVectorData *activeRowNames() const
@@ -210,7 +582,11 @@ class RowsMap : public IECore::Data
 		using Map = std::unordered_map<std::string, size_t>;
 		Map m_plainRows;
 
-		// Rows with wildcards. These require a linear search.
+		// Rows with wildcards. These are compiled into a single matcher.
+		NamePatternMatcher m_wildcardRowsMatcher;
+
+		// Rows with wildcards that `NamePatternMatcher` doesn't support.
+		// These require a linear search.
 		struct Row
 		{
 			std::string name;
@@ -219,27 +595,9 @@ class RowsMap : public IECore::Data
 		using Vector = std::vector<Row>;
 		Vector m_wildcardRows;
 
-		// As above, but for when the selector is an InternedStringVectorData,
-		// in which case we want to use PathMatcher-style matching. We could do
-		// better here if we generalised the PathMatcher::Node data structure to
-		// allow us to store our `index` in place of the `bool terminator`. For
-		// now we assume that Spreadsheets with extreme numbers of rows will
-		// have only plain rows (as in EditScopes), and the PathMap will be
-		// sufficient. If this assumption plays out in practice, then a simpler
-		// implementation might just be to make `StringAlgo::match()` compatible
-		// with the behaviour of `*` and `...` in PathMatcher, so we can just
-		// use the original code path for everything . That would be a breaking
-		// change though.
-		using PathMap = std::map<StringAlgo::MatchPatternPath, size_t>;
-		PathMap m_plainPathRows;
-
-		struct PathRow
-		{
-			StringAlgo::MatchPatternPath path;
-			size_t index;
-		};
-		using PathVector = std::vector<PathRow>;
-		PathVector m_wildcardPathRows;
+		// All rows, for when the selector is an InternedStringVectorData, in
+		// which case we want to use PathMatcher-style matching.
+		PathPatternMatcher m_pathRowsMatcher;
 
 		// List of active row names for `activeRowNamesPlug()`.
 		StringVectorDataPtr m_activeRowNames;
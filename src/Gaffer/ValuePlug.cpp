@@ -48,9 +48,12 @@
 #include "boost/bind.hpp"
 #include "boost/format.hpp"
 
+#include "tbb/concurrent_hash_map.h"
 #include "tbb/enumerable_thread_specific.h"
 
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 
 using namespace Gaffer;
 
@@ -523,6 +526,60 @@ bool spawnsTasks( const ComputeProcessKey &key )
 	return key.cachePolicy == ValuePlug::CachePolicy::TaskCollaboration;
 }
 
+// Shared between the thread performing a Legacy compute and any
+// threads which request the same value while it is in flight.
+struct InFlightCompute
+{
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool done = false;
+	// Null if the compute failed or was cancelled.
+	IECore::ConstObjectPtr result;
+};
+
+typedef std::shared_ptr<InFlightCompute> InFlightComputePtr;
+typedef tbb::concurrent_hash_map<IECore::MurmurHash, InFlightComputePtr> InFlightComputes;
+
+// Represents the time spent waiting for another thread to
+// complete a compute on our behalf, so that it is visible
+// to the Monitor classes.
+class ComputeWaitProcess : public Process
+{
+
+	public :
+
+		ComputeWaitProcess( const ComputeProcessKey &key )
+			:	Process( staticType, key.plug, key.destinationPlug )
+		{
+		}
+
+		IECore::ConstObjectPtr wait( InFlightCompute &inFlight )
+		{
+			try
+			{
+				std::unique_lock<std::mutex> lock( inFlight.mutex );
+				while( !inFlight.done )
+				{
+					// Wake periodically so that we remain responsive to
+					// cancellation of our own context.
+					inFlight.condition.wait_for( lock, std::chrono::milliseconds( 10 ) );
+					IECore::Canceller::check( context()->canceller() );
+				}
+				return inFlight.result;
+			}
+			catch( ... )
+			{
+				handleException();
+			}
+			return nullptr;
+		}
+
+		static const IECore::InternedString staticType;
+
+};
+
+const IECore::InternedString ComputeWaitProcess::staticType( "computeNode:computeWait" );
+
 } // namespace
 
 class ValuePlug::ComputeProcess : public Process
@@ -578,36 +635,11 @@ class ValuePlug::ComputeProcess : public Process
 			}
 			else if( processKey.cachePolicy == CachePolicy::Legacy )
 			{
-				// Legacy code path, necessary until all task-spawning computes
-				// have declared an appropriate cache policy. We can't perform
-				// the compute inside `cacheGetter()` because that is called
-				// from inside a lock. If tasks were spawned without being
-				// isolated, TBB could steal an outer task which tries to get
-				// the same item from the cache, leading to deadlock.
 				if( auto result = g_cache.getIfCached( processKey ) )
 				{
 					return *result;
 				}
-				ComputeProcess process( processKey );
-				// Store the value in the cache, after first checking that this
-				// hasn't been done already. The check is useful because it's
-				// common for an upstream compute triggered by us to have
-				// already done the work, and calling memoryUsage() can be very
-				// expensive for some datatypes. A prime example of this is the
-				// attribute state passed around in GafferScene - it's common
-				// for a selective filter to mean that the attribute compute is
-				// implemented as a pass-through (thus an upstream node will
-				// already have computed the same result) and the attribute data
-				// itself consists of many small objects for which computing
-				// memory usage is slow.
-				/// \todo Accessing the LRUCache multiple times like this does
-				/// have an overhead, and at some point we'll need to address
-				/// that.
-				if( !g_cache.getIfCached( processKey ) )
-				{
-					g_cache.set( processKey, process.m_result, process.m_result->memoryUsage() );
-				}
-				return process.m_result;
+				return legacyValue( processKey );
 			}
 			else
 			{
@@ -637,7 +669,8 @@ class ValuePlug::ComputeProcess : public Process
 	private :
 
 		ComputeProcess( const ComputeProcessKey &key )
-			:	Process( staticType, key.plug, key.destinationPlug )
+			:	Process( staticType, key.plug, key.destinationPlug ),
+				m_legacyHash( key.cachePolicy == CachePolicy::Legacy ? static_cast<const IECore::MurmurHash &>( key ) : IECore::MurmurHash() )
 		{
 			try
 			{
@@ -671,6 +704,120 @@ class ValuePlug::ComputeProcess : public Process
 			}
 		}
 
+		// Legacy code path, necessary until all task-spawning computes
+		// have declared an appropriate cache policy. We can't perform
+		// the compute inside `cacheGetter()` because that is called
+		// from inside a lock. Instead we track in-flight computes
+		// ourselves, so that concurrent requests for the same value wait
+		// for a single computation rather than duplicating it.
+		static IECore::ConstObjectPtr legacyValue( const ComputeProcessKey &processKey )
+		{
+			const IECore::MurmurHash &hash = processKey;
+
+			InFlightComputePtr inFlight;
+			if( !computingOnThisChain( hash ) )
+			{
+				InFlightComputes::accessor accessor;
+				if( g_inFlightComputes.insert( accessor, hash ) )
+				{
+					inFlight = std::make_shared<InFlightCompute>();
+					accessor->second = inFlight;
+				}
+				else
+				{
+					InFlightComputePtr other = accessor->second;
+					accessor.release();
+					if( auto result = ComputeWaitProcess( processKey ).wait( *other ) )
+					{
+						return result;
+					}
+					// The other thread failed or was cancelled. Its
+					// context may not be ours, so we compute for ourselves.
+				}
+			}
+
+			IECore::ConstObjectPtr result;
+			try
+			{
+				// Another thread may have completed the compute between our
+				// first check of the cache and our registration above.
+				if( auto cachedResult = g_cache.getIfCached( processKey ) )
+				{
+					result = *cachedResult;
+				}
+				else
+				{
+					// The compute is isolated so that TBB can't steal an outer
+					// task which requests the same value while we are waiting for
+					// tasks spawned by the compute, leading to deadlock.
+					tbb::this_task_arena::isolate(
+						[&result, &processKey] {
+							ComputeProcess process( processKey );
+							result = process.m_result;
+						}
+					);
+					// Store the value in the cache, after first checking that this
+					// hasn't been done already. The check is useful because it's
+					// common for an upstream compute triggered by us to have
+					// already done the work, and calling memoryUsage() can be very
+					// expensive for some datatypes. A prime example of this is the
+					// attribute state passed around in GafferScene - it's common
+					// for a selective filter to mean that the attribute compute is
+					// implemented as a pass-through (thus an upstream node will
+					// already have computed the same result) and the attribute data
+					// itself consists of many small objects for which computing
+					// memory usage is slow.
+					/// \todo Accessing the LRUCache multiple times like this does
+					/// have an overhead, and at some point we'll need to address
+					/// that.
+					if( !g_cache.getIfCached( processKey ) )
+					{
+						g_cache.set( processKey, result, result->memoryUsage() );
+					}
+				}
+			}
+			catch( ... )
+			{
+				if( inFlight )
+				{
+					finishInFlight( hash, *inFlight, nullptr );
+				}
+				throw;
+			}
+
+			if( inFlight )
+			{
+				finishInFlight( hash, *inFlight, result );
+			}
+			return result;
+		}
+
+		// Returns true if a Legacy compute for `hash` is already being
+		// performed by the current process or one of its ancestors. This
+		// is common for pass-throughs, and waiting would deadlock.
+		static bool computingOnThisChain( const IECore::MurmurHash &hash )
+		{
+			for( const Process *p = Process::current(); p; p = p->parent() )
+			{
+				if( p->type() == staticType && static_cast<const ComputeProcess *>( p )->m_legacyHash == hash )
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		static void finishInFlight( const IECore::MurmurHash &hash, InFlightCompute &inFlight, const IECore::ConstObjectPtr &result )
+		{
+			{
+				std::lock_guard<std::mutex> lock( inFlight.mutex );
+				inFlight.done = true;
+				inFlight.result = result;
+			}
+			inFlight.condition.notify_all();
+			g_inFlightComputes.erase( hash );
+		}
+
 		static IECore::ConstObjectPtr cacheGetter( const ComputeProcessKey &key, size_t &cost )
 		{
 			IECore::ConstObjectPtr result;
@@ -714,12 +861,19 @@ class ValuePlug::ComputeProcess : public Process
 		typedef IECorePreview::LRUCache<IECore::MurmurHash, IECore::ConstObjectPtr, IECorePreview::LRUCachePolicy::TaskParallel, ComputeProcessKey> Cache;
 		static Cache g_cache;
 
+		// Legacy computes currently being performed, so that other
+		// threads can wait for them rather than duplicating the work.
+		static InFlightComputes g_inFlightComputes;
+
 		IECore::ConstObjectPtr m_result;
+		// Only set for the Legacy policy, for use by `computingOnThisChain()`.
+		const IECore::MurmurHash m_legacyHash;
 
 };
 
 const IECore::InternedString ValuePlug::ComputeProcess::staticType( "computeNode:compute" );
 ValuePlug::ComputeProcess::Cache ValuePlug::ComputeProcess::g_cache( cacheGetter, 1024 * 1024 * 1024 * 1, ValuePlug::ComputeProcess::Cache::RemovalCallback(), /* cacheErrors = */ false ); // 1 gig
+ValuePlug::ComputeProcess::InFlightComputes ValuePlug::ComputeProcess::g_inFlightComputes;
 
 //////////////////////////////////////////////////////////////////////////
 // SetValueAction implementation
@@ -136,6 +136,12 @@ void ColorProcessor::affects( const Gaffer::Plug *input, AffectedPlugsContainer
 	}
 }
 
+Imath::Box2i ColorProcessor::outputRegion( const ImagePlug *input, const Imath::Box2i &inputRegion ) const
+{
+	// Each output pixel depends only on the input pixel at the same location.
+	return input == inPlug() ? inputRegion : ImageProcessor::outputRegion( input, inputRegion );
+}
+
 void ColorProcessor::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	ImageProcessor::hash( output, context, h );
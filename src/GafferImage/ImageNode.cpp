@@ -324,3 +324,13 @@ void ImageNode::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outp
 		}
 	}
 }
+
+Imath::Box2i ImageNode::affectedRegion() const
+{
+	return ImagePlug::infiniteDataWindow();
+}
+
+Imath::Box2i ImageNode::outputRegion( const ImagePlug *input, const Imath::Box2i &inputRegion ) const
+{
+	return ImagePlug::infiniteDataWindow();
+}
@@ -659,6 +659,12 @@ void Merge::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs
 	}
 }
 
+Imath::Box2i Merge::outputRegion( const ImagePlug *input, const Imath::Box2i &inputRegion ) const
+{
+	// All operations are applied pixel by pixel.
+	return input->parent() == inPlugs() ? inputRegion : FlatImageProcessor::outputRegion( input, inputRegion );
+}
+
 void Merge::hashDataWindow( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	FlatImageProcessor::hashDataWindow( output, context, h );
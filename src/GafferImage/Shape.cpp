@@ -227,6 +227,27 @@ void Shape::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs
 
 }
 
+Imath::Box2i Shape::affectedRegion() const
+{
+	if( !enabledPlug()->getValue() )
+	{
+		return Box2i();
+	}
+
+	Box2i result = shapePlug()->dataWindowPlug()->getValue();
+	if( shadowPlug()->getValue() )
+	{
+		result.extendBy( getChild<ImageTransform>( "__shadowTransform" )->outPlug()->dataWindowPlug()->getValue() );
+	}
+	return result;
+}
+
+Imath::Box2i Shape::outputRegion( const ImagePlug *input, const Imath::Box2i &inputRegion ) const
+{
+	// The shape and shadow are merged over the input pixel by pixel.
+	return input == inPlug() ? inputRegion : FlatImageProcessor::outputRegion( input, inputRegion );
+}
+
 void Shape::hashDataWindow( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	assert( parent == shapePlug() );
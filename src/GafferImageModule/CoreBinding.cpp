@@ -63,6 +63,18 @@ using namespace GafferBindings;
 namespace
 {
 
+Imath::Box2i affectedRegion( const ImageNode &node )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return node.affectedRegion();
+}
+
+Imath::Box2i outputRegion( const ImageNode &node, const ImagePlug *input, const Imath::Box2i &inputRegion )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return node.outputRegion( input, inputRegion );
+}
+
 IECore::FloatVectorDataPtr channelData( const ImagePlug &plug,  const std::string &channelName, const Imath::V2i &tile, bool copy  )
 {
 	IECorePython::ScopedGILRelease gilRelease;
@@ -308,7 +320,10 @@ void GafferImageModule::bindCore()
 	;
 
 	typedef ComputeNodeWrapper<ImageNode> ImageNodeWrapper;
-	GafferBindings::DependencyNodeClass<ImageNode, ImageNodeWrapper>();
+	GafferBindings::DependencyNodeClass<ImageNode, ImageNodeWrapper>()
+		.def( "affectedRegion", &affectedRegion )
+		.def( "outputRegion", &outputRegion )
+	;
 
 	typedef ComputeNodeWrapper<FlatImageSource> FlatImageSourceWrapper;
 	GafferBindings::DependencyNodeClass<FlatImageSource, FlatImageSourceWrapper>();
@@ -112,6 +112,7 @@ void findUsableTextureFormats( GLenum &monochromeFormat, GLenum &colorFormat )
 }
 
 uint64_t g_tileUpdateCount;
+std::atomic<uint64_t> g_tileHashCount;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -435,6 +436,7 @@ void ImageGadget::setImage( GafferImage::ImagePlugPtr image )
 	/// \todo This is fragile. If we removed all the nodes from ImageGadget we would no longer need to
 	/// worry about this sort of thing.
 	m_deepStateNode->inPlug()->setInput( m_image );
+	m_regionRecords.clear();
 
 	if( Gaffer::Node *node = const_cast<Gaffer::Node *>( image->node() ) )
 	{
@@ -463,6 +465,7 @@ void ImageGadget::setContext( Gaffer::ContextPtr context )
 	m_context = context;
 	m_contextChangedConnection = m_context->changedSignal().connect( boost::bind( &ImageGadget::contextChanged, this, ::_2 ) );
 
+	m_regionRecords.clear();
 	m_shaderDirty = true;
 	dirty( AllDirty );
 }
@@ -673,9 +676,15 @@ uint64_t ImageGadget::tileUpdateCount()
 	return g_tileUpdateCount;
 }
 
+uint64_t ImageGadget::tileHashCount()
+{
+	return g_tileHashCount;
+}
+
 void ImageGadget::resetTileUpdateCount()
 {
 	g_tileUpdateCount = 0;
+	g_tileHashCount = 0;
 }
 
 ImageGadget::State ImageGadget::state() const
@@ -736,7 +745,7 @@ void ImageGadget::plugDirtied( const Gaffer::Plug *plug )
 	}
 	else if( plug == m_image->dataWindowPlug() )
 	{
-		dirty( DataWindowDirty | TilesDirty );
+		dirty( DataWindowDirty | ChannelDataDirty );
 	}
 	else if( plug == m_image->channelNamesPlug() )
 	{
@@ -744,7 +753,7 @@ void ImageGadget::plugDirtied( const Gaffer::Plug *plug )
 	}
 	else if( plug == m_image->channelDataPlug() )
 	{
-		dirty( TilesDirty );
+		dirty( ChannelDataDirty );
 	}
 }
 
@@ -752,6 +761,7 @@ void ImageGadget::contextChanged( const IECore::InternedString &name )
 {
 	if( !boost::starts_with( name.string(), "ui:" ) )
 	{
+		m_regionRecords.clear(); // Affected regions may be context-sensitive
 		m_shaderDirty = true; // Display transforms may be context-sensitive
 		dirty( AllDirty );
 	}
@@ -790,7 +800,7 @@ bool ImageGadget::usingGPU() const
 
 void ImageGadget::dirty( unsigned flags )
 {
-	if( (flags & TilesDirty) && !(m_dirtyFlags & TilesDirty) )
+	if( flags & ~m_dirtyFlags & ( TilesDirty | ChannelDataDirty ) )
 	{
 		m_tilesTask.reset();
 	}
@@ -898,6 +908,7 @@ ImageGadget::Tile::Tile( const Tile &other )
 ImageGadget::Tile::Update ImageGadget::Tile::computeUpdate( const GafferImage::ImagePlug *image )
 {
 	const IECore::MurmurHash h = image->channelDataPlug()->hash();
+	g_tileHashCount++;
 	Mutex::scoped_lock lock( m_mutex );
 	if( m_channelDataHash != MurmurHash() && m_channelDataHash == h )
 	{
@@ -1001,7 +1012,7 @@ inline size_t GafferImageUI::tbb_hasher( const ImageGadget::TileIndex &tileIndex
 
 void ImageGadget::updateTiles()
 {
-	if( !(m_dirtyFlags & TilesDirty) )
+	if( !(m_dirtyFlags & ( TilesDirty | ChannelDataDirty ) ) )
 	{
 		return;
 	}
@@ -1064,6 +1075,23 @@ void ImageGadget::updateTiles()
 
 	const Box2i dataWindow = this->dataWindow();
 
+	// Decide which tiles to update. We always walk upstream, even when
+	// everything needs updating, so that the region records are ready
+	// for the next edit.
+
+	const Box2i editRegion = dirtyRegion();
+	if( ( m_dirtyFlags & TilesDirty ) || !BufferAlgo::contains( m_tilesDataWindow, dataWindow ) )
+	{
+		// Tiles entering the data window have never been updated.
+		m_pendingRegion = ImagePlug::infiniteDataWindow();
+	}
+	else
+	{
+		m_pendingRegion.extendBy( editRegion );
+	}
+
+	const Box2i updateWindow = BufferAlgo::intersection( dataWindow, m_pendingRegion );
+
 	// Do the actual work of generating the tiles asynchronously,
 	// in the background.
 
@@ -1107,9 +1135,11 @@ void ImageGadget::updateTiles()
 		m_image.get(),
 		// OK to capture `this` via raw pointer, because ~ImageGadget waits for
 		// the background process to complete.
-		[this, channelsToCompute, dataWindow, tileFunctor, tilesImage] {
-			ImageAlgo::parallelProcessTiles( tilesImage, tileFunctor, dataWindow );
-			m_dirtyFlags &= ~TilesDirty;
+		[this, dataWindow, updateWindow, tileFunctor, tilesImage] {
+			ImageAlgo::parallelProcessTiles( tilesImage, tileFunctor, updateWindow );
+			m_dirtyFlags &= ~( TilesDirty | ChannelDataDirty );
+			m_pendingRegion = Box2i();
+			m_tilesDataWindow = dataWindow;
 			if( refCount() )
 			{
 				ImageGadgetPtr thisRef = this;
@@ -1119,7 +1149,10 @@ void ImageGadget::updateTiles()
 					}
 				);
 			}
-		}
+		},
+		// The user is looking at the Viewer, waiting for
+		// the tiles to appear.
+		BackgroundTask::Interactive
 	);
 
 }
@@ -1149,6 +1182,136 @@ void ImageGadget::removeOutOfBoundsTiles() const
 	}
 }
 
+Imath::Box2i ImageGadget::dirtyRegion()
+{
+	// Discard records for plugs which have since been removed
+	// from the graph.
+	for( auto it = m_regionRecords.begin(); it != m_regionRecords.end(); )
+	{
+		if( !it->second.plug->parent() )
+		{
+			it = m_regionRecords.erase( it );
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	if( !m_image )
+	{
+		return Box2i();
+	}
+
+	Context::Scope scopedContext( m_context.get() );
+	VisitedRegions visited;
+	return dirtyRegionWalk( m_image.get(), visited );
+}
+
+Imath::Box2i ImageGadget::dirtyRegionWalk( const GafferImage::ImagePlug *plug, VisitedRegions &visited )
+{
+	auto visitedIt = visited.find( plug );
+	if( visitedIt != visited.end() )
+	{
+		return visitedIt->second;
+	}
+
+	Box2i result;
+
+	const uint64_t dirtyCount = plug->channelDataPlug()->dirtyCount();
+	const Plug *input = plug->getInput();
+
+	auto inserted = m_regionRecords.insert( { plug, RegionRecord() } );
+	RegionRecord &record = inserted.first->second;
+	if( inserted.second )
+	{
+		// We know nothing of the plug's previous state, so must assume
+		// that everything has changed. We still walk upstream though, to
+		// initialise the records we'll need next time.
+		record.plug = plug;
+		result = ImagePlug::infiniteDataWindow();
+	}
+	else if( record.dirtyCount == dirtyCount )
+	{
+		// Nothing upstream has been dirtied since the last walk.
+		visited[plug] = result;
+		return result;
+	}
+	else if( record.input != input )
+	{
+		result = ImagePlug::infiniteDataWindow();
+	}
+
+	record.dirtyCount = dirtyCount;
+	record.input = input;
+
+	const ImageNode *node = runTimeCast<const ImageNode>( plug->node() );
+	if( node && plug == node->outPlug() )
+	{
+		// Edits to the node's own plugs affect the regions it modifies both
+		// before and after the edit. We detect edits using the dirty counts,
+		// which also account for changes further upstream of those plugs.
+		MurmurHash settingsHash;
+		for( RecursiveInputPlugIterator it( node ); !it.done(); ++it )
+		{
+			if( runTimeCast<const ImagePlug>( it->get() ) )
+			{
+				it.prune();
+			}
+			else if( auto valuePlug = runTimeCast<const ValuePlug>( it->get() ) )
+			{
+				settingsHash.append( (uint64_t)valuePlug );
+				settingsHash.append( valuePlug->dirtyCount() );
+			}
+		}
+
+		if( settingsHash != record.settingsHash )
+		{
+			result.extendBy( record.affectedRegion );
+			record.settingsHash = settingsHash;
+			try
+			{
+				record.affectedRegion = node->affectedRegion();
+			}
+			catch( ... )
+			{
+				record.affectedRegion = ImagePlug::infiniteDataWindow();
+			}
+			result.extendBy( record.affectedRegion );
+		}
+
+		// Edits upstream are mapped through the node.
+		for( RecursiveInputImagePlugIterator it( node ); !it.done(); ++it )
+		{
+			const Box2i inputRegion = dirtyRegionWalk( it->get(), visited );
+			if( BufferAlgo::empty( inputRegion ) )
+			{
+				continue;
+			}
+			try
+			{
+				result.extendBy( node->outputRegion( it->get(), inputRegion ) );
+			}
+			catch( ... )
+			{
+				result = ImagePlug::infiniteDataWindow();
+			}
+		}
+	}
+	else if( auto inputImage = runTimeCast<const ImagePlug>( input ) )
+	{
+		result.extendBy( dirtyRegionWalk( inputImage, visited ) );
+	}
+	else
+	{
+		// We don't know where the data comes from.
+		result = ImagePlug::infiniteDataWindow();
+	}
+
+	visited[plug] = result;
+	return result;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Rendering
 //////////////////////////////////////////////////////////////////////////
@@ -112,6 +112,8 @@ void GafferImageUIModule::bindImageGadget()
 		.def( "getPaused", &ImageGadget::getPaused )
 		.def( "tileUpdateCount", &ImageGadget::tileUpdateCount )
 		.staticmethod( "tileUpdateCount" )
+		.def( "tileHashCount", &ImageGadget::tileHashCount )
+		.staticmethod( "tileHashCount" )
 		.def( "resetTileUpdateCount", &ImageGadget::resetTileUpdateCount )
 		.staticmethod( "resetTileUpdateCount" )
 		.def( "state", &ImageGadget::state )
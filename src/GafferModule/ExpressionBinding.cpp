@@ -38,6 +38,8 @@
 
 #include "ExpressionBinding.h"
 
+#include "NativeExpression.h"
+
 #include "GafferBindings/DependencyNodeBinding.h"
 #include "GafferBindings/SignalBinding.h"
 
@@ -117,6 +119,7 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 
 		void parse( Expression *node, const std::string &expression, std::vector<ValuePlug *> &inputs, std::vector<ValuePlug *> &outputs, std::vector<IECore::InternedString> &contextVariables ) override
 		{
+			m_nativeExpression.reset();
 			if( isSubclassed() )
 			{
 				IECorePython::ScopedGILLock gilLock;
@@ -145,6 +148,16 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 
 		IECore::ConstObjectVectorPtr execute( const Context *context, const std::vector<const ValuePlug *> &proxyInputs ) const override
 		{
+			if( m_nativeExpression )
+			{
+				// Fast path, evaluated without the GIL. Returns null
+				// if the Python implementation is needed after all.
+				if( IECore::ConstObjectVectorPtr result = m_nativeExpression->execute( context, proxyInputs ) )
+				{
+					return result;
+				}
+			}
+
 			if( isSubclassed() )
 			{
 				IECorePython::ScopedGILLock gilLock;
@@ -174,6 +187,11 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 
 		void apply( ValuePlug *proxyOutput, const ValuePlug *topLevelProxyOutput, const IECore::Object *value ) const override
 		{
+			if( m_nativeExpression && GafferModule::NativeExpression::apply( proxyOutput, topLevelProxyOutput, value ) )
+			{
+				return;
+			}
+
 			if( isSubclassed() )
 			{
 				IECorePython::ScopedGILLock gilLock;
@@ -275,6 +293,25 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 		}
 
 
+		// Called by Python engines from `parse()`, to provide a native
+		// implementation of `execute()` and `apply()` where the expression
+		// is simple enough to support it.
+		static bool compileNative( Expression::Engine &engine, Expression &node, const std::string &expression, object pythonInputs, object pythonOutputs )
+		{
+			EngineWrapper *wrapper = dynamic_cast<EngineWrapper *>( &engine );
+			if( !wrapper )
+			{
+				return false;
+			}
+
+			std::vector<ValuePlug *> inputs, outputs;
+			container_utils::extend_container( inputs, pythonInputs );
+			container_utils::extend_container( outputs, pythonOutputs );
+
+			wrapper->m_nativeExpression = GafferModule::NativeExpression::compile( &node, expression, inputs, outputs );
+			return static_cast<bool>( wrapper->m_nativeExpression );
+		}
+
 		static void registerEngine( const std::string &engineType, object creator )
 		{
 			Expression::Engine::registerEngine( engineType, ExpressionEngineCreator( creator ) );
@@ -292,6 +329,10 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 			return boost::python::tuple( l );
 		}
 
+	private :
+
+		std::unique_ptr<const GafferModule::NativeExpression> m_nativeExpression;
+
 };
 
 static tuple languages()
@@ -368,6 +409,7 @@ void GafferModule::bindExpression()
 
 	IECorePython::RefCountedClass<Expression::Engine, IECore::RefCounted, EngineWrapper>( "Engine" )
 		.def( init<>() )
+		.def( "_compileNative", &EngineWrapper::compileNative )
 		.def( "registerEngine", &EngineWrapper::registerEngine ).staticmethod( "registerEngine" )
 		.def( "registeredEngines", &EngineWrapper::registeredEngines ).staticmethod( "registeredEngines" )
 	;
@@ -0,0 +1,2311 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2021, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#include "boost/python.hpp" // For PY_MAJOR_VERSION
+
+#include "NativeExpression.h"
+
+#include "Gaffer/NumericPlug.h"
+#include "Gaffer/StringPlug.h"
+#include "Gaffer/TypedPlug.h"
+
+#include "IECore/NullObject.h"
+#include "IECore/SimpleTypedData.h"
+
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace std;
+using namespace IECore;
+using namespace Gaffer;
+using namespace GafferModule;
+
+//////////////////////////////////////////////////////////////////////////
+// Values
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Thrown whenever we encounter something we don't support natively, both
+// during compilation and evaluation. Evaluation errors are reported the same
+// way, so that we can defer to Python to raise the appropriate exception.
+struct Unsupported
+{
+};
+
+// Equivalent to the subset of Python values we support.
+struct Value
+{
+
+	enum Type
+	{
+		None,
+		Bool,
+		Int,
+		Float,
+		String
+	};
+
+	Value() : type( None ), i( 0 ), f( 0.0 ) {}
+
+	static Value fromBool( bool b ) { Value v; v.type = Bool; v.i = b; return v; }
+	static Value fromInt( int64_t i ) { Value v; v.type = Int; v.i = i; return v; }
+	static Value fromFloat( double f ) { Value v; v.type = Float; v.f = f; return v; }
+	static Value fromString( std::string s ) { Value v; v.type = String; v.s = std::move( s ); return v; }
+
+	bool isNumeric() const { return type == Bool || type == Int || type == Float; }
+	// Python treats bools as ints in arithmetic.
+	bool isIntegral() const { return type == Bool || type == Int; }
+	double asFloat() const { return type == Float ? f : (double)i; }
+
+	Type type;
+	int64_t i;
+	double f;
+	std::string s;
+
+};
+
+bool truth( const Value &v )
+{
+	switch( v.type )
+	{
+		case Value::Bool :
+		case Value::Int :
+			return v.i != 0;
+		case Value::Float :
+			return v.f != 0.0;
+		case Value::String :
+			return !v.s.empty();
+		default :
+			return false;
+	}
+}
+
+bool isASCII( const std::string &s )
+{
+	for( char c : s )
+	{
+		if( (unsigned char)c > 127 )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+template<typename... Args>
+std::string formatC( const std::string &format, Args... args )
+{
+	const int size = snprintf( nullptr, 0, format.c_str(), args... );
+	if( size < 0 )
+	{
+		throw Unsupported();
+	}
+	std::string result( size, '\0' );
+	snprintf( &result[0], size + 1, format.c_str(), args... );
+	return result;
+}
+
+// Equivalent to Python's `str( float )`.
+std::string floatToString( double f )
+{
+	if( std::isnan( f ) )
+	{
+		return "nan";
+	}
+	else if( std::isinf( f ) )
+	{
+		return f > 0 ? "inf" : "-inf";
+	}
+
+#if PY_MAJOR_VERSION >= 3
+
+	// Find the shortest representation which round-trips.
+	char buffer[32];
+	for( int precision = 1; precision <= 17; ++precision )
+	{
+		snprintf( buffer, sizeof( buffer ), "%.*e", precision - 1, f );
+		if( strtod( buffer, nullptr ) == f )
+		{
+			break;
+		}
+	}
+
+	// Buffer is of the form `[-]d.ddde[+-]xx`. Extract the
+	// digits and exponent and reformat as Python does.
+
+	const char *c = buffer;
+	std::string result;
+	if( *c == '-' )
+	{
+		result = "-";
+		c++;
+	}
+
+	std::string digits;
+	for( ; *c != 'e'; ++c )
+	{
+		if( *c != '.' )
+		{
+			digits += *c;
+		}
+	}
+	const int exponent = atoi( c + 1 );
+	while( digits.size() > 1 && digits.back() == '0' )
+	{
+		digits.pop_back();
+	}
+
+	if( exponent >= 16 || exponent < -4 )
+	{
+		result += digits.substr( 0, 1 );
+		if( digits.size() > 1 )
+		{
+			result += "." + digits.substr( 1 );
+		}
+		result += formatC( "e%c%02d", exponent < 0 ? '-' : '+', std::abs( exponent ) );
+	}
+	else if( exponent >= 0 )
+	{
+		if( (int)digits.size() <= exponent + 1 )
+		{
+			result += digits + std::string( exponent + 1 - digits.size(), '0' ) + ".0";
+		}
+		else
+		{
+			result += digits.substr( 0, exponent + 1 ) + "." + digits.substr( exponent + 1 );
+		}
+	}
+	else
+	{
+		result += "0." + std::string( -exponent - 1, '0' ) + digits;
+	}
+
+	return result;
+
+#else
+
+	std::string result = formatC( "%.12g", f );
+	if( result.find_first_of( ".e" ) == std::string::npos )
+	{
+		result += ".0";
+	}
+	return result;
+
+#endif
+}
+
+// Equivalent to Python's `str()`.
+std::string toString( const Value &v )
+{
+	switch( v.type )
+	{
+		case Value::None :
+			return "None";
+		case Value::Bool :
+			return v.i ? "True" : "False";
+		case Value::Int :
+			return std::to_string( v.i );
+		case Value::Float :
+			return floatToString( v.f );
+		default :
+			return v.s;
+	}
+}
+
+int64_t floatToInt( double f )
+{
+	if( !std::isfinite( f ) )
+	{
+		throw Unsupported();
+	}
+	const double t = std::trunc( f );
+	if( t < -9.2233720368547758e18 || t >= 9.2233720368547758e18 )
+	{
+		throw Unsupported();
+	}
+	return (int64_t)t;
+}
+
+// Equivalent to Python's `str % args`.
+std::string percentFormat( const std::string &format, const std::vector<Value> &args )
+{
+	std::string result;
+	size_t argIndex = 0;
+	const size_t size = format.size();
+	for( size_t i = 0; i < size; ++i )
+	{
+		if( format[i] != '%' )
+		{
+			result += format[i];
+			continue;
+		}
+
+		if( ++i >= size )
+		{
+			throw Unsupported();
+		}
+
+		if( format[i] == '%' )
+		{
+			result += '%';
+			continue;
+		}
+
+		std::string flags;
+		while( i < size && strchr( "-+ #0", format[i] ) )
+		{
+			flags += format[i++];
+		}
+
+		std::string widthAndPrecision;
+		while( i < size && ( isdigit( format[i] ) || format[i] == '.' ) )
+		{
+			widthAndPrecision += format[i++];
+		}
+
+		if( i >= size || argIndex >= args.size() )
+		{
+			throw Unsupported();
+		}
+
+		const Value &arg = args[argIndex++];
+		const std::string spec = "%" + flags + widthAndPrecision;
+		const char conversion = format[i];
+		switch( conversion )
+		{
+			case 'd' :
+			case 'i' :
+			case 'u' : {
+				int64_t v;
+				if( arg.isIntegral() )
+				{
+					v = arg.i;
+				}
+				else if( arg.type == Value::Float )
+				{
+					v = floatToInt( arg.f );
+				}
+				else
+				{
+					throw Unsupported();
+				}
+				result += formatC( spec + "lld", (long long)v );
+				break;
+			}
+			case 'x' :
+			case 'X' :
+				if( !arg.isIntegral() || arg.i < 0 )
+				{
+					throw Unsupported();
+				}
+				result += formatC( spec + "ll" + conversion, (long long)arg.i );
+				break;
+			case 'e' :
+			case 'E' :
+			case 'f' :
+			case 'F' :
+			case 'g' :
+			case 'G' :
+				if( !arg.isNumeric() )
+				{
+					throw Unsupported();
+				}
+				result += formatC( spec + conversion, arg.asFloat() );
+				break;
+			case 's' : {
+				const std::string s = toString( arg );
+				if( flags.find( '0' ) != std::string::npos || ( !widthAndPrecision.empty() && !isASCII( s ) ) )
+				{
+					throw Unsupported();
+				}
+				result += formatC( spec + "s", s.c_str() );
+				break;
+			}
+			default :
+				throw Unsupported();
+		}
+	}
+
+	if( argIndex != args.size() )
+	{
+		throw Unsupported();
+	}
+
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Operators
+//////////////////////////////////////////////////////////////////////////
+
+enum class BinaryOp
+{
+	Add,
+	Subtract,
+	Multiply,
+	Divide,
+	FloorDivide,
+	Modulo,
+	Power
+};
+
+// Equivalent to Python's `divmod()` for floats.
+void floatDivMod( double a, double b, double &div, double &mod )
+{
+	if( b == 0.0 )
+	{
+		throw Unsupported();
+	}
+
+	mod = std::fmod( a, b );
+	div = ( a - mod ) / b;
+	if( mod != 0.0 )
+	{
+		if( ( b < 0 ) != ( mod < 0 ) )
+		{
+			mod += b;
+			div -= 1.0;
+		}
+	}
+	else
+	{
+		mod = std::copysign( 0.0, b );
+	}
+
+	if( div != 0.0 )
+	{
+		const double floorDiv = std::floor( div );
+		div = div - floorDiv > 0.5 ? floorDiv + 1.0 : floorDiv;
+	}
+	else
+	{
+		div = std::copysign( 0.0, a / b );
+	}
+}
+
+Value intPower( int64_t base, int64_t exponent )
+{
+	int64_t result = 1;
+	while( exponent )
+	{
+		if( exponent & 1 )
+		{
+			if( __builtin_mul_overflow( result, base, &result ) )
+			{
+				throw Unsupported();
+			}
+		}
+		exponent >>= 1;
+		if( exponent && __builtin_mul_overflow( base, base, &base ) )
+		{
+			throw Unsupported();
+		}
+	}
+	return Value::fromInt( result );
+}
+
+Value floatPower( double base, double exponent )
+{
+	if( base == 0.0 && exponent < 0.0 )
+	{
+		throw Unsupported();
+	}
+	if( base < 0.0 && exponent != std::floor( exponent ) )
+	{
+		throw Unsupported();
+	}
+	const double result = std::pow( base, exponent );
+	if( std::isinf( result ) && std::isfinite( base ) && std::isfinite( exponent ) )
+	{
+		throw Unsupported();
+	}
+	return Value::fromFloat( result );
+}
+
+Value binaryOp( BinaryOp op, const Value &a, const Value &b )
+{
+	if( a.isIntegral() && b.isIntegral() )
+	{
+		int64_t r;
+		switch( op )
+		{
+			case BinaryOp::Add :
+				if( __builtin_add_overflow( a.i, b.i, &r ) )
+				{
+					throw Unsupported();
+				}
+				return Value::fromInt( r );
+			case BinaryOp::Subtract :
+				if( __builtin_sub_overflow( a.i, b.i, &r ) )
+				{
+					throw Unsupported();
+				}
+				return Value::fromInt( r );
+			case BinaryOp::Multiply :
+				if( __builtin_mul_overflow( a.i, b.i, &r ) )
+				{
+					throw Unsupported();
+				}
+				return Value::fromInt( r );
+#if PY_MAJOR_VERSION >= 3
+			case BinaryOp::Divide :
+				if( b.i == 0 )
+				{
+					throw Unsupported();
+				}
+				return Value::fromFloat( (double)a.i / (double)b.i );
+#else
+			case BinaryOp::Divide :
+#endif
+			case BinaryOp::FloorDivide :
+			case BinaryOp::Modulo : {
+				if( b.i == 0 || ( a.i == std::numeric_limits<int64_t>::min() && b.i == -1 ) )
+				{
+					throw Unsupported();
+				}
+				int64_t div = a.i / b.i;
+				int64_t mod = a.i % b.i;
+				if( mod != 0 && ( ( mod < 0 ) != ( b.i < 0 ) ) )
+				{
+					div -= 1;
+					mod += b.i;
+				}
+				return Value::fromInt( op == BinaryOp::Modulo ? mod : div );
+			}
+			case BinaryOp::Power :
+				if( b.i >= 0 )
+				{
+					return intPower( a.i, b.i );
+				}
+				return floatPower( (double)a.i, (double)b.i );
+		}
+	}
+	else if( a.isNumeric() && b.isNumeric() )
+	{
+		const double x = a.asFloat();
+		const double y = b.asFloat();
+		switch( op )
+		{
+			case BinaryOp::Add :
+				return Value::fromFloat( x + y );
+			case BinaryOp::Subtract :
+				return Value::fromFloat( x - y );
+			case BinaryOp::Multiply :
+				return Value::fromFloat( x * y );
+			case BinaryOp::Divide :
+				if( y == 0.0 )
+				{
+					throw Unsupported();
+				}
+				return Value::fromFloat( x / y );
+			case BinaryOp::FloorDivide :
+			case BinaryOp::Modulo : {
+				double div, mod;
+				floatDivMod( x, y, div, mod );
+				return Value::fromFloat( op == BinaryOp::Modulo ? mod : div );
+			}
+			case BinaryOp::Power :
+				return floatPower( x, y );
+		}
+	}
+	else if( a.type == Value::String )
+	{
+		if( op == BinaryOp::Add && b.type == Value::String )
+		{
+			return Value::fromString( a.s + b.s );
+		}
+		else if( op == BinaryOp::Modulo )
+		{
+			return Value::fromString( percentFormat( a.s, { b } ) );
+		}
+	}
+
+	throw Unsupported();
+}
+
+enum class CompareOp
+{
+	Equal,
+	NotEqual,
+	Less,
+	LessEqual,
+	Greater,
+	GreaterEqual
+};
+
+template<typename T>
+bool compare( CompareOp op, const T &a, const T &b )
+{
+	switch( op )
+	{
+		case CompareOp::Equal :
+			return a == b;
+		case CompareOp::NotEqual :
+			return a != b;
+		case CompareOp::Less :
+			return a < b;
+		case CompareOp::LessEqual :
+			return a <= b;
+		case CompareOp::Greater :
+			return a > b;
+		default :
+			return a >= b;
+	}
+}
+
+bool compare( CompareOp op, const Value &a, const Value &b )
+{
+	if( a.isIntegral() && b.isIntegral() )
+	{
+		return compare( op, a.i, b.i );
+	}
+	else if( a.isNumeric() && b.isNumeric() )
+	{
+		return compare( op, a.asFloat(), b.asFloat() );
+	}
+	else if( a.type == Value::String && b.type == Value::String )
+	{
+		return compare( op, a.s, b.s );
+	}
+	else if( op == CompareOp::Equal || op == CompareOp::NotEqual )
+	{
+		// Mismatched types, or None.
+		const bool equal = a.type == Value::None && b.type == Value::None;
+		return op == CompareOp::Equal ? equal : !equal;
+	}
+
+	throw Unsupported();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Builtin functions
+//////////////////////////////////////////////////////////////////////////
+
+enum class Builtin
+{
+	Int,
+	Float,
+	Str,
+	Bool,
+	Abs,
+	Round,
+	Min,
+	Max
+};
+
+const std::unordered_map<std::string, Builtin> g_builtins = {
+	{ "int", Builtin::Int },
+	{ "float", Builtin::Float },
+	{ "str", Builtin::Str },
+	{ "bool", Builtin::Bool },
+	{ "abs", Builtin::Abs },
+	{ "round", Builtin::Round },
+	{ "min", Builtin::Min },
+	{ "max", Builtin::Max }
+};
+
+std::string strip( const std::string &s )
+{
+	const size_t begin = s.find_first_not_of( " \t\n\r\f\v" );
+	if( begin == std::string::npos )
+	{
+		return "";
+	}
+	const size_t end = s.find_last_not_of( " \t\n\r\f\v" );
+	return s.substr( begin, end - begin + 1 );
+}
+
+Value callBuiltin( Builtin function, const std::vector<Value> &args )
+{
+	switch( function )
+	{
+		case Builtin::Int : {
+			const Value &v = args[0];
+			if( v.isIntegral() )
+			{
+				return Value::fromInt( v.i );
+			}
+			else if( v.type == Value::Float )
+			{
+				return Value::fromInt( floatToInt( v.f ) );
+			}
+			else if( v.type == Value::String )
+			{
+				const std::string s = strip( v.s );
+				if( s.empty() || s.find_first_not_of( "+-0123456789" ) != std::string::npos )
+				{
+					throw Unsupported();
+				}
+				char *end = nullptr;
+				errno = 0;
+				const long long i = strtoll( s.c_str(), &end, 10 );
+				if( errno || *end )
+				{
+					throw Unsupported();
+				}
+				return Value::fromInt( i );
+			}
+			throw Unsupported();
+		}
+		case Builtin::Float : {
+			const Value &v = args[0];
+			if( v.isNumeric() )
+			{
+				return Value::fromFloat( v.asFloat() );
+			}
+			else if( v.type == Value::String )
+			{
+				const std::string s = strip( v.s );
+				if( s.empty() || s.find_first_of( "xX_()" ) != std::string::npos )
+				{
+					throw Unsupported();
+				}
+				char *end = nullptr;
+				const double f = strtod( s.c_str(), &end );
+				if( *end )
+				{
+					throw Unsupported();
+				}
+				return Value::fromFloat( f );
+			}
+			throw Unsupported();
+		}
+		case Builtin::Str :
+			return Value::fromString( toString( args[0] ) );
+		case Builtin::Bool :
+			return Value::fromBool( truth( args[0] ) );
+		case Builtin::Abs : {
+			const Value &v = args[0];
+			if( v.isIntegral() )
+			{
+				if( v.i == std::numeric_limits<int64_t>::min() )
+				{
+					throw Unsupported();
+				}
+				return Value::fromInt( std::abs( v.i ) );
+			}
+			else if( v.type == Value::Float )
+			{
+				return Value::fromFloat( std::fabs( v.f ) );
+			}
+			throw Unsupported();
+		}
+		case Builtin::Round : {
+			const Value &v = args[0];
+			if( !v.isNumeric() )
+			{
+				throw Unsupported();
+			}
+#if PY_MAJOR_VERSION >= 3
+			// Round half to even, returning an int.
+			if( v.isIntegral() )
+			{
+				return Value::fromInt( v.i );
+			}
+			return Value::fromInt( floatToInt( std::nearbyint( v.f ) ) );
+#else
+			// Round half away from zero, returning a float.
+			return Value::fromFloat( std::round( v.asFloat() ) );
+#endif
+		}
+		case Builtin::Min :
+		case Builtin::Max : {
+			// Python returns the first of equal values.
+			const CompareOp op = function == Builtin::Min ? CompareOp::Less : CompareOp::Greater;
+			size_t result = 0;
+			for( size_t i = 1; i < args.size(); ++i )
+			{
+				if( compare( op, args[i], args[result] ) )
+				{
+					result = i;
+				}
+			}
+			return args[result];
+		}
+	}
+
+	throw Unsupported();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Expression tree
+//////////////////////////////////////////////////////////////////////////
+
+struct EvaluationState
+{
+
+	EvaluationState( const Context *context, size_t numLocals, size_t numOutputs )
+		:	context( context ), locals( numLocals ), localsAssigned( numLocals, false ), outputs( numOutputs ), outputsAssigned( numOutputs, false )
+	{
+	}
+
+	const Context *context;
+	std::vector<Value> inputs;
+	std::vector<Value> locals;
+	std::vector<bool> localsAssigned;
+	std::vector<Value> outputs;
+	std::vector<bool> outputsAssigned;
+
+};
+
+struct Expr
+{
+	virtual ~Expr() {}
+	virtual Value evaluate( EvaluationState &state ) const = 0;
+};
+
+typedef std::unique_ptr<const Expr> ExprPtr;
+
+struct ConstantExpr : public Expr
+{
+	ConstantExpr( const Value &value ) : value( value ) {}
+	Value evaluate( EvaluationState &state ) const override { return value; }
+	const Value value;
+};
+
+// Only valid as the right hand side of a `%` string formatting
+// operation, which accesses `elements` directly.
+struct TupleExpr : public Expr
+{
+	Value evaluate( EvaluationState &state ) const override { throw Unsupported(); }
+	std::vector<ExprPtr> elements;
+};
+
+struct LocalExpr : public Expr
+{
+	LocalExpr( size_t index ) : index( index ) {}
+	Value evaluate( EvaluationState &state ) const override
+	{
+		if( !state.localsAssigned[index] )
+		{
+			throw Unsupported();
+		}
+		return state.locals[index];
+	}
+	const size_t index;
+};
+
+struct InputExpr : public Expr
+{
+	InputExpr( size_t index ) : index( index ) {}
+	Value evaluate( EvaluationState &state ) const override { return state.inputs[index]; }
+	const size_t index;
+};
+
+Value contextValue( const Data *data )
+{
+	switch( data->typeId() )
+	{
+		case BoolDataTypeId :
+			return Value::fromBool( static_cast<const BoolData *>( data )->readable() );
+		case IntDataTypeId :
+			return Value::fromInt( static_cast<const IntData *>( data )->readable() );
+		case FloatDataTypeId :
+			return Value::fromFloat( static_cast<const FloatData *>( data )->readable() );
+		case DoubleDataTypeId :
+			return Value::fromFloat( static_cast<const DoubleData *>( data )->readable() );
+		case StringDataTypeId :
+			return Value::fromString( static_cast<const StringData *>( data )->readable() );
+		default :
+			throw Unsupported();
+	}
+}
+
+// `context["name"]` and `context.get( "name", default )`
+struct ContextGetExpr : public Expr
+{
+	ContextGetExpr( const std::string &name, bool hasDefault, ExprPtr defaultValue )
+		:	name( name ), hasDefault( hasDefault ), defaultValue( std::move( defaultValue ) )
+	{
+	}
+
+	Value evaluate( EvaluationState &state ) const override
+	{
+		if( const Data *data = state.context->get<Data>( name, nullptr ) )
+		{
+			return contextValue( data );
+		}
+		else if( !hasDefault )
+		{
+			// KeyError
+			throw Unsupported();
+		}
+		return defaultValue ? defaultValue->evaluate( state ) : Value();
+	}
+
+	const InternedString name;
+	const bool hasDefault;
+	const ExprPtr defaultValue;
+};
+
+// `"name" in context` and `"name" not in context`
+struct ContextContainsExpr : public Expr
+{
+	ContextContainsExpr( const std::string &name, bool negate ) : name( name ), negate( negate ) {}
+	Value evaluate( EvaluationState &state ) const override
+	{
+		const bool contains = state.context->get<Data>( name, nullptr );
+		return Value::fromBool( contains != negate );
+	}
+	const InternedString name;
+	const bool negate;
+};
+
+// `context.getFrame()` etc
+struct ContextMethodExpr : public Expr
+{
+	enum Method
+	{
+		Frame,
+		FramesPerSecond,
+		Time
+	};
+
+	ContextMethodExpr( Method method ) : method( method ) {}
+	Value evaluate( EvaluationState &state ) const override
+	{
+		switch( method )
+		{
+			case Frame :
+				return Value::fromFloat( state.context->getFrame() );
+			case FramesPerSecond :
+				return Value::fromFloat( state.context->getFramesPerSecond() );
+			default :
+				return Value::fromFloat( state.context->getTime() );
+		}
+	}
+	const Method method;
+};
+
+struct UnaryExpr : public Expr
+{
+	enum Op
+	{
+		Negate,
+		Plus,
+		Not
+	};
+
+	UnaryExpr( Op op, ExprPtr operand ) : op( op ), operand( std::move( operand ) ) {}
+	Value evaluate( EvaluationState &state ) const override
+	{
+		const Value v = operand->evaluate( state );
+		if( op == Not )
+		{
+			return Value::fromBool( !truth( v ) );
+		}
+		else if( v.isIntegral() )
+		{
+			if( op == Plus )
+			{
+				return Value::fromInt( v.i );
+			}
+			else if( v.i == std::numeric_limits<int64_t>::min() )
+			{
+				throw Unsupported();
+			}
+			return Value::fromInt( -v.i );
+		}
+		else if( v.type == Value::Float )
+		{
+			return Value::fromFloat( op == Plus ? v.f : -v.f );
+		}
+		throw Unsupported();
+	}
+	const Op op;
+	const ExprPtr operand;
+};
+
+struct BinaryExpr : public Expr
+{
+	BinaryExpr( BinaryOp op, ExprPtr left, ExprPtr right ) : op( op ), left( std::move( left ) ), right( std::move( right ) ) {}
+	Value evaluate( EvaluationState &state ) const override
+	{
+		const Value l = left->evaluate( state );
+		return binaryOp( op, l, right->evaluate( state ) );
+	}
+	const BinaryOp op;
+	const ExprPtr left;
+	const ExprPtr right;
+};
+
+// `format % ( a, b, ... )`
+struct FormatExpr : public Expr
+{
+	FormatExpr( ExprPtr format, std::unique_ptr<const TupleExpr> args ) : format( std::move( format ) ), args( std::move( args ) ) {}
+	Value evaluate( EvaluationState &state ) const override
+	{
+		const Value f = format->evaluate( state );
+		if( f.type != Value::String )
+		{
+			throw Unsupported();
+		}
+		std::vector<Value> values;
+		for( const auto &e : args->elements )
+		{
+			values.push_back( e->evaluate( state ) );
+		}
+		return Value::fromString( percentFormat( f.s, values ) );
+	}
+	const ExprPtr format;
+	const std::unique_ptr<const TupleExpr> args;
+};
+
+struct CompareExpr : public Expr
+{
+	Value evaluate( EvaluationState &state ) const override
+	{
+		// Python semantics for chained comparisons : `a < b < c`
+		// is equivalent to `a < b and b < c`, evaluating `b` once.
+		Value l = first->evaluate( state );
+		for( const auto &c : comparisons )
+		{
+			Value r = c.second->evaluate( state );
+			if( !compare( c.first, l, r ) )
+			{
+				return Value::fromBool( false );
+			}
+			l = std::move( r );
+		}
+		return Value::fromBool( true );
+	}
+	ExprPtr first;
+	std::vector<std::pair<CompareOp, ExprPtr>> comparisons;
+};
+
+struct BoolOpExpr : public Expr
+{
+	Value evaluate( EvaluationState &state ) const override
+	{
+		// Python semantics : returns the deciding operand
+		// rather than a bool.
+		Value v;
+		for( const auto &o : operands )
+		{
+			v = o->evaluate( state );
+			if( truth( v ) == isOr )
+			{
+				return v;
+			}
+		}
+		return v;
+	}
+	bool isOr;
+	std::vector<ExprPtr> operands;
+};
+
+struct ConditionalExpr : public Expr
+{
+	ConditionalExpr( ExprPtr condition, ExprPtr trueValue, ExprPtr falseValue )
+		:	condition( std::move( condition ) ), trueValue( std::move( trueValue ) ), falseValue( std::move( falseValue ) )
+	{
+	}
+	Value evaluate( EvaluationState &state ) const override
+	{
+		return truth( condition->evaluate( state ) ) ? trueValue->evaluate( state ) : falseValue->evaluate( state );
+	}
+	const ExprPtr condition;
+	const ExprPtr trueValue;
+	const ExprPtr falseValue;
+};
+
+struct CallExpr : public Expr
+{
+	Value evaluate( EvaluationState &state ) const override
+	{
+		std::vector<Value> values;
+		values.reserve( args.size() );
+		for( const auto &a : args )
+		{
+			values.push_back( a->evaluate( state ) );
+		}
+		return callBuiltin( function, values );
+	}
+	Builtin function;
+	std::vector<ExprPtr> args;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Statements
+//////////////////////////////////////////////////////////////////////////
+
+struct Statement
+{
+	virtual ~Statement() {}
+	virtual void execute( EvaluationState &state ) const = 0;
+};
+
+typedef std::unique_ptr<const Statement> StatementPtr;
+typedef std::vector<StatementPtr> Block;
+
+void execute( const Block &block, EvaluationState &state )
+{
+	for( const auto &s : block )
+	{
+		s->execute( state );
+	}
+}
+
+struct AssignLocalStatement : public Statement
+{
+	AssignLocalStatement( size_t index, ExprPtr value ) : index( index ), value( std::move( value ) ) {}
+	void execute( EvaluationState &state ) const override
+	{
+		state.locals[index] = value->evaluate( state );
+		state.localsAssigned[index] = true;
+	}
+	const size_t index;
+	const ExprPtr value;
+};
+
+struct AssignOutputStatement : public Statement
+{
+	AssignOutputStatement( size_t index, ExprPtr value ) : index( index ), value( std::move( value ) ) {}
+	void execute( EvaluationState &state ) const override
+	{
+		state.outputs[index] = value->evaluate( state );
+		state.outputsAssigned[index] = true;
+	}
+	const size_t index;
+	const ExprPtr value;
+};
+
+struct IfStatement : public Statement
+{
+	void execute( EvaluationState &state ) const override
+	{
+		for( const auto &branch : branches )
+		{
+			if( truth( branch.first->evaluate( state ) ) )
+			{
+				::execute( branch.second, state );
+				return;
+			}
+		}
+		::execute( elseBlock, state );
+	}
+	std::vector<std::pair<ExprPtr, Block>> branches;
+	Block elseBlock;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Tokenizer
+//////////////////////////////////////////////////////////////////////////
+
+struct Token
+{
+
+	enum Type
+	{
+		Name,
+		Int,
+		Float,
+		String,
+		Op,
+		Newline,
+		Indent,
+		Dedent,
+		End
+	};
+
+	Token( Type type, const std::string &text = "" ) : type( type ), text( text ), i( 0 ), f( 0.0 ) {}
+
+	Type type;
+	std::string text;
+	int64_t i;
+	double f;
+
+};
+
+std::vector<Token> tokenize( const std::string &text )
+{
+	std::vector<Token> tokens;
+	std::vector<size_t> indents = { 0 };
+	int depth = 0;
+	bool atLineStart = true;
+
+	auto endLine = [&tokens] () {
+		if( tokens.size() && tokens.back().type != Token::Newline )
+		{
+			tokens.push_back( Token( Token::Newline ) );
+		}
+	};
+
+	const size_t size = text.size();
+	size_t i = 0;
+	while( i < size )
+	{
+		if( atLineStart && depth == 0 )
+		{
+			// Measure indentation, skipping blank lines.
+			size_t j = i;
+			while( j < size && text[j] == ' ' )
+			{
+				j++;
+			}
+			if( j < size && ( text[j] == '\t' || text[j] == '\f' ) )
+			{
+				throw Unsupported();
+			}
+			if( j >= size )
+			{
+				break;
+			}
+			if( text[j] == '\n' || text[j] == '\r' || text[j] == '#' )
+			{
+				i = text.find( '\n', j );
+				i = i == std::string::npos ? size : i + 1;
+				continue;
+			}
+
+			const size_t indent = j - i;
+			if( indent > indents.back() )
+			{
+				indents.push_back( indent );
+				tokens.push_back( Token( Token::Indent ) );
+			}
+			while( indent < indents.back() )
+			{
+				indents.pop_back();
+				tokens.push_back( Token( Token::Dedent ) );
+			}
+			if( indent != indents.back() )
+			{
+				throw Unsupported();
+			}
+
+			i = j;
+			atLineStart = false;
+		}
+
+		const char c = text[i];
+		if( c == ' ' || c == '\t' || c == '\r' )
+		{
+			i++;
+		}
+		else if( c == '#' )
+		{
+			i = text.find( '\n', i );
+			i = i == std::string::npos ? size : i;
+		}
+		else if( c == '\\' )
+		{
+			if( i + 1 < size && text[i+1] == '\n' )
+			{
+				i += 2;
+			}
+			else
+			{
+				throw Unsupported();
+			}
+		}
+		else if( c == '\n' )
+		{
+			i++;
+			if( depth == 0 )
+			{
+				endLine();
+				atLineStart = true;
+			}
+		}
+		else if( isalpha( c ) || c == '_' )
+		{
+			const size_t start = i;
+			while( i < size && ( isalnum( text[i] ) || text[i] == '_' ) )
+			{
+				i++;
+			}
+			if( i < size && ( text[i] == '"' || text[i] == '\'' ) )
+			{
+				// String prefix
+				throw Unsupported();
+			}
+			tokens.push_back( Token( Token::Name, text.substr( start, i - start ) ) );
+		}
+		else if( isdigit( c ) || ( c == '.' && i + 1 < size && isdigit( text[i+1] ) ) )
+		{
+			const size_t start = i;
+			bool isFloat = false;
+			while( i < size && isdigit( text[i] ) )
+			{
+				i++;
+			}
+			if( i < size && text[i] == '.' )
+			{
+				isFloat = true;
+				i++;
+				while( i < size && isdigit( text[i] ) )
+				{
+					i++;
+				}
+			}
+			if( i < size && ( text[i] == 'e' || text[i] == 'E' ) )
+			{
+				isFloat = true;
+				i++;
+				if( i < size && ( text[i] == '+' || text[i] == '-' ) )
+				{
+					i++;
+				}
+				if( i >= size || !isdigit( text[i] ) )
+				{
+					throw Unsupported();
+				}
+				while( i < size && isdigit( text[i] ) )
+				{
+					i++;
+				}
+			}
+			if( i < size && ( isalnum( text[i] ) || text[i] == '_' || text[i] == '.' ) )
+			{
+				// Hex, octal, complex, long etc.
+				throw Unsupported();
+			}
+
+			Token token( isFloat ? Token::Float : Token::Int, text.substr( start, i - start ) );
+			if( isFloat )
+			{
+				token.f = strtod( token.text.c_str(), nullptr );
+			}
+			else
+			{
+				if( token.text.size() > 1 && token.text[0] == '0' )
+				{
+					throw Unsupported();
+				}
+				errno = 0;
+				token.i = strtoll( token.text.c_str(), nullptr, 10 );
+				if( errno )
+				{
+					throw Unsupported();
+				}
+			}
+			tokens.push_back( token );
+		}
+		else if( c == '"' || c == '\'' )
+		{
+			if( i + 2 < size && text[i+1] == c && text[i+2] == c )
+			{
+				// Triple quoted
+				throw Unsupported();
+			}
+			std::string value;
+			i++;
+			while( true )
+			{
+				if( i >= size || text[i] == '\n' || (unsigned char)text[i] > 127 )
+				{
+					throw Unsupported();
+				}
+				const char s = text[i];
+				if( s == c )
+				{
+					i++;
+					break;
+				}
+				else if( s == '\\' )
+				{
+					if( i + 1 >= size )
+					{
+						throw Unsupported();
+					}
+					switch( text[i+1] )
+					{
+						case '\\' : value += '\\'; break;
+						case '\'' : value += '\''; break;
+						case '"' : value += '"'; break;
+						case 'n' : value += '\n'; break;
+						case 't' : value += '\t'; break;
+						case 'r' : value += '\r'; break;
+						default : throw Unsupported();
+					}
+					i += 2;
+				}
+				else
+				{
+					value += s;
+					i++;
+				}
+			}
+			tokens.push_back( Token( Token::String, value ) );
+		}
+		else
+		{
+			static const char *twoCharOps[] = { "**", "//", "==", "!=", "<=", ">=", "<>", "<<", ">>", "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", "->", ":=" };
+			bool matched = false;
+			for( const char *op : twoCharOps )
+			{
+				if( i + 1 < size && text[i] == op[0] && text[i+1] == op[1] )
+				{
+					if( i + 2 < size && text[i+2] == '=' )
+					{
+						// `**=`, `//=` etc
+						throw Unsupported();
+					}
+					tokens.push_back( Token( Token::Op, op ) );
+					i += 2;
+					matched = true;
+					break;
+				}
+			}
+			if( matched )
+			{
+				continue;
+			}
+
+			if( !strchr( "+-*/%()[]{},.:;<>=@&|^~", c ) )
+			{
+				throw Unsupported();
+			}
+
+			if( c == '(' || c == '[' || c == '{' )
+			{
+				depth++;
+			}
+			else if( c == ')' || c == ']' || c == '}' )
+			{
+				if( --depth < 0 )
+				{
+					throw Unsupported();
+				}
+			}
+
+			tokens.push_back( Token( Token::Op, std::string( 1, c ) ) );
+			i++;
+		}
+	}
+
+	if( depth )
+	{
+		throw Unsupported();
+	}
+
+	endLine();
+	while( indents.size() > 1 )
+	{
+		indents.pop_back();
+		tokens.push_back( Token( Token::Dedent ) );
+	}
+	tokens.push_back( Token( Token::End ) );
+
+	return tokens;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Parser
+//////////////////////////////////////////////////////////////////////////
+
+const std::unordered_set<std::string> g_keywords = {
+	"and", "as", "assert", "async", "await", "break", "class", "continue", "def", "del",
+	"elif", "else", "except", "exec", "finally", "for", "from", "global", "if", "import",
+	"in", "is", "lambda", "nonlocal", "not", "or", "pass", "print", "raise", "return",
+	"try", "while", "with", "yield", "True", "False", "None"
+};
+
+// Names which have special meaning in the Python engine's
+// execution namespace.
+const std::unordered_set<std::string> g_reservedNames = {
+	"parent", "context", "imath", "IECore", "__builtins__"
+};
+
+class Parser
+{
+
+	public :
+
+		Parser( const std::string &expression, const std::unordered_map<std::string, size_t> &inputs, const std::unordered_map<std::string, size_t> &outputs )
+			:	m_tokens( tokenize( expression ) ), m_position( 0 ), m_inputs( inputs ), m_outputs( outputs )
+		{
+		}
+
+		Block parse()
+		{
+			Block result;
+			while( peek().type != Token::End )
+			{
+				parseStatement( result );
+			}
+			return result;
+		}
+
+		size_t numLocals() const
+		{
+			return m_locals.size();
+		}
+
+	private :
+
+		// Token utilities
+		// ===============
+
+		const Token &peek( size_t offset = 0 ) const
+		{
+			return m_tokens[std::min( m_position + offset, m_tokens.size() - 1 )];
+		}
+
+		const Token &next()
+		{
+			const Token &result = peek();
+			if( m_position < m_tokens.size() - 1 )
+			{
+				m_position++;
+			}
+			return result;
+		}
+
+		bool isOp( const Token &token, const char *op ) const
+		{
+			return token.type == Token::Op && token.text == op;
+		}
+
+		bool isName( const Token &token, const char *name ) const
+		{
+			return token.type == Token::Name && token.text == name;
+		}
+
+		void expectOp( const char *op )
+		{
+			if( !isOp( next(), op ) )
+			{
+				throw Unsupported();
+			}
+		}
+
+		void expect( Token::Type type )
+		{
+			if( next().type != type )
+			{
+				throw Unsupported();
+			}
+		}
+
+		std::string expectString()
+		{
+			const Token &t = next();
+			if( t.type != Token::String )
+			{
+				throw Unsupported();
+			}
+			return t.text;
+		}
+
+		// Parses a sequence of `["name"]` subscripts, returning
+		// them as a plug path.
+		std::string parseSubscripts()
+		{
+			std::string result;
+			while( isOp( peek(), "[" ) )
+			{
+				next();
+				if( result.size() )
+				{
+					result += ".";
+				}
+				result += expectString();
+				expectOp( "]" );
+			}
+			if( result.empty() )
+			{
+				throw Unsupported();
+			}
+			return result;
+		}
+
+		// Statements
+		// ==========
+
+		void parseStatement( Block &block )
+		{
+			if( isName( peek(), "if" ) )
+			{
+				block.push_back( parseIf() );
+			}
+			else
+			{
+				parseSimpleStatements( block );
+			}
+		}
+
+		// Parses `;` separated statements up to the end of the line.
+		void parseSimpleStatements( Block &block )
+		{
+			while( true )
+			{
+				if( StatementPtr s = parseSimpleStatement() )
+				{
+					block.push_back( std::move( s ) );
+				}
+				if( isOp( peek(), ";" ) )
+				{
+					next();
+					if( peek().type == Token::Newline )
+					{
+						break;
+					}
+				}
+				else
+				{
+					break;
+				}
+			}
+			expect( Token::Newline );
+		}
+
+		StatementPtr parseSimpleStatement()
+		{
+			const Token &t = peek();
+			if( isName( t, "pass" ) )
+			{
+				next();
+				return nullptr;
+			}
+
+			if( t.type != Token::Name )
+			{
+				throw Unsupported();
+			}
+
+			StatementPtr result;
+			if( t.text == "parent" )
+			{
+				next();
+				const std::string path = parseSubscripts();
+				expectOp( "=" );
+				auto it = m_outputs.find( path );
+				if( it == m_outputs.end() || m_inputs.count( path ) )
+				{
+					throw Unsupported();
+				}
+				result.reset( new AssignOutputStatement( it->second, parseTest() ) );
+			}
+			else
+			{
+				if( !isOp( peek( 1 ), "=" ) || g_keywords.count( t.text ) || g_reservedNames.count( t.text ) || g_builtins.count( t.text ) )
+				{
+					throw Unsupported();
+				}
+				const std::string name = next().text;
+				next(); // `=`
+				// Parse the value before registering the local, so
+				// that `x = x + 1` can't read an unassigned `x`.
+				ExprPtr value = parseTest();
+				auto inserted = m_locals.insert( { name, m_locals.size() } );
+				result.reset( new AssignLocalStatement( inserted.first->second, std::move( value ) ) );
+			}
+
+			if( isOp( peek(), "=" ) )
+			{
+				// Chained assignment
+				throw Unsupported();
+			}
+
+			return result;
+		}
+
+		StatementPtr parseIf()
+		{
+			std::unique_ptr<IfStatement> result( new IfStatement );
+			next(); // `if`
+			while( true )
+			{
+				ExprPtr condition = parseTest();
+				expectOp( ":" );
+				Block block = parseSuite();
+				result->branches.push_back( { std::move( condition ), std::move( block ) } );
+				if( isName( peek(), "elif" ) )
+				{
+					next();
+					continue;
+				}
+				if( isName( peek(), "else" ) )
+				{
+					next();
+					expectOp( ":" );
+					result->elseBlock = parseSuite();
+				}
+				break;
+			}
+			return StatementPtr( result.release() );
+		}
+
+		Block parseSuite()
+		{
+			Block result;
+			if( peek().type != Token::Newline )
+			{
+				parseSimpleStatements( result );
+				return result;
+			}
+
+			next(); // Newline
+			expect( Token::Indent );
+			while( peek().type != Token::Dedent )
+			{
+				if( peek().type == Token::End )
+				{
+					throw Unsupported();
+				}
+				parseStatement( result );
+			}
+			next(); // Dedent
+			return result;
+		}
+
+		// Expressions
+		// ===========
+
+		ExprPtr parseTest()
+		{
+			ExprPtr result = parseOrTest();
+			if( isName( peek(), "if" ) )
+			{
+				next();
+				ExprPtr condition = parseOrTest();
+				if( !isName( next(), "else" ) )
+				{
+					throw Unsupported();
+				}
+				ExprPtr falseValue = parseTest();
+				result.reset( new ConditionalExpr( std::move( condition ), std::move( result ), std::move( falseValue ) ) );
+			}
+			return result;
+		}
+
+		ExprPtr parseOrTest()
+		{
+			return parseBoolOp( true );
+		}
+
+		ExprPtr parseBoolOp( bool isOr )
+		{
+			const char *keyword = isOr ? "or" : "and";
+			ExprPtr first = isOr ? parseBoolOp( false ) : parseNotTest();
+			if( !isName( peek(), keyword ) )
+			{
+				return first;
+			}
+
+			std::unique_ptr<BoolOpExpr> result( new BoolOpExpr );
+			result->isOr = isOr;
+			result->operands.push_back( std::move( first ) );
+			while( isName( peek(), keyword ) )
+			{
+				next();
+				result->operands.push_back( isOr ? parseBoolOp( false ) : parseNotTest() );
+			}
+			return ExprPtr( result.release() );
+		}
+
+		ExprPtr parseNotTest()
+		{
+			if( isName( peek(), "not" ) )
+			{
+				next();
+				return ExprPtr( new UnaryExpr( UnaryExpr::Not, parseNotTest() ) );
+			}
+			return parseComparison();
+		}
+
+		bool compareOp( const Token &token, CompareOp &op ) const
+		{
+			static const std::vector<std::pair<const char *, CompareOp>> ops = {
+				{ "==", CompareOp::Equal },
+				{ "!=", CompareOp::NotEqual },
+				{ "<", CompareOp::Less },
+				{ "<=", CompareOp::LessEqual },
+				{ ">", CompareOp::Greater },
+				{ ">=", CompareOp::GreaterEqual }
+			};
+			for( const auto &o : ops )
+			{
+				if( isOp( token, o.first ) )
+				{
+					op = o.second;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		ExprPtr parseComparison()
+		{
+			// Special case for `"name" in context` and `"name" not in context`.
+			if(
+				peek().type == Token::String &&
+				(
+					( isName( peek( 1 ), "in" ) && isName( peek( 2 ), "context" ) ) ||
+					( isName( peek( 1 ), "not" ) && isName( peek( 2 ), "in" ) && isName( peek( 3 ), "context" ) )
+				)
+			)
+			{
+				const std::string name = next().text;
+				const bool negate = isName( next(), "not" );
+				if( negate )
+				{
+					next(); // `in`
+				}
+				next(); // `context`
+				CompareOp op;
+				if( compareOp( peek(), op ) || isName( peek(), "in" ) || isName( peek(), "is" ) || isName( peek(), "not" ) )
+				{
+					// Chained comparison
+					throw Unsupported();
+				}
+				return ExprPtr( new ContextContainsExpr( name, negate ) );
+			}
+
+			ExprPtr first = parseArith();
+			CompareOp op;
+			if( !compareOp( peek(), op ) )
+			{
+				if( isName( peek(), "in" ) || isName( peek(), "is" ) || ( isName( peek(), "not" ) && isName( peek( 1 ), "in" ) ) || isOp( peek(), "<>" ) )
+				{
+					throw Unsupported();
+				}
+				return first;
+			}
+
+			std::unique_ptr<CompareExpr> result( new CompareExpr );
+			result->first = std::move( first );
+			while( compareOp( peek(), op ) )
+			{
+				next();
+				result->comparisons.push_back( { op, parseArith() } );
+			}
+			if( isName( peek(), "in" ) || isName( peek(), "is" ) || isName( peek(), "not" ) )
+			{
+				throw Unsupported();
+			}
+			return ExprPtr( result.release() );
+		}
+
+		ExprPtr parseArith()
+		{
+			ExprPtr result = parseTerm();
+			while( isOp( peek(), "+" ) || isOp( peek(), "-" ) )
+			{
+				const BinaryOp op = isOp( next(), "+" ) ? BinaryOp::Add : BinaryOp::Subtract;
+				ExprPtr right = parseTerm();
+				result.reset( new BinaryExpr( op, std::move( result ), std::move( right ) ) );
+			}
+			return result;
+		}
+
+		ExprPtr parseTerm()
+		{
+			ExprPtr result = parseFactor();
+			while( true )
+			{
+				BinaryOp op;
+				if( isOp( peek(), "*" ) )
+				{
+					op = BinaryOp::Multiply;
+				}
+				else if( isOp( peek(), "/" ) )
+				{
+					op = BinaryOp::Divide;
+				}
+				else if( isOp( peek(), "//" ) )
+				{
+					op = BinaryOp::FloorDivide;
+				}
+				else if( isOp( peek(), "%" ) )
+				{
+					op = BinaryOp::Modulo;
+				}
+				else
+				{
+					break;
+				}
+				next();
+
+				ExprPtr right = parseFactor( /* allowTuple = */ op == BinaryOp::Modulo );
+				if( auto tuple = dynamic_cast<const TupleExpr *>( right.get() ) )
+				{
+					right.release();
+					result.reset( new FormatExpr( std::move( result ), std::unique_ptr<const TupleExpr>( tuple ) ) );
+				}
+				else
+				{
+					result.reset( new BinaryExpr( op, std::move( result ), std::move( right ) ) );
+				}
+			}
+			return result;
+		}
+
+		ExprPtr parseFactor( bool allowTuple = false )
+		{
+			if( isOp( peek(), "-" ) || isOp( peek(), "+" ) )
+			{
+				const UnaryExpr::Op op = isOp( next(), "-" ) ? UnaryExpr::Negate : UnaryExpr::Plus;
+				return ExprPtr( new UnaryExpr( op, parseFactor() ) );
+			}
+			return parsePower( allowTuple );
+		}
+
+		ExprPtr parsePower( bool allowTuple )
+		{
+			ExprPtr result = parseAtom( allowTuple );
+			if( isOp( peek(), "**" ) )
+			{
+				if( dynamic_cast<const TupleExpr *>( result.get() ) )
+				{
+					throw Unsupported();
+				}
+				next();
+				ExprPtr exponent = parseFactor();
+				result.reset( new BinaryExpr( BinaryOp::Power, std::move( result ), std::move( exponent ) ) );
+			}
+			return result;
+		}
+
+		ExprPtr parseAtom( bool allowTuple )
+		{
+			ExprPtr result = parseAtomInternal( allowTuple );
+			if( isOp( peek(), "[" ) || isOp( peek(), "(" ) || isOp( peek(), "." ) )
+			{
+				// Indexing, calls and attribute access are only
+				// supported in the forms handled by `parseAtomInternal()`.
+				throw Unsupported();
+			}
+			return result;
+		}
+
+		ExprPtr parseAtomInternal( bool allowTuple )
+		{
+			const Token &t = next();
+			switch( t.type )
+			{
+				case Token::Int :
+					return ExprPtr( new ConstantExpr( Value::fromInt( t.i ) ) );
+				case Token::Float :
+					return ExprPtr( new ConstantExpr( Value::fromFloat( t.f ) ) );
+				case Token::String : {
+					// Adjacent strings are concatenated.
+					std::string s = t.text;
+					while( peek().type == Token::String )
+					{
+						s += next().text;
+					}
+					return ExprPtr( new ConstantExpr( Value::fromString( s ) ) );
+				}
+				case Token::Name :
+					return parseName( t.text );
+				case Token::Op :
+					if( t.text == "(" )
+					{
+						return parseParenthesised( allowTuple );
+					}
+					throw Unsupported();
+				default :
+					throw Unsupported();
+			}
+		}
+
+		ExprPtr parseParenthesised( bool allowTuple )
+		{
+			ExprPtr first = parseTest();
+			if( isOp( peek(), ")" ) )
+			{
+				next();
+				return first;
+			}
+
+			if( !allowTuple )
+			{
+				throw Unsupported();
+			}
+
+			std::unique_ptr<TupleExpr> result( new TupleExpr );
+			result->elements.push_back( std::move( first ) );
+			while( isOp( peek(), "," ) )
+			{
+				next();
+				if( isOp( peek(), ")" ) )
+				{
+					break;
+				}
+				result->elements.push_back( parseTest() );
+			}
+			expectOp( ")" );
+			return ExprPtr( result.release() );
+		}
+
+		ExprPtr parseName( const std::string &name )
+		{
+			if( name == "True" || name == "False" )
+			{
+				return ExprPtr( new ConstantExpr( Value::fromBool( name == "True" ) ) );
+			}
+			else if( name == "None" )
+			{
+				return ExprPtr( new ConstantExpr( Value() ) );
+			}
+			else if( name == "parent" )
+			{
+				const std::string path = parseSubscripts();
+				auto it = m_inputs.find( path );
+				if( it == m_inputs.end() || m_outputs.count( path ) )
+				{
+					throw Unsupported();
+				}
+				return ExprPtr( new InputExpr( it->second ) );
+			}
+			else if( name == "context" )
+			{
+				return parseContext();
+			}
+
+			auto localIt = m_locals.find( name );
+			if( localIt != m_locals.end() )
+			{
+				return ExprPtr( new LocalExpr( localIt->second ) );
+			}
+
+			auto builtinIt = g_builtins.find( name );
+			if( builtinIt != g_builtins.end() && isOp( peek(), "(" ) )
+			{
+				return parseCall( builtinIt->second );
+			}
+
+			throw Unsupported();
+		}
+
+		ExprPtr parseContext()
+		{
+			if( isOp( peek(), "[" ) )
+			{
+				next();
+				const std::string name = expectString();
+				expectOp( "]" );
+				return ExprPtr( new ContextGetExpr( name, /* hasDefault = */ false, nullptr ) );
+			}
+
+			expectOp( "." );
+			const Token &method = next();
+			expectOp( "(" );
+			ExprPtr result;
+			if( isName( method, "getFrame" ) )
+			{
+				result.reset( new ContextMethodExpr( ContextMethodExpr::Frame ) );
+			}
+			else if( isName( method, "getFramesPerSecond" ) )
+			{
+				result.reset( new ContextMethodExpr( ContextMethodExpr::FramesPerSecond ) );
+			}
+			else if( isName( method, "getTime" ) )
+			{
+				result.reset( new ContextMethodExpr( ContextMethodExpr::Time ) );
+			}
+			else if( isName( method, "get" ) )
+			{
+				const std::string name = expectString();
+				ExprPtr defaultValue;
+				if( isOp( peek(), "," ) )
+				{
+					next();
+					defaultValue = parseTest();
+				}
+				result.reset( new ContextGetExpr( name, /* hasDefault = */ true, std::move( defaultValue ) ) );
+			}
+			else
+			{
+				throw Unsupported();
+			}
+			expectOp( ")" );
+			return result;
+		}
+
+		ExprPtr parseCall( Builtin function )
+		{
+			std::unique_ptr<CallExpr> result( new CallExpr );
+			result->function = function;
+			expectOp( "(" );
+			while( !isOp( peek(), ")" ) )
+			{
+				result->args.push_back( parseTest() );
+				if( !isOp( peek(), "," ) )
+				{
+					break;
+				}
+				next();
+			}
+			expectOp( ")" );
+
+			const size_t numArgs = result->args.size();
+			const bool validArgs = ( function == Builtin::Min || function == Builtin::Max ) ? numArgs >= 2 : numArgs == 1;
+			if( !validArgs )
+			{
+				throw Unsupported();
+			}
+
+			return ExprPtr( result.release() );
+		}
+
+		const std::vector<Token> m_tokens;
+		size_t m_position;
+
+		const std::unordered_map<std::string, size_t> &m_inputs;
+		const std::unordered_map<std::string, size_t> &m_outputs;
+		std::unordered_map<std::string, size_t> m_locals;
+
+};
+
+bool supportedPlugType( const ValuePlug *plug )
+{
+	switch( (int)plug->typeId() )
+	{
+		case IntPlugTypeId :
+		case FloatPlugTypeId :
+		case BoolPlugTypeId :
+		case StringPlugTypeId :
+			return true;
+		default :
+			return false;
+	}
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// NativeExpression
+//////////////////////////////////////////////////////////////////////////
+
+struct NativeExpression::Program
+{
+	Block statements;
+	std::vector<IECore::TypeId> inputTypes;
+	size_t numLocals;
+	size_t numOutputs;
+};
+
+NativeExpression::NativeExpression( std::unique_ptr<const Program> program )
+	:	m_program( std::move( program ) )
+{
+}
+
+NativeExpression::~NativeExpression()
+{
+}
+
+std::unique_ptr<const NativeExpression> NativeExpression::compile( const Gaffer::Expression *node, const std::string &expression, const std::vector<Gaffer::ValuePlug *> &inputs, const std::vector<Gaffer::ValuePlug *> &outputs )
+{
+	std::unique_ptr<Program> program( new Program );
+
+	std::unordered_map<std::string, size_t> inputIndices;
+	for( size_t i = 0; i < inputs.size(); ++i )
+	{
+		if( !supportedPlugType( inputs[i] ) )
+		{
+			return nullptr;
+		}
+		inputIndices[inputs[i]->relativeName( node->parent() )] = i;
+		program->inputTypes.push_back( inputs[i]->typeId() );
+	}
+
+	std::unordered_map<std::string, size_t> outputIndices;
+	for( size_t i = 0; i < outputs.size(); ++i )
+	{
+		if( !supportedPlugType( outputs[i] ) )
+		{
+			return nullptr;
+		}
+		outputIndices[outputs[i]->relativeName( node->parent() )] = i;
+	}
+	program->numOutputs = outputs.size();
+
+	try
+	{
+		Parser parser( expression, inputIndices, outputIndices );
+		program->statements = parser.parse();
+		program->numLocals = parser.numLocals();
+	}
+	catch( const Unsupported & )
+	{
+		return nullptr;
+	}
+
+	return std::unique_ptr<const NativeExpression>( new NativeExpression( std::move( program ) ) );
+}
+
+IECore::ConstObjectVectorPtr NativeExpression::execute( const Gaffer::Context *context, const std::vector<const Gaffer::ValuePlug *> &proxyInputs ) const
+{
+	EvaluationState state( context, m_program->numLocals, m_program->numOutputs );
+
+	state.inputs.reserve( proxyInputs.size() );
+	for( size_t i = 0; i < proxyInputs.size(); ++i )
+	{
+		const ValuePlug *plug = proxyInputs[i];
+		switch( (int)m_program->inputTypes[i] )
+		{
+			case IntPlugTypeId :
+				state.inputs.push_back( Value::fromInt( static_cast<const IntPlug *>( plug )->getValue() ) );
+				break;
+			case FloatPlugTypeId :
+				state.inputs.push_back( Value::fromFloat( static_cast<const FloatPlug *>( plug )->getValue() ) );
+				break;
+			case BoolPlugTypeId :
+				state.inputs.push_back( Value::fromBool( static_cast<const BoolPlug *>( plug )->getValue() ) );
+				break;
+			default :
+				state.inputs.push_back( Value::fromString( static_cast<const StringPlug *>( plug )->getValue() ) );
+				break;
+		}
+	}
+
+	try
+	{
+		::execute( m_program->statements, state );
+	}
+	catch( const Unsupported & )
+	{
+		return nullptr;
+	}
+
+	ObjectVectorPtr result = new ObjectVector;
+	result->members().reserve( state.outputs.size() );
+	for( size_t i = 0; i < state.outputs.size(); ++i )
+	{
+		if( !state.outputsAssigned[i] )
+		{
+			result->members().push_back( NullObject::defaultNullObject() );
+			continue;
+		}
+
+		const Value &v = state.outputs[i];
+		switch( v.type )
+		{
+			case Value::Bool :
+				result->members().push_back( new BoolData( v.i != 0 ) );
+				break;
+			case Value::Int :
+				if( v.i < std::numeric_limits<int>::min() || v.i > std::numeric_limits<int>::max() )
+				{
+					return nullptr;
+				}
+				result->members().push_back( new IntData( (int)v.i ) );
+				break;
+			case Value::Float :
+				result->members().push_back( new FloatData( (float)v.f ) );
+				break;
+			case Value::String :
+				result->members().push_back( new StringData( v.s ) );
+				break;
+			default :
+				// Python raises for None.
+				return nullptr;
+		}
+	}
+
+	return result;
+}
+
+bool NativeExpression::apply( Gaffer::ValuePlug *proxyOutput, const Gaffer::ValuePlug *topLevelProxyOutput, const IECore::Object *value )
+{
+	if( proxyOutput != topLevelProxyOutput )
+	{
+		return false;
+	}
+
+	if( value->isInstanceOf( NullObjectTypeId ) )
+	{
+		proxyOutput->setToDefault();
+		return true;
+	}
+
+	switch( (int)proxyOutput->typeId() )
+	{
+		case IntPlugTypeId :
+			switch( (int)value->typeId() )
+			{
+				case IntDataTypeId :
+					static_cast<IntPlug *>( proxyOutput )->setValue( static_cast<const IntData *>( value )->readable() );
+					return true;
+				case BoolDataTypeId :
+					static_cast<IntPlug *>( proxyOutput )->setValue( static_cast<const BoolData *>( value )->readable() );
+					return true;
+				case FloatDataTypeId : {
+					// Python's `int()` truncates towards zero.
+					const float f = static_cast<const FloatData *>( value )->readable();
+					if( !std::isfinite( f ) || f <= (float)std::numeric_limits<int>::min() || f >= (float)std::numeric_limits<int>::max() )
+					{
+						return false;
+					}
+					static_cast<IntPlug *>( proxyOutput )->setValue( (int)f );
+					return true;
+				}
+				default :
+					return false;
+			}
+		case FloatPlugTypeId :
+			switch( (int)value->typeId() )
+			{
+				case FloatDataTypeId :
+					static_cast<FloatPlug *>( proxyOutput )->setValue( static_cast<const FloatData *>( value )->readable() );
+					return true;
+				case IntDataTypeId :
+					static_cast<FloatPlug *>( proxyOutput )->setValue( static_cast<const IntData *>( value )->readable() );
+					return true;
+				default :
+					return false;
+			}
+		case BoolPlugTypeId :
+			if( auto d = runTimeCast<const BoolData>( value ) )
+			{
+				static_cast<BoolPlug *>( proxyOutput )->setValue( d->readable() );
+				return true;
+			}
+			return false;
+		case StringPlugTypeId :
+			if( auto d = runTimeCast<const StringData>( value ) )
+			{
+				static_cast<StringPlug *>( proxyOutput )->setValue( d->readable() );
+				return true;
+			}
+			return false;
+		default :
+			return false;
+	}
+}
@@ -0,0 +1,92 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2021, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#ifndef GAFFERMODULE_NATIVEEXPRESSION_H
+#define GAFFERMODULE_NATIVEEXPRESSION_H
+
+#include "Gaffer/Context.h"
+#include "Gaffer/Expression.h"
+
+#include "IECore/VectorTypedData.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace GafferModule
+{
+
+/// Native evaluator for a simple subset of the expressions supported by
+/// the Python expression engine. Straight-line code and `if` statements
+/// containing arithmetic, comparisons, string formatting, context reads
+/// and reads/writes of simple plugs are evaluated without the GIL,
+/// allowing such expressions to be computed concurrently.
+class NativeExpression
+{
+
+	public :
+
+		~NativeExpression();
+
+		/// Returns a NativeExpression equivalent to the Python `expression`,
+		/// or null if the expression uses anything outside the supported subset.
+		/// `inputs` and `outputs` must be those reported by the Python engine.
+		static std::unique_ptr<const NativeExpression> compile( const Gaffer::Expression *node, const std::string &expression, const std::vector<Gaffer::ValuePlug *> &inputs, const std::vector<Gaffer::ValuePlug *> &outputs );
+
+		/// Equivalent to `Expression::Engine::execute()`. Returns null if the
+		/// expression must be executed by Python instead. This includes all
+		/// cases which would raise an exception in Python, so that errors are
+		/// always reported exactly as Python would report them.
+		IECore::ConstObjectVectorPtr execute( const Gaffer::Context *context, const std::vector<const Gaffer::ValuePlug *> &proxyInputs ) const;
+
+		/// Equivalent to `Expression::Engine::apply()` for the Python engine.
+		/// Returns false if the value must be applied by Python instead.
+		static bool apply( Gaffer::ValuePlug *proxyOutput, const Gaffer::ValuePlug *topLevelProxyOutput, const IECore::Object *value );
+
+	private :
+
+		struct Program;
+
+		NativeExpression( std::unique_ptr<const Program> program );
+
+		std::unique_ptr<const Program> m_program;
+
+};
+
+} // namespace GafferModule
+
+#endif // GAFFERMODULE_NATIVEEXPRESSION_H
@@ -49,6 +49,7 @@
 #include "Gaffer/ScriptNode.h"
 
 #include "IECorePython/ExceptionAlgo.h"
+#include "IECorePython/ScopedGILRelease.h"
 
 using namespace boost::python;
 using namespace IECorePython;
@@ -91,6 +92,41 @@ struct BinaryPlugSlotCaller
 	}
 };
 
+struct PlugVectorSignalCaller
+{
+	static void call( Node::PlugVectorSignal &s, object pythonPlugs )
+	{
+		std::vector<Plug *> plugs;
+		for( size_t i = 0, e = len( pythonPlugs ); i < e; ++i )
+		{
+			plugs.push_back( extract<Plug *>( pythonPlugs[i] ) );
+		}
+		IECorePython::ScopedGILRelease gilRelease;
+		s( plugs );
+	}
+};
+
+struct PlugVectorSlotCaller
+{
+	boost::signals::detail::unusable operator()( boost::python::object slot, const std::vector<Plug *> &plugs )
+	{
+		try
+		{
+			boost::python::list pythonPlugs;
+			for( auto plug : plugs )
+			{
+				pythonPlugs.append( PlugPtr( plug ) );
+			}
+			slot( pythonPlugs );
+		}
+		catch( const error_already_set &e )
+		{
+			PyErr_PrintEx( 0 ); // clears the error status
+		}
+		return boost::signals::detail::unusable();
+	}
+};
+
 struct ErrorSlotCaller
 {
 	boost::signals::detail::unusable operator()( boost::python::object slot, const Plug *plug, const Plug *source, const std::string &error )
@@ -120,11 +156,13 @@ void GafferModule::bindNode()
 			.def( "plugInputChangedSignal", &Node::plugInputChangedSignal, return_internal_reference<1>() )
 			.def( "plugFlagsChangedSignal", &Node::plugFlagsChangedSignal, return_internal_reference<1>() )
 			.def( "plugDirtiedSignal", &Node::plugDirtiedSignal, return_internal_reference<1>() )
+			.def( "plugsDirtiedSignal", &Node::plugsDirtiedSignal, return_internal_reference<1>() )
 			.def( "errorSignal", (Node::ErrorSignal &(Node::*)())&Node::errorSignal, return_internal_reference<1>() )
 		;
 
 		SignalClass<Node::UnaryPlugSignal, DefaultSignalCaller<Node::UnaryPlugSignal>, UnaryPlugSlotCaller >( "UnaryPlugSignal" );
 		SignalClass<Node::BinaryPlugSignal, DefaultSignalCaller<Node::BinaryPlugSignal>, BinaryPlugSlotCaller >( "BinaryPlugSignal" );
+		SignalClass<Node::PlugVectorSignal, PlugVectorSignalCaller, PlugVectorSlotCaller >( "PlugVectorSignal" );
 		SignalClass<Node::ErrorSignal, DefaultSignalCaller<Node::ErrorSignal>, ErrorSlotCaller >( "ErrorSignal" );
 	}
 
@@ -54,7 +54,7 @@ using namespace boost::python;
 namespace
 {
 
-BackgroundTask *backgroundTaskConstructor( const Plug *subject, object f )
+BackgroundTask *backgroundTaskConstructor( const Plug *subject, object f, BackgroundTask::Priority priority )
 {
 	auto fPtr = std::make_shared<boost::python::object>( f );
 	return new BackgroundTask(
@@ -74,7 +74,8 @@ BackgroundTask *backgroundTaskConstructor( const Plug *subject, object f )
 				fPtr.reset();
 				IECorePython::ExceptionAlgo::translatePythonException();
 			}
-		}
+		},
+		priority
 	);
 }
 
@@ -108,6 +109,11 @@ BackgroundTask::Status backgroundTaskStatus( const BackgroundTask &b )
 	return b.status();
 }
 
+BackgroundTask::Priority backgroundTaskPriority( const BackgroundTask &b )
+{
+	return b.priority();
+}
+
 struct GILReleaseUIThreadFunction
 {
 
@@ -196,7 +202,7 @@ void popUIThreadCallHandler()
 	ParallelAlgo::popUIThreadCallHandler();
 }
 
-std::shared_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, boost::python::object f )
+std::shared_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, boost::python::object f, BackgroundTask::Priority priority )
 {
 	// The BackgroundTask we return will own the python function we
 	// pass to it. Wrap the function so that the GIL is acquired
@@ -221,7 +227,8 @@ std::shared_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, boo
 			{
 				IECorePython::ExceptionAlgo::translatePythonException();
 			}
-		}
+		},
+		priority
 	);
 
 	return std::shared_ptr<BackgroundTask>(
@@ -243,13 +250,16 @@ void GafferModule::bindParallelAlgo()
 {
 
 	{
-		scope s = class_<BackgroundTask, boost::noncopyable>( "BackgroundTask", no_init )
-			.def( "__init__", make_constructor( &backgroundTaskConstructor, default_call_policies() ) )
-			.def( "cancel", &backgroundTaskCancel )
-			.def( "wait", &backgroundTaskWait )
-			.def( "waitFor", &backgroundTaskWaitFor )
-			.def( "cancelAndWait", &backgroundTaskCancelAndWait )
-			.def( "status", &backgroundTaskStatus )
+		class_<BackgroundTask, boost::noncopyable> backgroundTaskClass( "BackgroundTask", no_init );
+		scope s = backgroundTaskClass;
+
+		// The Priority enum must be registered before any `def()` which uses
+		// it as a default argument, as the default is converted to Python
+		// immediately.
+		enum_<BackgroundTask::Priority>( "Priority" )
+			.value( "Speculative", BackgroundTask::Speculative )
+			.value( "Visible", BackgroundTask::Visible )
+			.value( "Interactive", BackgroundTask::Interactive )
 		;
 
 		enum_<BackgroundTask::Status>( "Status" )
@@ -259,6 +269,16 @@ void GafferModule::bindParallelAlgo()
 			.value( "Cancelled", BackgroundTask::Cancelled )
 			.value( "Errored", BackgroundTask::Errored )
 		;
+
+		backgroundTaskClass
+			.def( "__init__", make_constructor( &backgroundTaskConstructor, default_call_policies(), ( arg( "subject" ), arg( "function" ), arg( "priority" ) = BackgroundTask::Visible ) ) )
+			.def( "cancel", &backgroundTaskCancel )
+			.def( "wait", &backgroundTaskWait )
+			.def( "waitFor", &backgroundTaskWaitFor )
+			.def( "cancelAndWait", &backgroundTaskCancelAndWait )
+			.def( "status", &backgroundTaskStatus )
+			.def( "priority", &backgroundTaskPriority )
+		;
 	}
 
 	register_ptr_to_python<std::shared_ptr<BackgroundTask>>();
@@ -270,6 +290,6 @@ void GafferModule::bindParallelAlgo()
 	def( "callOnUIThread", &callOnUIThread );
 	def( "pushUIThreadCallHandler", &pushUIThreadCallHandler );
 	def( "popUIThreadCallHandler", &popUIThreadCallHandler );
-	def( "callOnBackgroundThread", &callOnBackgroundThread );
+	def( "callOnBackgroundThread", &callOnBackgroundThread, ( arg( "subject" ), arg( "f" ), arg( "priority" ) = BackgroundTask::Visible ) );
 
 }
@@ -57,9 +57,11 @@
 #include "IECore/MessageHandler.h"
 
 #include "boost/algorithm/string/replace.hpp"
+#include "boost/format.hpp"
 #include "boost/lexical_cast.hpp"
 #include "boost/regex.hpp"
 
+#include <cstring>
 #include <memory>
 
 using namespace Gaffer;
@@ -72,6 +74,8 @@ using namespace GafferBindings;
 extern "C"
 {
 
+#include "marshal.h"
+
 // Essential to include this last, since it defines macros which
 // clash with other headers.
 #include "Python-ast.h"
@@ -119,6 +123,50 @@ const std::string formattedErrorContext( int lineNumber, const std::string &cont
 	);
 }
 
+// Returns a new module containing just the specified top-level
+// statement from `mod`.
+mod_ty singleStatementModule( mod_ty mod, int statementIndex, PyArena *arena )
+{
+	asdl_seq *newBody = asdl_seq_new( 1, arena );
+	asdl_seq_SET( newBody, 0, asdl_seq_GET( mod->v.Module.body, statementIndex ) );
+	return Module(
+		newBody,
+		arena
+	);
+}
+
+// Evaluates `code`, returning true if an error occurred. If `continueOnError`
+// is true then errors are reported via the message handler, otherwise they are
+// thrown as exceptions.
+bool evalCode( PyObject *code, boost::python::object globals, boost::python::object locals, bool continueOnError, const std::string &context )
+{
+	boost::python::handle<> v( boost::python::allow_null(
+		PyEval_EvalCode(
+#if PY_MAJOR_VERSION >= 3
+			code,
+#else
+			(PyCodeObject *)code,
+#endif
+			globals.ptr(),
+			locals.ptr()
+		)
+	) );
+
+	if( v != nullptr )
+	{
+		return false;
+	}
+
+	int lineNumber = 0;
+	std::string message = IECorePython::ExceptionAlgo::formatPythonException( /* withTraceback = */ false, &lineNumber );
+	if( !continueOnError )
+	{
+		throw IECore::Exception( formattedErrorContext( lineNumber, context ) + " : " + message );
+	}
+	IECore::msg( IECore::Msg::Error, formattedErrorContext( lineNumber, context ), message );
+	return true;
+}
+
 // Execute the script one top level statement at a time,
 // reporting errors that occur, but otherwise continuing
 // with execution.
@@ -154,38 +202,211 @@ bool tolerantExec( const char *pythonScript, boost::python::object globals, boos
 	int numStatements = asdl_seq_LEN( mod->v.Module.body );
 	for( int i=0; i<numStatements; ++i )
 	{
-		// Make a new module containing just this one statement.
-		asdl_seq *newBody = asdl_seq_new( 1, arena.get() );
-		asdl_seq_SET( newBody, 0, asdl_seq_GET( mod->v.Module.body, i ) );
-		mod_ty newModule = Module(
-			newBody,
+		// Make a new module containing just this one statement,
+		// and compile it.
+		mod_ty newModule = singleStatementModule( mod, i, arena.get() );
+		boost::python::handle<PyCodeObject> code( PyAST_Compile( newModule, "<string>", nullptr, arena.get() ) );
+
+		// And execute it, reporting any errors.
+		result |= evalCode( (PyObject *)code.get(), globals, locals, /* continueOnError = */ true, context );
+	}
+
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Binary serialisation
+//////////////////////////////////////////////////////////////////////////
+
+// Binary (".gfrb") serialisations contain the regular Python serialisation
+// followed by the marshalled bytecode for each of its top-level statements.
+// Loading can then skip parsing and compilation, which account for a large
+// fraction of the load time for big scripts. The source is retained so that
+// files remain loadable by a Python with an incompatible bytecode format.
+//
+// Layout :
+//
+// - Magic (8 bytes)
+// - Format version (uint32)
+// - Python bytecode magic number (int32)
+// - Source size (uint64), source
+// - Number of statements (uint64)
+// - For each statement : code size (uint64), marshalled code
+
+const char g_binaryMagic[] = "GAFFERB\n";
+const size_t g_binaryMagicSize = sizeof( g_binaryMagic ) - 1;
+const uint32_t g_binaryFormatVersion = 1;
+
+bool isBinary( const std::string &serialisation )
+{
+	return serialisation.compare( 0, g_binaryMagicSize, g_binaryMagic ) == 0;
+}
+
+template<typename T>
+void writeValue( std::string &data, T value )
+{
+	data.append( reinterpret_cast<const char *>( &value ), sizeof( T ) );
+}
+
+void writeBlock( std::string &data, const char *block, size_t size )
+{
+	writeValue<uint64_t>( data, size );
+	data.append( block, size );
+}
+
+class BinaryReader
+{
+
+	public :
+
+		BinaryReader( const std::string &data )
+			:	m_data( data ), m_offset( g_binaryMagicSize )
+		{
+		}
+
+		template<typename T>
+		T readValue()
+		{
+			T result;
+			memcpy( &result, read( sizeof( T ) ), sizeof( T ) );
+			return result;
+		}
+
+		std::pair<const char *, size_t> readBlock()
+		{
+			const size_t size = readValue<uint64_t>();
+			return { read( size ), size };
+		}
+
+	private :
+
+		const char *read( size_t size )
+		{
+			if( size > m_data.size() - m_offset )
+			{
+				throw IECore::Exception( "Binary serialisation is truncated" );
+			}
+			const char *result = m_data.data() + m_offset;
+			m_offset += size;
+			return result;
+		}
+
+		const std::string &m_data;
+		size_t m_offset;
+
+};
+
+std::string replaceImath( const std::string &serialisation );
+
+std::string compile( const std::string &textSerialisation )
+{
+	if( !Py_IsInitialized() )
+	{
+		Py_Initialize();
+	}
+
+	IECorePython::ScopedGILLock gilLock;
+
+	// Text serialisations may have been written by versions predating the
+	// `imath` module, but binary serialisations are executed without
+	// `replaceImath()`, so we must update them before compiling.
+	const std::string serialisation = replaceImath( textSerialisation );
+
+	std::string result( g_binaryMagic, g_binaryMagicSize );
+	writeValue<uint32_t>( result, g_binaryFormatVersion );
+	writeValue<int32_t>( result, PyImport_GetMagicNumber() );
+	writeBlock( result, serialisation.data(), serialisation.size() );
+
+	try
+	{
+		std::unique_ptr<PyArena, decltype( &PyArena_Free )> arena( PyArena_New(), PyArena_Free );
+		mod_ty mod = PyParser_ASTFromString(
+			serialisation.c_str(),
+			"<string>",
+			Py_file_input,
+			nullptr,
 			arena.get()
 		);
 
-		// Compile it.
-		boost::python::handle<PyCodeObject> code( PyAST_Compile( newModule, "<string>", nullptr, arena.get() ) );
+		if( !mod )
+		{
+			boost::python::throw_error_already_set();
+		}
 
-		// And execute it.
-		boost::python::handle<> v( boost::python::allow_null(
-			PyEval_EvalCode(
-#if PY_MAJOR_VERSION >= 3
-				(PyObject *)code.get(),
-#else
-				code.get(),
-#endif
-				globals.ptr(),
-				locals.ptr()
-			)
-		) );
+		const int numStatements = asdl_seq_LEN( mod->v.Module.body );
+		writeValue<uint64_t>( result, numStatements );
+		for( int i=0; i<numStatements; ++i )
+		{
+			mod_ty newModule = singleStatementModule( mod, i, arena.get() );
+			boost::python::handle<PyCodeObject> code( PyAST_Compile( newModule, "<string>", nullptr, arena.get() ) );
+			boost::python::handle<> marshalled( PyMarshal_WriteObjectToString( (PyObject *)code.get(), Py_MARSHAL_VERSION ) );
+
+			char *data = nullptr;
+			Py_ssize_t size = 0;
+			if( PyBytes_AsStringAndSize( marshalled.get(), &data, &size ) == -1 )
+			{
+				boost::python::throw_error_already_set();
+			}
+			writeBlock( result, data, size );
+		}
+	}
+	catch( boost::python::error_already_set &e )
+	{
+		IECorePython::ExceptionAlgo::translatePythonException();
+	}
+
+	return result;
+}
+
+// Executes a binary serialisation, returning true if errors were ignored.
+bool executeBinary( const std::string &serialisation, boost::python::object globals, boost::python::object locals, bool continueOnError, const std::string &context )
+{
+	BinaryReader reader( serialisation );
+	const uint32_t formatVersion = reader.readValue<uint32_t>();
+	if( formatVersion != g_binaryFormatVersion )
+	{
+		throw IECore::Exception( boost::str( boost::format( "Unsupported binary serialisation version %d" ) % formatVersion ) );
+	}
 
-		// Report any errors.
-		if( v == nullptr)
+	const int32_t pythonMagic = reader.readValue<int32_t>();
+	const auto source = reader.readBlock();
+	if( pythonMagic != (int32_t)PyImport_GetMagicNumber() )
+	{
+		// Bytecode was written by an incompatible Python,
+		// so fall back to executing the source.
+		const std::string sourceString( source.first, source.second );
+		if( continueOnError )
+		{
+			return tolerantExec( sourceString.c_str(), globals, locals, context );
+		}
+		try
+		{
+			exec( sourceString.c_str(), globals, locals );
+		}
+		catch( boost::python::error_already_set &e )
 		{
 			int lineNumber = 0;
 			std::string message = IECorePython::ExceptionAlgo::formatPythonException( /* withTraceback = */ false, &lineNumber );
-			IECore::msg( IECore::Msg::Error, formattedErrorContext( lineNumber, context ), message );
-			result = true;
+			throw IECore::Exception( formattedErrorContext( lineNumber, context ) + " : " + message );
 		}
+		return false;
+	}
+
+	bool result = false;
+	const size_t numStatements = reader.readValue<uint64_t>();
+	for( size_t i = 0; i < numStatements; ++i )
+	{
+		const auto block = reader.readBlock();
+		boost::python::handle<> code( boost::python::allow_null(
+			PyMarshal_ReadObjectFromString( const_cast<char *>( block.first ), block.second )
+		) );
+		if( !code || !PyCode_Check( code.get() ) )
+		{
+			PyErr_Clear();
+			throw IECore::Exception( "Binary serialisation contains invalid bytecode" );
+		}
+
+		result |= evalCode( code.get(), globals, locals, continueOnError, context );
 	}
 
 	return result;
@@ -314,9 +535,27 @@ bool execute( ScriptNode *script, const std::string &serialisation, Node *parent
 		Py_Initialize();
 	}
 
+	IECorePython::ScopedGILLock gilLock;
+
+	if( isBinary( serialisation ) )
+	{
+		// Binary serialisations are only ever compiled from source
+		// that `replaceImath()` has already been applied to.
+		bool result = false;
+		try
+		{
+			boost::python::object e = executionDict( script, parent );
+			result = executeBinary( serialisation, e, e, continueOnError, context );
+		}
+		catch( boost::python::error_already_set &e )
+		{
+			IECorePython::ExceptionAlgo::translatePythonException();
+		}
+		return result;
+	}
+
 	const std::string toExecute = replaceImath( serialisation );
 
-	IECorePython::ScopedGILLock gilLock;
 	bool result = false;
 	try
 	{
@@ -359,6 +598,7 @@ struct SerialiserRegistration
 	{
 		ScriptNode::g_serialiseFunction = serialise;
 		ScriptNode::g_executeFunction = execute;
+		ScriptNode::g_compileFunction = compile;
 	}
 };
 
@@ -0,0 +1,727 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2021, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#include "GafferScene/Private/IECoreGLPreview/MeshProxyAlgo.h"
+
+#include "IECore/Exception.h"
+
+#include "OpenEXR/ImathVec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <tuple>
+
+using namespace std;
+using namespace Imath;
+using namespace IECore;
+using namespace IECoreScene;
+using namespace IECoreGLPreview;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Meshes with fewer triangles than this are drawn without proxies.
+const size_t g_minimumProxyTriangles = 100000;
+// We don't make proxies with fewer triangles than this.
+const size_t g_minimumLevelTriangles = 1000;
+const size_t g_levelReduction = 4;
+// Density of triangles we aim to draw on screen.
+const float g_trianglesPerPixel = 0.5f;
+
+// Controls how quickly the error threshold for edge
+// collapses grows from one iteration to the next.
+const double g_aggressiveness = 7.0;
+const int g_maxIterations = 100;
+
+// Symmetric 4x4 matrix representing the sum of squared
+// distances to a set of planes.
+struct Quadric
+{
+
+	Quadric()
+	{
+		std::fill( m, m + 10, 0.0 );
+	}
+
+	// Quadric for the plane `ax + by + cz + d = 0`.
+	Quadric( double a, double b, double c, double d )
+		:	m { a * a, a * b, a * c, a * d, b * b, b * c, b * d, c * c, c * d, d * d }
+	{
+	}
+
+	Quadric &operator += ( const Quadric &other )
+	{
+		for( int i = 0; i < 10; ++i )
+		{
+			m[i] += other.m[i];
+		}
+		return *this;
+	}
+
+	Quadric operator + ( const Quadric &other ) const
+	{
+		Quadric result = *this;
+		result += other;
+		return result;
+	}
+
+	double error( const V3d &p ) const
+	{
+		return
+			m[0] * p.x * p.x + 2 * m[1] * p.x * p.y + 2 * m[2] * p.x * p.z + 2 * m[3] * p.x +
+			m[4] * p.y * p.y + 2 * m[5] * p.y * p.z + 2 * m[6] * p.y +
+			m[7] * p.z * p.z + 2 * m[8] * p.z +
+			m[9]
+		;
+	}
+
+	// Finds the point minimising `error()`, returning
+	// false if there is no unique solution.
+	bool minimum( V3d &p ) const
+	{
+		// Solve `A p = -b` using Cramer's rule, where A is the
+		// upper left 3x3 submatrix and b is the last column.
+		const double det = determinant( m[0], m[1], m[2], m[1], m[4], m[5], m[2], m[5], m[7] );
+		if( std::abs( det ) < 1e-12 )
+		{
+			return false;
+		}
+
+		p.x = -determinant( m[3], m[1], m[2], m[6], m[4], m[5], m[8], m[5], m[7] ) / det;
+		p.y = -determinant( m[0], m[3], m[2], m[1], m[6], m[5], m[2], m[8], m[7] ) / det;
+		p.z = -determinant( m[0], m[1], m[3], m[1], m[4], m[6], m[2], m[5], m[8] ) / det;
+		return true;
+	}
+
+	double m[10];
+
+	private :
+
+		static double determinant(
+			double a11, double a12, double a13,
+			double a21, double a22, double a23,
+			double a31, double a32, double a33
+		)
+		{
+			return
+				a11 * ( a22 * a33 - a23 * a32 ) -
+				a12 * ( a21 * a33 - a23 * a31 ) +
+				a13 * ( a21 * a32 - a22 * a31 )
+			;
+		}
+
+};
+
+// Performs decimation by collapsing edges in order of increasing
+// error. Rather than maintain a priority queue of edges, we make
+// repeated passes over the triangles, collapsing any edges with an
+// error below a threshold which grows with each pass. This is
+// considerably faster for large meshes, at the expense of not always
+// choosing the very best collapse.
+class Decimator
+{
+
+	public :
+
+		Decimator( const MeshPrimitive *mesh )
+		{
+			const V3fVectorData *pData = mesh->variableData<V3fVectorData>( "P", PrimitiveVariable::Vertex );
+			if( !pData )
+			{
+				throw IECore::Exception( "MeshPrimitive has no Vertex \"P\" primitive variable" );
+			}
+
+			// Normalise the positions so that the error thresholds
+			// are independent of the scale of the mesh.
+
+			const vector<V3f> &p = pData->readable();
+			Box3d bound;
+			for( const auto &v : p )
+			{
+				bound.extendBy( V3d( v ) );
+			}
+			m_offset = bound.isEmpty() ? V3d( 0 ) : bound.center();
+			const double size = bound.isEmpty() ? 0.0 : bound.size()[bound.majorAxis()];
+			m_scale = size > 0.0 ? size : 1.0;
+
+			// Weld vertices with identical positions. Meshes are often
+			// split along UV seams, and because we only preserve "P" we
+			// are free to join them back together. This allows the seams
+			// to be simplified like any other part of the mesh.
+
+			vector<int> order( p.size() );
+			std::iota( order.begin(), order.end(), 0 );
+			std::sort(
+				order.begin(), order.end(),
+				[&p] ( int a, int b ) {
+					return std::tie( p[a].x, p[a].y, p[a].z ) < std::tie( p[b].x, p[b].y, p[b].z );
+				}
+			);
+
+			vector<int> vertexMap( p.size() );
+			for( size_t i = 0, e = order.size(); i < e; ++i )
+			{
+				if( i == 0 || p[order[i]] != p[order[i-1]] )
+				{
+					Vertex v;
+					v.p = ( V3d( p[order[i]] ) - m_offset ) / m_scale;
+					m_vertices.push_back( v );
+				}
+				vertexMap[order[i]] = m_vertices.size() - 1;
+			}
+
+			// Triangulate, omitting any triangles made
+			// degenerate by welding.
+
+			const vector<int> &verticesPerFace = mesh->verticesPerFace()->readable();
+			const vector<int> &vertexIds = mesh->vertexIds()->readable();
+			m_triangles.reserve( MeshProxyAlgo::numTriangles( mesh ) );
+
+			size_t faceStart = 0;
+			for( int numFaceVertices : verticesPerFace )
+			{
+				for( int i = 1; i < numFaceVertices - 1; ++i )
+				{
+					Triangle t;
+					t.v[0] = vertexMap[vertexIds[faceStart]];
+					t.v[1] = vertexMap[vertexIds[faceStart + i]];
+					t.v[2] = vertexMap[vertexIds[faceStart + i + 1]];
+					if( t.v[0] != t.v[1] && t.v[1] != t.v[2] && t.v[2] != t.v[0] )
+					{
+						m_triangles.push_back( t );
+					}
+				}
+				faceStart += numFaceVertices;
+			}
+		}
+
+		void decimate( size_t targetTriangles )
+		{
+			const size_t initialTriangles = m_triangles.size();
+			size_t deletedTriangles = 0;
+			vector<char> deleted0;
+			vector<char> deleted1;
+
+			for( int iteration = 0; iteration < g_maxIterations; ++iteration )
+			{
+				if( initialTriangles - deletedTriangles <= targetTriangles )
+				{
+					break;
+				}
+
+				if( iteration % 5 == 0 )
+				{
+					updateMesh( iteration );
+				}
+
+				for( auto &t : m_triangles )
+				{
+					t.dirty = false;
+				}
+
+				const double threshold = 1e-9 * pow( double( iteration + 3 ), g_aggressiveness );
+
+				for( auto &t : m_triangles )
+				{
+					if( t.err[3] > threshold || t.deleted || t.dirty )
+					{
+						continue;
+					}
+
+					for( int j = 0; j < 3; ++j )
+					{
+						if( t.err[j] > threshold )
+						{
+							continue;
+						}
+
+						const int i0 = t.v[j];
+						const int i1 = t.v[(j+1)%3];
+						Vertex &v0 = m_vertices[i0];
+						Vertex &v1 = m_vertices[i1];
+
+						// Don't collapse borders into the interior,
+						// as that would shrink the mesh.
+						if( v0.border != v1.border )
+						{
+							continue;
+						}
+
+						V3d p;
+						edgeError( i0, i1, p );
+
+						deleted0.resize( v0.tcount );
+						deleted1.resize( v1.tcount );
+						if( flipped( p, i1, v0, deleted0 ) || flipped( p, i0, v1, deleted1 ) )
+						{
+							continue;
+						}
+
+						// Collapse v1 into v0.
+
+						v0.p = p;
+						v0.q += v1.q;
+
+						const int tstart = m_refs.size();
+						updateTriangles( i0, v0, deleted0, deletedTriangles );
+						updateTriangles( i0, v1, deleted1, deletedTriangles );
+						const int tcount = m_refs.size() - tstart;
+
+						if( tcount <= v0.tcount )
+						{
+							// Reuse the existing space.
+							std::copy( m_refs.begin() + tstart, m_refs.end(), m_refs.begin() + v0.tstart );
+							m_refs.resize( tstart );
+						}
+						else
+						{
+							v0.tstart = tstart;
+						}
+						v0.tcount = tcount;
+						break;
+					}
+
+					if( initialTriangles - deletedTriangles <= targetTriangles )
+					{
+						break;
+					}
+				}
+			}
+		}
+
+		MeshPrimitivePtr mesh() const
+		{
+			IntVectorDataPtr verticesPerFaceData = new IntVectorData;
+			IntVectorDataPtr vertexIdsData = new IntVectorData;
+			V3fVectorDataPtr pData = new V3fVectorData;
+			pData->setInterpretation( GeometricData::Point );
+
+			vector<int> &verticesPerFace = verticesPerFaceData->writable();
+			vector<int> &vertexIds = vertexIdsData->writable();
+			vector<V3f> &p = pData->writable();
+
+			vector<int> vertexMap( m_vertices.size(), -1 );
+			for( const auto &t : m_triangles )
+			{
+				if( t.deleted )
+				{
+					continue;
+				}
+				for( int j = 0; j < 3; ++j )
+				{
+					int &id = vertexMap[t.v[j]];
+					if( id == -1 )
+					{
+						id = p.size();
+						p.push_back( V3f( m_vertices[t.v[j]].p * m_scale + m_offset ) );
+					}
+					vertexIds.push_back( id );
+				}
+				verticesPerFace.push_back( 3 );
+			}
+
+			return new MeshPrimitive( verticesPerFaceData, vertexIdsData, "linear", pData );
+		}
+
+	private :
+
+		struct Triangle
+		{
+			int v[3];
+			double err[4];
+			bool deleted = false;
+			bool dirty = false;
+			V3d n;
+		};
+
+		struct Vertex
+		{
+			V3d p;
+			int tstart = 0;
+			int tcount = 0;
+			Quadric q;
+			bool border = false;
+		};
+
+		// Reference from a vertex to one of the triangles using it.
+		struct Ref
+		{
+			int tid;
+			int tvertex;
+		};
+
+		// Returns the error for collapsing the edge between `i0` and `i1`,
+		// filling `result` with the position for the collapsed vertex.
+		double edgeError( int i0, int i1, V3d &result ) const
+		{
+			const Vertex &v0 = m_vertices[i0];
+			const Vertex &v1 = m_vertices[i1];
+			const Quadric q = v0.q + v1.q;
+
+			const V3d mid = ( v0.p + v1.p ) * 0.5;
+			if(
+				!( v0.border && v1.border ) && q.minimum( result ) &&
+				// Reject solutions from badly conditioned quadrics,
+				// which can be far from the edge.
+				( result - mid ).length2() <= ( v1.p - v0.p ).length2()
+			)
+			{
+				return q.error( result );
+			}
+
+			// No suitable minimum, or a border edge which we
+			// must not move away from. Choose the best of the
+			// end points and the midpoint.
+
+			const double e0 = q.error( v0.p );
+			const double e1 = q.error( v1.p );
+			const double eMid = q.error( mid );
+			const double e = std::min( e0, std::min( e1, eMid ) );
+			if( e == e0 )
+			{
+				result = v0.p;
+			}
+			else if( e == e1 )
+			{
+				result = v1.p;
+			}
+			else
+			{
+				result = mid;
+			}
+			return e;
+		}
+
+		// Returns true if moving `v` to `p` would flip or degenerate
+		// any of its triangles. Also fills `deleted` to flag the
+		// triangles which would be removed by collapsing the edge
+		// to `other`.
+		bool flipped( const V3d &p, int other, const Vertex &v, vector<char> &deleted ) const
+		{
+			for( int k = 0; k < v.tcount; ++k )
+			{
+				const Ref &r = m_refs[v.tstart + k];
+				const Triangle &t = m_triangles[r.tid];
+				if( t.deleted )
+				{
+					continue;
+				}
+
+				const int id1 = t.v[(r.tvertex+1)%3];
+				const int id2 = t.v[(r.tvertex+2)%3];
+				if( id1 == other || id2 == other )
+				{
+					deleted[k] = 1;
+					continue;
+				}
+
+				const V3d d1 = ( m_vertices[id1].p - p ).normalized();
+				const V3d d2 = ( m_vertices[id2].p - p ).normalized();
+				if( std::abs( d1.dot( d2 ) ) > 0.999 )
+				{
+					return true;
+				}
+
+				const V3d n = d1.cross( d2 ).normalized();
+				deleted[k] = 0;
+				if( t.n != V3d( 0 ) && n.dot( t.n ) < 0.2 )
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// Updates the triangles using `v` following a collapse into
+		// `i0`, adding references for all the remaining triangles.
+		void updateTriangles( int i0, const Vertex &v, const vector<char> &deleted, size_t &deletedTriangles )
+		{
+			for( int k = 0; k < v.tcount; ++k )
+			{
+				const Ref r = m_refs[v.tstart + k];
+				Triangle &t = m_triangles[r.tid];
+				if( t.deleted )
+				{
+					continue;
+				}
+				if( deleted[k] )
+				{
+					t.deleted = true;
+					deletedTriangles++;
+					continue;
+				}
+
+				t.v[r.tvertex] = i0;
+				t.dirty = true;
+				updateNormal( t );
+				updateErrors( t );
+				m_refs.push_back( r );
+			}
+		}
+
+		void updateNormal( Triangle &t ) const
+		{
+			const V3d &p0 = m_vertices[t.v[0]].p;
+			t.n = ( m_vertices[t.v[1]].p - p0 ).cross( m_vertices[t.v[2]].p - p0 ).normalized();
+		}
+
+		void updateErrors( Triangle &t ) const
+		{
+			V3d p;
+			t.err[0] = edgeError( t.v[0], t.v[1], p );
+			t.err[1] = edgeError( t.v[1], t.v[2], p );
+			t.err[2] = edgeError( t.v[2], t.v[0], p );
+			t.err[3] = std::min( t.err[0], std::min( t.err[1], t.err[2] ) );
+		}
+
+		// Removes deleted triangles and rebuilds the references
+		// from vertices to triangles. On the first iteration, also
+		// initialises the quadrics and errors.
+		void updateMesh( int iteration )
+		{
+			if( iteration > 0 )
+			{
+				m_triangles.erase(
+					std::remove_if( m_triangles.begin(), m_triangles.end(), [] ( const Triangle &t ) { return t.deleted; } ),
+					m_triangles.end()
+				);
+			}
+
+			for( auto &v : m_vertices )
+			{
+				v.tcount = 0;
+			}
+			for( const auto &t : m_triangles )
+			{
+				for( int j = 0; j < 3; ++j )
+				{
+					m_vertices[t.v[j]].tcount++;
+				}
+			}
+			int tstart = 0;
+			for( auto &v : m_vertices )
+			{
+				v.tstart = tstart;
+				tstart += v.tcount;
+				v.tcount = 0;
+			}
+
+			m_refs.resize( m_triangles.size() * 3 );
+			for( size_t i = 0, e = m_triangles.size(); i < e; ++i )
+			{
+				const Triangle &t = m_triangles[i];
+				for( int j = 0; j < 3; ++j )
+				{
+					Vertex &v = m_vertices[t.v[j]];
+					m_refs[v.tstart + v.tcount] = { (int)i, j };
+					v.tcount++;
+				}
+			}
+
+			if( iteration > 0 )
+			{
+				return;
+			}
+
+			// Identify border vertices, as those with an edge
+			// used by only one triangle.
+
+			vector<int> vertexCounts;
+			vector<int> vertexIds;
+			for( auto &v : m_vertices )
+			{
+				vertexCounts.clear();
+				vertexIds.clear();
+				for( int k = 0; k < v.tcount; ++k )
+				{
+					const Triangle &t = m_triangles[m_refs[v.tstart + k].tid];
+					for( int j = 0; j < 3; ++j )
+					{
+						auto it = std::find( vertexIds.begin(), vertexIds.end(), t.v[j] );
+						if( it == vertexIds.end() )
+						{
+							vertexIds.push_back( t.v[j] );
+							vertexCounts.push_back( 1 );
+						}
+						else
+						{
+							vertexCounts[it - vertexIds.begin()]++;
+						}
+					}
+				}
+				for( size_t j = 0, e = vertexIds.size(); j < e; ++j )
+				{
+					if( vertexCounts[j] == 1 )
+					{
+						m_vertices[vertexIds[j]].border = true;
+					}
+				}
+			}
+
+			// Initialise quadrics from the triangle planes.
+
+			for( auto &t : m_triangles )
+			{
+				updateNormal( t );
+				const Quadric q( t.n.x, t.n.y, t.n.z, -t.n.dot( m_vertices[t.v[0]].p ) );
+				for( int j = 0; j < 3; ++j )
+				{
+					m_vertices[t.v[j]].q += q;
+				}
+			}
+
+			for( auto &t : m_triangles )
+			{
+				updateErrors( t );
+			}
+		}
+
+		vector<Vertex> m_vertices;
+		vector<Triangle> m_triangles;
+		vector<Ref> m_refs;
+
+		V3d m_offset;
+		double m_scale;
+
+};
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Public API
+//////////////////////////////////////////////////////////////////////////
+
+namespace IECoreGLPreview
+{
+
+namespace MeshProxyAlgo
+{
+
+IECoreScene::MeshPrimitivePtr decimate( const IECoreScene::MeshPrimitive *mesh, size_t targetTriangles )
+{
+	Decimator decimator( mesh );
+	decimator.decimate( targetTriangles );
+	return decimator.mesh();
+}
+
+size_t numTriangles( const IECoreScene::MeshPrimitive *mesh )
+{
+	size_t result = 0;
+	for( int n : mesh->verticesPerFace()->readable() )
+	{
+		result += std::max( n - 2, 0 );
+	}
+	return result;
+}
+
+std::vector<size_t> levelTriangleCounts( size_t numTriangles )
+{
+	std::vector<size_t> result = { numTriangles };
+	if( numTriangles < g_minimumProxyTriangles )
+	{
+		return result;
+	}
+
+	size_t n = numTriangles / g_levelReduction;
+	while( n >= g_minimumLevelTriangles )
+	{
+		result.push_back( n );
+		n /= g_levelReduction;
+	}
+
+	return result;
+}
+
+float projectedArea( const Imath::Box3f &bound, const Imath::M44f &worldToClip, const Imath::V2f &viewportSize )
+{
+	if( bound.isEmpty() )
+	{
+		return 0.0f;
+	}
+
+	Box2f ndcBound;
+	for( int i = 0; i < 8; ++i )
+	{
+		const V3f corner(
+			i & 1 ? bound.max.x : bound.min.x,
+			i & 2 ? bound.max.y : bound.min.y,
+			i & 4 ? bound.max.z : bound.min.z
+		);
+
+		const float w = corner.x * worldToClip[0][3] + corner.y * worldToClip[1][3] + corner.z * worldToClip[2][3] + worldToClip[3][3];
+		if( w <= 0.0f )
+		{
+			return std::numeric_limits<float>::infinity();
+		}
+
+		V3f ndc;
+		worldToClip.multVecMatrix( corner, ndc );
+		ndcBound.extendBy( V2f( ndc.x, ndc.y ) );
+	}
+
+	const V2f size = ndcBound.size() * viewportSize * 0.5f;
+	return size.x * size.y;
+}
+
+size_t selectLevel( const std::vector<size_t> &levelTriangleCounts, float projectedArea )
+{
+	const float targetTriangles = projectedArea * g_trianglesPerPixel;
+	for( size_t i = levelTriangleCounts.size(); i-- > 1; )
+	{
+		if( (float)levelTriangleCounts[i] >= targetTriangles )
+		{
+			return i;
+		}
+	}
+	return 0;
+}
+
+ConversionCompletedSignal &conversionCompletedSignal()
+{
+	static ConversionCompletedSignal g_signal;
+	return g_signal;
+}
+
+} // namespace MeshProxyAlgo
+
+} // namespace IECoreGLPreview
@@ -39,8 +39,13 @@
 #include "GafferScene/Private/IECoreGLPreview/AttributeVisualiser.h"
 #include "GafferScene/Private/IECoreGLPreview/LightVisualiser.h"
 #include "GafferScene/Private/IECoreGLPreview/LightFilterVisualiser.h"
+#include "GafferScene/Private/IECoreGLPreview/MeshProxyAlgo.h"
 #include "GafferScene/Private/IECoreGLPreview/ObjectVisualiser.h"
 
+#include "Gaffer/BackgroundTask.h"
+#include "Gaffer/ParallelAlgo.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
 #include "IECoreGL/CachedConverter.h"
 #include "IECoreGL/Camera.h"
 #include "IECoreGL/ColorTexture.h"
@@ -59,6 +64,8 @@
 #include "IECoreGL/ToGLCameraConverter.h"
 #include "IECoreGL/IECoreGL.h"
 
+#include "IECoreScene/MeshPrimitive.h"
+
 #include "IECore/CompoundParameter.h"
 #include "IECore/MessageHandler.h"
 #include "IECore/PathMatcherData.h"
@@ -74,7 +81,12 @@
 
 #include "tbb/concurrent_queue.h"
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -148,13 +160,13 @@ void renderMatchingVisualisations( Visualisation::Scale scale, Visualisation::Ca
 }
 
 template <class... Vs>
-void accumulateVisualisationBounds( Box3f &target, Visualisation::Scale scale, Visualisation::Category category, const M44f &transform, const Vs & ... visualisations )
+void accumulateVisualisationBounds( Box3f &target, bool framingOnly, Visualisation::Scale scale, Visualisation::Category category, const M44f &transform, const Vs & ... visualisations )
 {
 	for( auto vs : { visualisations... } )
 	{
 		for( auto v : vs )
 		{
-			if( !v.affectsFramingBound || v.scale != scale || !(v.category & category) )
+			if( ( framingOnly && !v.affectsFramingBound ) || v.scale != scale || !(v.category & category) )
 			{
 				continue;
 			}
@@ -201,6 +213,355 @@ T parameter( const IECore::CompoundDataMap &parameters, const IECore::InternedSt
 	}
 }
 
+// Objects are culled against a view frustum extended by this many
+// pixels, to allow for points and lines which are drawn with a width
+// in pixels, and therefore extend outside their bounds.
+const float g_cullingMarginPixels = 16.0f;
+// When selecting, the projection covers only the selection region,
+// so we can't measure the margin in pixels. Instead we extend by
+// a multiple of the size of the region.
+const float g_selectionCullingMargin = 4.0f;
+// Maximum number of items stored in each leaf of the hierarchy.
+const size_t g_maxLeafSize = 4;
+
+// Bounding volume hierarchy over the bounds of the objects in the renderer.
+// We use this to avoid drawing objects outside the view frustum, and to answer
+// ray and frustum queries on the CPU. Items are referred to by their index in
+// the vector of bounds passed to `build()`.
+class BoundingVolumeHierarchy
+{
+
+	public :
+
+		// Builds the hierarchy from scratch. Empty and infinite bounds
+		// can't be placed in the hierarchy, so those items are stored
+		// separately and returned by `unbounded()`. Clients should treat
+		// them as potentially intersecting every query.
+		void build( const vector<Box3f> &bounds )
+		{
+			m_nodes.clear();
+			m_items.clear();
+			m_unbounded.clear();
+
+			vector<BuildItem> buildItems;
+			buildItems.reserve( bounds.size() );
+			for( size_t i = 0; i < bounds.size(); ++i )
+			{
+				if( bounds[i].isEmpty() || bounds[i].isInfinite() )
+				{
+					m_unbounded.push_back( i );
+				}
+				else
+				{
+					buildItems.push_back( { bounds[i].center(), i } );
+				}
+			}
+
+			if( buildItems.empty() )
+			{
+				return;
+			}
+
+			m_nodes.reserve( 2 * buildItems.size() / g_maxLeafSize + 1 );
+			m_items.reserve( buildItems.size() );
+			buildWalk( bounds, buildItems.begin(), buildItems.end() );
+		}
+
+		// Updates the node bounds to account for changes to item bounds,
+		// without changing the structure of the hierarchy. Returns false
+		// if this isn't possible because a bounded item has become empty
+		// or infinite, or an unbounded item has gained a finite bound, in
+		// which case `build()` must be called instead.
+		bool refit( const vector<Box3f> &bounds )
+		{
+			for( size_t index : m_unbounded )
+			{
+				if( !bounds[index].isEmpty() && !bounds[index].isInfinite() )
+				{
+					return false;
+				}
+			}
+
+			// Nodes are stored in depth-first order, so children always
+			// follow their parents, and we can refit in a single reverse pass.
+			for( auto it = m_nodes.rbegin(); it != m_nodes.rend(); ++it )
+			{
+				Node &node = *it;
+				node.bound = Box3f();
+				if( node.count )
+				{
+					for( size_t i = node.first; i < node.first + node.count; ++i )
+					{
+						Item &item = m_items[i];
+						item.bound = bounds[item.index];
+						if( item.bound.isEmpty() || item.bound.isInfinite() )
+						{
+							return false;
+						}
+						node.bound.extendBy( item.bound );
+					}
+				}
+				else
+				{
+					const size_t index = &node - m_nodes.data();
+					node.bound.extendBy( m_nodes[index+1].bound );
+					node.bound.extendBy( m_nodes[node.secondChild].bound );
+				}
+			}
+			return true;
+		}
+
+		const vector<size_t> &unbounded() const
+		{
+			return m_unbounded;
+		}
+
+		// Calls `f( index )` for every item whose bound intersects the
+		// clip volume of `worldToClip`. The volume is extended in X and Y by
+		// `margin`, specified as a fraction of the NDC extent, so that
+		// primitives drawn with a fixed width in pixels are not culled
+		// prematurely.
+		template<typename F>
+		void queryFrustum( const M44f &worldToClip, const V2f &margin, F &&f ) const
+		{
+			if( m_nodes.size() )
+			{
+				queryFrustumWalk( 0, worldToClip, margin, f );
+			}
+		}
+
+		// Calls `f( index )` for every item whose bound is intersected by
+		// the ray starting at `origin` and travelling in `direction`.
+		template<typename F>
+		void queryRay( const V3f &origin, const V3f &direction, F &&f ) const
+		{
+			if( m_nodes.empty() )
+			{
+				return;
+			}
+
+			V3f inverseDirection;
+			for( int i = 0; i < 3; ++i )
+			{
+				inverseDirection[i] = direction[i] != 0.0f ? 1.0f / direction[i] : std::numeric_limits<float>::infinity();
+			}
+
+			vector<size_t> stack = { 0 };
+			while( stack.size() )
+			{
+				const size_t index = stack.back();
+				stack.pop_back();
+				const Node &node = m_nodes[index];
+				if( !rayIntersects( node.bound, origin, inverseDirection ) )
+				{
+					continue;
+				}
+				if( node.count )
+				{
+					for( size_t i = node.first; i < node.first + node.count; ++i )
+					{
+						const Item &item = m_items[i];
+						if( rayIntersects( item.bound, origin, inverseDirection ) )
+						{
+							f( item.index );
+						}
+					}
+				}
+				else
+				{
+					stack.push_back( node.secondChild );
+					stack.push_back( index + 1 );
+				}
+			}
+		}
+
+	private :
+
+		struct BuildItem
+		{
+			V3f center;
+			size_t index;
+		};
+		using BuildIterator = vector<BuildItem>::iterator;
+
+		struct Item
+		{
+			Box3f bound;
+			size_t index;
+		};
+
+		// Leaves have a non-zero `count` and refer to the items
+		// `m_items[first, first + count)`. Interior nodes have a zero
+		// `count`. Their first child immediately follows them, and
+		// the second child is at `secondChild`.
+		struct Node
+		{
+			Box3f bound;
+			size_t first = 0;
+			size_t count = 0;
+			size_t secondChild = 0;
+		};
+
+		size_t buildWalk( const vector<Box3f> &bounds, BuildIterator begin, BuildIterator end )
+		{
+			const size_t nodeIndex = m_nodes.size();
+			m_nodes.push_back( Node() );
+
+			Box3f bound;
+			Box3f centerBound;
+			for( auto it = begin; it != end; ++it )
+			{
+				bound.extendBy( bounds[it->index] );
+				centerBound.extendBy( it->center );
+			}
+			m_nodes[nodeIndex].bound = bound;
+
+			const size_t size = end - begin;
+			const int axis = centerBound.majorAxis();
+			if( size <= g_maxLeafSize || centerBound.size()[axis] == 0.0f )
+			{
+				Node &node = m_nodes[nodeIndex];
+				node.first = m_items.size();
+				node.count = size;
+				for( auto it = begin; it != end; ++it )
+				{
+					m_items.push_back( { bounds[it->index], it->index } );
+				}
+				return nodeIndex;
+			}
+
+			// Median split along the longest axis of the centers. We break
+			// ties using the item index, so that the hierarchy is deterministic.
+			auto mid = begin + size / 2;
+			std::nth_element(
+				begin, mid, end,
+				[axis]( const BuildItem &a, const BuildItem &b ) {
+					return a.center[axis] < b.center[axis] || ( a.center[axis] == b.center[axis] && a.index < b.index );
+				}
+			);
+
+			buildWalk( bounds, begin, mid );
+			const size_t secondChild = buildWalk( bounds, mid, end );
+			m_nodes[nodeIndex].secondChild = secondChild;
+			return nodeIndex;
+		}
+
+		enum class Containment
+		{
+			Outside,
+			Intersects,
+			Inside
+		};
+
+		static Containment frustumContainment( const Box3f &b, const M44f &worldToClip, const V2f &margin )
+		{
+			// Test each corner against the six clip planes in homogeneous
+			// clip space. Because the tests are linear, they remain valid for
+			// corners behind the eye, where the perspective divide would not.
+			V4f corners[8];
+			for( int i = 0; i < 8; ++i )
+			{
+				const V4f p(
+					i & 1 ? b.max.x : b.min.x,
+					i & 2 ? b.max.y : b.min.y,
+					i & 4 ? b.max.z : b.min.z,
+					1.0f
+				);
+				corners[i] = p * worldToClip;
+			}
+
+			bool inside = true;
+			for( int plane = 0; plane < 6; ++plane )
+			{
+				const int axis = plane / 2;
+				const float sign = plane % 2 ? -1.0f : 1.0f;
+				const float scale = axis < 2 ? 1.0f + margin[axis] : 1.0f;
+				int numInside = 0;
+				for( const auto &c : corners )
+				{
+					if( scale * c.w + sign * c[axis] >= 0.0f )
+					{
+						numInside++;
+					}
+				}
+				if( !numInside )
+				{
+					return Containment::Outside;
+				}
+				inside = inside && numInside == 8;
+			}
+
+			return inside ? Containment::Inside : Containment::Intersects;
+		}
+
+		template<typename F>
+		void queryFrustumWalk( size_t index, const M44f &worldToClip, const V2f &margin, F &f, bool inside = false ) const
+		{
+			const Node &node = m_nodes[index];
+			if( !inside )
+			{
+				const Containment containment = frustumContainment( node.bound, worldToClip, margin );
+				if( containment == Containment::Outside )
+				{
+					return;
+				}
+				inside = containment == Containment::Inside;
+			}
+
+			if( node.count )
+			{
+				for( size_t i = node.first; i < node.first + node.count; ++i )
+				{
+					const Item &item = m_items[i];
+					if( inside || frustumContainment( item.bound, worldToClip, margin ) != Containment::Outside )
+					{
+						f( item.index );
+					}
+				}
+			}
+			else
+			{
+				queryFrustumWalk( index + 1, worldToClip, margin, f, inside );
+				queryFrustumWalk( node.secondChild, worldToClip, margin, f, inside );
+			}
+		}
+
+		static bool rayIntersects( const Box3f &b, const V3f &origin, const V3f &inverseDirection )
+		{
+			float tMin = 0.0f;
+			float tMax = std::numeric_limits<float>::max();
+			for( int i = 0; i < 3; ++i )
+			{
+				if( std::isinf( inverseDirection[i] ) )
+				{
+					if( origin[i] < b.min[i] || origin[i] > b.max[i] )
+					{
+						return false;
+					}
+					continue;
+				}
+				float t0 = ( b.min[i] - origin[i] ) * inverseDirection[i];
+				float t1 = ( b.max[i] - origin[i] ) * inverseDirection[i];
+				if( t0 > t1 )
+				{
+					std::swap( t0, t1 );
+				}
+				tMin = std::max( tMin, t0 );
+				tMax = std::min( tMax, t1 );
+				if( tMin > tMax )
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		vector<Node> m_nodes;
+		vector<Item> m_items;
+		vector<size_t> m_unbounded;
+
+};
+
 const IECoreGL::State &selectionState()
 {
 	static IECoreGL::StatePtr s;
@@ -359,6 +720,250 @@ IE_CORE_DECLAREPTR( OpenGLAttributes )
 
 } // namespace
 
+//////////////////////////////////////////////////////////////////////////
+// MeshProxies
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Measured in triangles of the original meshes.
+const size_t g_meshProxiesCacheCost = 50000000;
+
+// Conversions which were still running when their MeshProxies were
+// destroyed. We keep them alive here rather than wait for them, so that
+// releasing proxies never stalls the UI thread.
+std::mutex g_retiredConversionsMutex;
+std::vector<std::unique_ptr<Gaffer::BackgroundTask>> g_retiredConversions;
+
+bool finished( const Gaffer::BackgroundTask &task )
+{
+	switch( task.status() )
+	{
+		case Gaffer::BackgroundTask::Pending :
+		case Gaffer::BackgroundTask::Running :
+			return false;
+		default :
+			return true;
+	}
+}
+
+void retireConversion( std::unique_ptr<Gaffer::BackgroundTask> conversion )
+{
+	conversion->cancel();
+
+	std::lock_guard<std::mutex> lock( g_retiredConversionsMutex );
+	g_retiredConversions.erase(
+		std::remove_if(
+			g_retiredConversions.begin(), g_retiredConversions.end(),
+			[] ( const std::unique_ptr<Gaffer::BackgroundTask> &task ) {
+				return finished( *task );
+			}
+		),
+		g_retiredConversions.end()
+	);
+
+	if( !finished( *conversion ) )
+	{
+		g_retiredConversions.push_back( std::move( conversion ) );
+	}
+}
+
+// Successively coarser approximations of a dense mesh, used to draw it at a
+// resolution suited to its size on screen. The proxies are generated up front,
+// but conversion of the original mesh is deferred until it is first drawn, and
+// performed in the background so as not to stall the viewport.
+class MeshProxies : public IECore::RefCounted
+{
+
+	public :
+
+		MeshProxies( const IECoreScene::MeshPrimitive *mesh, size_t numTriangles )
+			:	m_mesh( mesh ), m_bound( mesh->bound() ), m_levelTriangleCounts( MeshProxyAlgo::levelTriangleCounts( numTriangles ) ),
+				m_fullResolution( std::make_shared<FullResolution>() )
+		{
+			ConstMeshPrimitivePtr previousLevel = mesh;
+			for( size_t i = 1; i < m_levelTriangleCounts.size(); ++i )
+			{
+				ConstMeshPrimitivePtr level = MeshProxyAlgo::decimate( previousLevel.get(), m_levelTriangleCounts[i] );
+				const size_t levelTriangles = MeshProxyAlgo::numTriangles( level.get() );
+				ConstRenderablePtr renderable = convert( level.get() );
+				if( levelTriangles > m_levelTriangleCounts[i-1] / 2 || !renderable )
+				{
+					// Decimation stalled, typically because the mesh is made
+					// of many small disconnected pieces. Coarser levels would
+					// be no cheaper to draw, so stop here.
+					break;
+				}
+				m_levelTriangleCounts[i] = levelTriangles;
+				m_proxies.push_back( renderable );
+				previousLevel = level;
+			}
+
+			m_levelTriangleCounts.resize( m_proxies.size() + 1 );
+			if( m_proxies.empty() )
+			{
+				m_fullResolution->renderable = convert( mesh );
+			}
+		}
+
+		~MeshProxies() override
+		{
+			if( m_fullConversion )
+			{
+				retireConversion( std::move( m_fullConversion ) );
+			}
+		}
+
+		const Box3f &bound() const
+		{
+			return m_bound;
+		}
+
+		const std::vector<size_t> &levelTriangleCounts() const
+		{
+			return m_levelTriangleCounts;
+		}
+
+		// Level 0 is the original mesh, and subsequent levels are the
+		// proxies. If the original has not been converted yet, a background
+		// conversion is launched and the finest proxy is returned instead.
+		// When the conversion completes, `conversionCompletedSignal()` is
+		// emitted on the UI thread.
+		const IECoreGL::Renderable *renderable( size_t level ) const
+		{
+			if( level == 0 )
+			{
+				std::lock_guard<std::mutex> lock( m_fullResolution->mutex );
+				if( m_fullResolution->renderable || m_proxies.empty() )
+				{
+					return m_fullResolution->renderable.get();
+				}
+				if( !m_fullConversion )
+				{
+					m_fullConversion = std::make_unique<Gaffer::BackgroundTask>(
+						// No subject, because the conversion doesn't depend
+						// on any plugs and needn't be cancelled by graph edits.
+						nullptr,
+						// Captures by value, since the conversion may outlive us.
+						[mesh = m_mesh, fullResolution = m_fullResolution] ( const IECore::Canceller &canceller ) {
+							// The conversion itself can't be interrupted, so
+							// this is our only chance to skip it.
+							IECore::Canceller::check( &canceller );
+							ConstRenderablePtr renderable = convert( mesh.get() );
+							{
+								std::lock_guard<std::mutex> lock( fullResolution->mutex );
+								fullResolution->renderable = renderable;
+							}
+							requestRedraw();
+						}
+					);
+				}
+				level = 1;
+			}
+
+			return m_proxies[std::min( level, m_proxies.size() ) - 1].get();
+		}
+
+	private :
+
+		struct FullResolution
+		{
+			std::mutex mutex;
+			ConstRenderablePtr renderable;
+		};
+
+		static void requestRedraw()
+		{
+			try
+			{
+				Gaffer::ParallelAlgo::callOnUIThread(
+					[] { MeshProxyAlgo::conversionCompletedSignal()(); }
+				);
+			}
+			catch( const IECore::Exception & )
+			{
+				// No UIThreadCallHandler is installed, so there is
+				// no UI to redraw. This is expected for batch renders.
+			}
+		}
+
+		static ConstRenderablePtr convert( const IECoreScene::MeshPrimitive *mesh )
+		{
+			try
+			{
+				IECore::ConstRunTimeTypedPtr glObject = IECoreGL::CachedConverter::defaultCachedConverter()->convert( mesh );
+				return IECore::runTimeCast<const IECoreGL::Renderable>( glObject.get() );
+			}
+			catch( ... )
+			{
+				return nullptr;
+			}
+		}
+
+		IECoreScene::ConstMeshPrimitivePtr m_mesh;
+		Box3f m_bound;
+		std::vector<size_t> m_levelTriangleCounts;
+		std::vector<ConstRenderablePtr> m_proxies;
+
+		// Shared with `m_fullConversion`, which may outlive us.
+		const std::shared_ptr<FullResolution> m_fullResolution;
+		mutable std::unique_ptr<Gaffer::BackgroundTask> m_fullConversion;
+
+};
+
+IE_CORE_DECLAREPTR( MeshProxies )
+
+struct MeshProxiesCacheGetterKey
+{
+
+	MeshProxiesCacheGetterKey( const IECoreScene::MeshPrimitive *mesh, size_t numTriangles )
+		:	mesh( mesh ), numTriangles( numTriangles ), hash( mesh->Object::hash() )
+	{
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return hash;
+	}
+
+	const IECoreScene::MeshPrimitive *mesh;
+	const size_t numTriangles;
+	const IECore::MurmurHash hash;
+
+};
+
+using MeshProxiesCache = IECorePreview::LRUCache<IECore::MurmurHash, ConstMeshProxiesPtr, IECorePreview::LRUCachePolicy::Parallel, MeshProxiesCacheGetterKey>;
+
+// Shared between renderers, so that the Viewer doesn't regenerate proxies
+// every time an object is recreated, or when the same mesh is instanced.
+MeshProxiesCache &meshProxiesCache()
+{
+	static MeshProxiesCache g_cache(
+		[] ( const MeshProxiesCacheGetterKey &key, size_t &cost ) {
+			// The original mesh is held by the proxies, and
+			// dominates their cost.
+			cost = key.numTriangles;
+			return ConstMeshProxiesPtr( new MeshProxies( key.mesh, key.numTriangles ) );
+		},
+		g_meshProxiesCacheCost
+	);
+	return g_cache;
+}
+
+// The information needed to measure an object's size on screen, so that
+// a suitable level of detail can be chosen for drawing it.
+struct ScreenProjection
+{
+	M44f worldToClip;
+	V2f viewportSize;
+	// When selecting, the projection has been narrowed to the
+	// selection region, and is not representative of the view.
+	bool selecting;
+};
+
+} // namespace
+
 //////////////////////////////////////////////////////////////////////////
 // OpenGLObject
 //////////////////////////////////////////////////////////////////////////
@@ -390,14 +995,26 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 				}
 				else
 				{
+					const IECoreScene::MeshPrimitive *mesh = IECore::runTimeCast<const IECoreScene::MeshPrimitive>( object );
+					const size_t numTriangles = mesh ? MeshProxyAlgo::numTriangles( mesh ) : 0;
 					try
 					{
-						IECore::ConstRunTimeTypedPtr glObject = IECoreGL::CachedConverter::defaultCachedConverter()->convert( object );
-						m_renderable = IECore::runTimeCast<const IECoreGL::Renderable>( glObject.get() );
+						if( MeshProxyAlgo::levelTriangleCounts( numTriangles ).size() > 1 )
+						{
+							// Dense mesh. Draw it via proxies, choosing the
+							// level of detail in `render()`.
+							m_meshProxies = meshProxiesCache().get( MeshProxiesCacheGetterKey( mesh, numTriangles ) );
+							m_proxyLevel = m_meshProxies->levelTriangleCounts().size() - 1;
+						}
+						else
+						{
+							IECore::ConstRunTimeTypedPtr glObject = IECoreGL::CachedConverter::defaultCachedConverter()->convert( object );
+							m_renderable = IECore::runTimeCast<const IECoreGL::Renderable>( glObject.get() );
+						}
 					}
 					catch( ... )
 					{
-						// Leave m_renderable as null
+						// Leave m_renderable and m_meshProxies as null
 					}
 				}
 			}
@@ -408,6 +1025,7 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 			m_editQueue.push( [this, transform]() {
 				m_transform = transform;
 				m_transformSansScale = sansScalingAndShear( transform, false );
+				m_cullingBoundDirty = true;
 			} );
 		}
 
@@ -421,6 +1039,7 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 			ConstOpenGLAttributesPtr openGLAttributes = static_cast<const OpenGLAttributes *>( attributes );
 			m_editQueue.push( [this, openGLAttributes]() {
 				m_attributes = openGLAttributes;
+				m_cullingBoundDirty = true;
 			} );
 			return true;
 		}
@@ -429,13 +1048,27 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 		{
 		}
 
-		Box3f transformedBound() const
+		// Returns the bound of everything that could be drawn by `render()`,
+		// including visualisations which are excluded from `transformedBound()`.
+		// This is cached, because it is used to build the renderer's bounding
+		// volume hierarchy.
+		const Box3f &cullingBound() const
+		{
+			if( m_cullingBoundDirty )
+			{
+				m_cullingBound = transformedBound( /* framingOnly = */ false );
+				m_cullingBoundDirty = false;
+			}
+			return m_cullingBound;
+		}
+
+		Box3f transformedBound( bool framingOnly = true ) const
 		{
 			Box3f b;
 
-			if( m_renderable )
+			if( m_renderable || m_meshProxies )
 			{
-				const Box3f renderableBound = m_renderable->bound();
+				const Box3f renderableBound = m_renderable ? m_renderable->bound() : m_meshProxies->bound();
 				if( !renderableBound.isEmpty() )
 				{
 					b.extendBy( Imath::transform( renderableBound, m_transform ) );
@@ -452,10 +1085,10 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 
 			const Visualisations &attrVis = visualisations( *m_attributes );
 
-			accumulateVisualisationBounds( b, Visualisation::Scale::None, categories, m_transformSansScale, attrVis, m_objectVisualisations );
-			accumulateVisualisationBounds( b, Visualisation::Scale::Local, categories, m_transform, attrVis, m_objectVisualisations );
-			accumulateVisualisationBounds( b, Visualisation::Scale::Visualiser, categories, visualiserTransform( false ), attrVis, m_objectVisualisations );
-			accumulateVisualisationBounds( b, Visualisation::Scale::LocalAndVisualiser, categories, visualiserTransform( true ), attrVis, m_objectVisualisations );
+			accumulateVisualisationBounds( b, framingOnly, Visualisation::Scale::None, categories, m_transformSansScale, attrVis, m_objectVisualisations );
+			accumulateVisualisationBounds( b, framingOnly, Visualisation::Scale::Local, categories, m_transform, attrVis, m_objectVisualisations );
+			accumulateVisualisationBounds( b, framingOnly, Visualisation::Scale::Visualiser, categories, visualiserTransform( false ), attrVis, m_objectVisualisations );
+			accumulateVisualisationBounds( b, framingOnly, Visualisation::Scale::LocalAndVisualiser, categories, visualiserTransform( true ), attrVis, m_objectVisualisations );
 			return b;
 		}
 
@@ -469,12 +1102,13 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 			return selection.match( m_name ) & ( PathMatcher::AncestorMatch | PathMatcher::ExactMatch );
 		}
 
-		void render( IECoreGL::State *currentState, const IECore::PathMatcher &selection ) const
+		void render( IECoreGL::State *currentState, const IECore::PathMatcher &selection, const ScreenProjection &projection ) const
 		{
 			const Visualisations &attrVis = visualisations( *m_attributes );
 			const bool haveVisualisations = attrVis.size() > 0 || m_objectVisualisations.size() > 0;
+			const IECoreGL::Renderable *renderable = this->renderable( projection );
 
-			if( !haveVisualisations && !m_renderable )
+			if( !haveVisualisations && !renderable )
 			{
 				return;
 			}
@@ -518,19 +1152,19 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 					renderMatchingVisualisations( Visualisation::Scale::None, categories, currentState, attrVis, m_objectVisualisations );
 				}
 
-				if( m_renderable || haveMatchingVisualisations( Visualisation::Scale::Local, categories, attrVis, m_objectVisualisations ) )
+				if( renderable || haveMatchingVisualisations( Visualisation::Scale::Local, categories, attrVis, m_objectVisualisations ) )
 				{
 					ScopedTransform l( m_transform );
 
 					renderMatchingVisualisations( Visualisation::Scale::Local, categories, currentState, attrVis, m_objectVisualisations );
-					if( m_renderable ) { m_renderable->render( currentState ); }
+					if( renderable ) { renderable->render( currentState ); }
 				}
 
 			}
-			else if( m_renderable )
+			else if( renderable )
 			{
 				ScopedTransform l( m_transform );
-				m_renderable->render( currentState );
+				renderable->render( currentState );
 			}
 		}
 
@@ -564,15 +1198,42 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 			return t;
 		}
 
+		const IECoreGL::Renderable *renderable( const ScreenProjection &projection ) const
+		{
+			if( !m_meshProxies )
+			{
+				return m_renderable.get();
+			}
+
+			// When selecting, we reuse the level from the last regular
+			// draw, so that picking matches what the user sees.
+			if( !projection.selecting )
+			{
+				m_proxyLevel = MeshProxyAlgo::selectLevel(
+					m_meshProxies->levelTriangleCounts(),
+					MeshProxyAlgo::projectedArea(
+						Imath::transform( m_meshProxies->bound(), m_transform ),
+						projection.worldToClip, projection.viewportSize
+					)
+				);
+			}
+			return m_meshProxies->renderable( m_proxyLevel );
+		}
+
 		IECore::TypeId m_objectType;
 		M44f m_transform;
 		M44f m_transformSansScale;
 		ConstOpenGLAttributesPtr m_attributes;
 		IECoreGL::ConstRenderablePtr m_renderable;
+		ConstMeshProxiesPtr m_meshProxies;
+		mutable size_t m_proxyLevel = 0;
 		Visualisations m_objectVisualisations;
 		vector<InternedString> m_name;
 		EditQueue &m_editQueue;
 
+		mutable Box3f m_cullingBound;
+		mutable bool m_cullingBoundDirty = true;
+
 };
 
 IE_CORE_FORWARDDECLARE( OpenGLObject )
@@ -879,6 +1540,14 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			{
 				return querySelectedObjects( parameters );
 			}
+			else if( name == "gl:queryFrustum" )
+			{
+				return queryFrustum( parameters );
+			}
+			else if( name == "gl:queryRay" )
+			{
+				return queryRay( parameters );
+			}
 
 			throw IECore::Exception( "Unknown command" );
 		}
@@ -957,6 +1626,7 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			// we do this using SceneView::deleteObjectFilter, but here, instead of setting up a filter,
 			// we just delete the camera from the list of things to render.
 			m_objects.erase( std::remove( m_objects.begin(), m_objects.end(), camera), m_objects.end() );
+			m_objectsChanged = true;
 
 			const V2i resolution = camera->getResolution();
 			IECoreGL::FrameBufferPtr frameBuffer = new FrameBuffer;
@@ -992,10 +1662,18 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 
 		void processQueue()
 		{
+			const size_t numObjects = m_objects.size();
 			Edit edit;
 			while( m_editQueue.try_pop( edit ) )
 			{
 				edit();
+				m_boundsChanged = true;
+			}
+			// Edits only ever add objects, so a change in
+			// size tells us if any were added.
+			if( m_objects.size() != numObjects )
+			{
+				m_objectsChanged = true;
 			}
 		}
 
@@ -1021,6 +1699,7 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 				}
 			}
 
+			const size_t numObjects = m_objects.size();
 			m_objects.erase(
 				remove_if(
 					m_objects.begin(),
@@ -1029,6 +1708,10 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 				),
 				m_objects.end()
 			);
+			if( m_objects.size() != numObjects )
+			{
+				m_objectsChanged = true;
+			}
 
 			m_attributes.erase(
 				remove_if(
@@ -1040,18 +1723,91 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			);
 		}
 
+		void updateBoundingVolumeHierarchy()
+		{
+			if( !m_objectsChanged && !m_boundsChanged )
+			{
+				return;
+			}
+
+			vector<Box3f> bounds;
+			bounds.reserve( m_objects.size() );
+			for( const auto &o : m_objects )
+			{
+				bounds.push_back( o->cullingBound() );
+			}
+
+			// Refitting is much cheaper than rebuilding, and is sufficient
+			// when we're just editing transforms and attributes.
+			if( m_objectsChanged || !m_boundingVolumeHierarchy.refit( bounds ) )
+			{
+				m_boundingVolumeHierarchy.build( bounds );
+			}
+
+			m_objectsChanged = m_boundsChanged = false;
+		}
+
+		// Returns a flag per object, indicating if it may intersect the
+		// clip volume defined by `worldToClip`.
+		vector<bool> objectsInFrustum( const M44f &worldToClip, const V2f &margin )
+		{
+			updateBoundingVolumeHierarchy();
+
+			vector<bool> result( m_objects.size(), false );
+			for( size_t i : m_boundingVolumeHierarchy.unbounded() )
+			{
+				result[i] = true;
+			}
+			m_boundingVolumeHierarchy.queryFrustum(
+				worldToClip, margin,
+				[&result]( size_t i ) { result[i] = true; }
+			);
+
+			return result;
+		}
+
 		void renderObjects( IECoreGL::State *currentState )
 		{
 			IECoreGL::Selector *selector = IECoreGL::Selector::currentSelector();
 
-			GLuint i = 1;
-			for( const auto &o : m_objects )
+			// Cull objects outside the current view. When selecting, the
+			// projection has been narrowed to the selection region, so this
+			// also limits the GL picking to the objects that might be hit.
+
+			M44f modelView, projection;
+			glGetFloatv( GL_MODELVIEW_MATRIX, modelView.getValue() );
+			glGetFloatv( GL_PROJECTION_MATRIX, projection.getValue() );
+
+			GLint viewport[4];
+			glGetIntegerv( GL_VIEWPORT, viewport );
+
+			V2f margin( g_selectionCullingMargin );
+			if( !selector )
+			{
+				margin = V2f(
+					2.0f * g_cullingMarginPixels / std::max( viewport[2], 1 ),
+					2.0f * g_cullingMarginPixels / std::max( viewport[3], 1 )
+				);
+			}
+
+			ScreenProjection screenProjection;
+			screenProjection.worldToClip = modelView * projection;
+			screenProjection.viewportSize = V2f( viewport[2], viewport[3] );
+			screenProjection.selecting = selector != nullptr;
+
+			const vector<bool> visible = objectsInFrustum( screenProjection.worldToClip, margin );
+
+			for( size_t i = 0, e = m_objects.size(); i < e; ++i )
 			{
+				if( !visible[i] )
+				{
+					continue;
+				}
 				if( selector )
 				{
-					selector->loadName( i++ );
+					selector->loadName( i + 1 );
 				}
-				o->render( currentState, m_selection );
+				m_objects[i]->render( currentState, m_selection, screenProjection );
 			}
 		}
 
@@ -1127,8 +1883,88 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 				throw InvalidArgumentException( "Expected UIntVectorData \"selection\" parameter" );
 			}
 
+			const vector<IECore::TypeId> maskTypeIds = queryMask( parameters );
+
+			PathMatcher result;
+			for( auto i : names->readable() )
+			{
+				addToQueryResult( m_objects[i-1].get(), maskTypeIds, result );
+			}
+
+			return new PathMatcherData( result );
+		}
+
+		DataPtr queryFrustum( const CompoundDataMap &parameters )
+		{
+			CompoundDataMap::const_iterator it = parameters.find( "worldToClip" );
+			const M44fData *worldToClip = it != parameters.end() ? runTimeCast<const M44fData>( it->second.get() ) : nullptr;
+			if( !worldToClip )
+			{
+				throw InvalidArgumentException( "Expected M44fData \"worldToClip\" parameter" );
+			}
+
+			const vector<IECore::TypeId> maskTypeIds = queryMask( parameters );
+
+			processQueue();
+			removeDeletedObjects();
+
+			const vector<bool> inFrustum = objectsInFrustum(
+				worldToClip->readable(), parameter<V2f>( parameters, "margin", V2f( 0 ) )
+			);
+
+			PathMatcher result;
+			for( size_t i = 0, e = m_objects.size(); i < e; ++i )
+			{
+				if( inFrustum[i] && !m_objects[i]->cullingBound().isEmpty() )
+				{
+					addToQueryResult( m_objects[i].get(), maskTypeIds, result );
+				}
+			}
+
+			return new PathMatcherData( result );
+		}
+
+		DataPtr queryRay( const CompoundDataMap &parameters )
+		{
+			CompoundDataMap::const_iterator it = parameters.find( "origin" );
+			const V3fData *origin = it != parameters.end() ? runTimeCast<const V3fData>( it->second.get() ) : nullptr;
+			it = parameters.find( "direction" );
+			const V3fData *direction = it != parameters.end() ? runTimeCast<const V3fData>( it->second.get() ) : nullptr;
+			if( !origin || !direction )
+			{
+				throw InvalidArgumentException( "Expected V3fData \"origin\" and \"direction\" parameters" );
+			}
+
+			const vector<IECore::TypeId> maskTypeIds = queryMask( parameters );
+
+			processQueue();
+			removeDeletedObjects();
+			updateBoundingVolumeHierarchy();
+
+			PathMatcher result;
+			m_boundingVolumeHierarchy.queryRay(
+				origin->readable(), direction->readable(),
+				[&]( size_t i ) {
+					addToQueryResult( m_objects[i].get(), maskTypeIds, result );
+				}
+			);
+
+			// Infinite bounds are intersected by every ray.
+			for( size_t i : m_boundingVolumeHierarchy.unbounded() )
+			{
+				if( m_objects[i]->cullingBound().isInfinite() )
+				{
+					addToQueryResult( m_objects[i].get(), maskTypeIds, result );
+				}
+			}
+
+			return new PathMatcherData( result );
+		}
+
+		vector<IECore::TypeId> queryMask( const CompoundDataMap &parameters ) const
+		{
 			vector<IECore::TypeId> maskTypeIds;
-			it = parameters.find( "mask" );
+			CompoundDataMap::const_iterator it = parameters.find( "mask" );
 			if( it != parameters.end() )
 			{
 				if( ConstStringVectorDataPtr typeNames = runTimeCast<const StringVectorData>( it->second ) )
@@ -1147,22 +1983,19 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			{
 				maskTypeIds.push_back( IECore::ObjectTypeId );
 			}
+			return maskTypeIds;
+		}
 
-			PathMatcher result;
-			for( auto i : names->readable() )
+		void addToQueryResult( const OpenGLObject *o, const vector<IECore::TypeId> &maskTypeIds, PathMatcher &result ) const
+		{
+			for( auto t : maskTypeIds )
 			{
-				const OpenGLObject *o = m_objects[i-1].get();
-				for( auto t : maskTypeIds )
+				if( t == o->objectType() || RunTimeTyped::inheritsFrom( o->objectType(), t ) )
 				{
-					if( t == o->objectType() || RunTimeTyped::inheritsFrom( o->objectType(), t ) )
-					{
-						result.addPath( o->name() );
-						break;
-					}
+					result.addPath( o->name() );
+					break;
 				}
 			}
-
-			return new PathMatcherData( result );
 		}
 
 		IECoreGL::State *baseState()
@@ -1200,6 +2033,12 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 		typedef std::vector<OpenGLObjectPtr> OpenGLObjectVector;
 		OpenGLObjectVector m_objects;
 
+		// Spatial index over `m_objects`, updated lazily when
+		// objects are added or removed or their bounds change.
+		BoundingVolumeHierarchy m_boundingVolumeHierarchy;
+		bool m_objectsChanged = true;
+		bool m_boundsChanged = true;
+
 		typedef std::vector<OpenGLAttributesPtr> OpenGLAttributesVector;
 		OpenGLAttributesVector m_attributes;
 
@@ -59,6 +59,7 @@
 #include "tbb/parallel_reduce.h"
 
 #include <functional>
+#include <mutex>
 #include <unordered_map>
 
 using namespace std;
@@ -111,7 +112,8 @@ class Instancer::EngineData : public Data
 				m_positions( nullptr ),
 				m_orientations( nullptr ),
 				m_scales( nullptr ),
-				m_uniformScales( nullptr )
+				m_uniformScales( nullptr ),
+				m_maxScale( 0.0f )
 		{
 			m_primitive = runTimeCast<const Primitive>( object );
 			if( !m_primitive )
@@ -247,6 +249,57 @@ class Instancer::EngineData : public Data
 			return result;
 		}
 
+		// Returns a bound which is guaranteed to contain `transform( b, instanceTransform( i ) )`
+		// for every point `i`, where `b` is any box contained in a sphere of `radius` centred
+		// on the origin. This is much cheaper to compute than the exact bound, because it
+		// doesn't require an instance transform to be constructed for every point.
+		Box3f conservativeBound( float radius ) const
+		{
+			std::call_once(
+				m_conservativeBoundInitialised,
+				[this] {
+					if( m_positions )
+					{
+						for( const auto &p : *m_positions )
+						{
+							m_positionsBound.extendBy( p );
+						}
+					}
+					else if( numPoints() )
+					{
+						m_positionsBound.extendBy( V3f( 0 ) );
+					}
+
+					if( m_scales )
+					{
+						for( const auto &s : *m_scales )
+						{
+							m_maxScale = std::max( m_maxScale, std::max( std::abs( s[0] ), std::max( std::abs( s[1] ), std::abs( s[2] ) ) ) );
+						}
+					}
+					else if( m_uniformScales )
+					{
+						for( const auto &s : *m_uniformScales )
+						{
+							m_maxScale = std::max( m_maxScale, std::abs( s ) );
+						}
+					}
+					else
+					{
+						m_maxScale = 1.0f;
+					}
+				}
+			);
+
+			if( m_positionsBound.isEmpty() )
+			{
+				return m_positionsBound;
+			}
+
+			const V3f r( radius * m_maxScale );
+			return Box3f( m_positionsBound.min - r, m_positionsBound.max + r );
+		}
+
 		size_t numInstanceAttributes() const
 		{
 			return m_attributeCreators.size();
@@ -486,6 +539,10 @@ class Instancer::EngineData : public Data
 		boost::container::flat_map<InternedString, AttributeCreator> m_attributeCreators;
 		MurmurHash m_attributesHash;
 
+		mutable std::once_flag m_conservativeBoundInitialised;
+		mutable Box3f m_positionsBound;
+		mutable float m_maxScale;
+
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -515,6 +572,7 @@ Instancer::Instancer( const std::string &name )
 	addChild( new StringPlug( "attributes", Plug::In ) );
 	addChild( new StringPlug( "attributePrefix", Plug::In ) );
 	addChild( new BoolPlug( "encapsulateInstanceGroups", Plug::In ) );
+	addChild( new BoolPlug( "conservativeBounds", Plug::In, false ) );
 	addChild( new ObjectPlug( "__engine", Plug::Out, NullObject::defaultNullObject() ) );
 	addChild( new AtomicCompoundDataPlug( "__prototypeChildNames", Plug::Out, new CompoundData ) );
 	addChild( new ScenePlug( "__capsuleScene", Plug::Out ) );
@@ -660,34 +718,44 @@ const Gaffer::BoolPlug *Instancer::encapsulateInstanceGroupsPlug() const
 	return getChild<BoolPlug>( g_firstPlugIndex + 12 );
 }
 
+Gaffer::BoolPlug *Instancer::conservativeBoundsPlug()
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 13 );
+}
+
+const Gaffer::BoolPlug *Instancer::conservativeBoundsPlug() const
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 13 );
+}
+
 Gaffer::ObjectPlug *Instancer::enginePlug()
 {
-	return getChild<ObjectPlug>( g_firstPlugIndex + 13 );
+	return getChild<ObjectPlug>( g_firstPlugIndex + 14 );
 }
 
 const Gaffer::ObjectPlug *Instancer::enginePlug() const
 {
-	return getChild<ObjectPlug>( g_firstPlugIndex + 13 );
+	return getChild<ObjectPlug>( g_firstPlugIndex + 14 );
 }
 
 Gaffer::AtomicCompoundDataPlug *Instancer::prototypeChildNamesPlug()
 {
-	return getChild<AtomicCompoundDataPlug>( g_firstPlugIndex + 14 );
+	return getChild<AtomicCompoundDataPlug>( g_firstPlugIndex + 15 );
 }
 
 const Gaffer::AtomicCompoundDataPlug *Instancer::prototypeChildNamesPlug() const
 {
-	return getChild<AtomicCompoundDataPlug>( g_firstPlugIndex + 14 );
+	return getChild<AtomicCompoundDataPlug>( g_firstPlugIndex + 15 );
 }
 
 GafferScene::ScenePlug *Instancer::capsuleScenePlug()
 {
-	return getChild<ScenePlug>( g_firstPlugIndex + 15 );
+	return getChild<ScenePlug>( g_firstPlugIndex + 16 );
 }
 
 const GafferScene::ScenePlug *Instancer::capsuleScenePlug() const
 {
-	return getChild<ScenePlug>( g_firstPlugIndex + 15 );
+	return getChild<ScenePlug>( g_firstPlugIndex + 16 );
 }
 
 void Instancer::affects( const Plug *input, AffectedPlugsContainer &outputs ) const
@@ -869,6 +937,7 @@ bool Instancer::affectsBranchBound( const Gaffer::Plug *input ) const
 		input == prototypesPlug()->boundPlug() ||
 		input == prototypesPlug()->transformPlug() ||
 		input == prototypeChildNamesPlug() ||
+		input == conservativeBoundsPlug() ||
 		input == outPlug()->childBoundsPlug()
 	;
 }
@@ -894,6 +963,7 @@ void Instancer::hashBranchBound( const ScenePath &parentPath, const ScenePath &b
 		engineHash( parentPath, context, h );
 		prototypeChildNamesHash( parentPath, context, h );
 		h.append( branchPath.back() );
+		conservativeBoundsPlug()->hash( h );
 
 		{
 			PrototypeScope scope( enginePlug(), context, parentPath, branchPath );
@@ -942,6 +1012,36 @@ Imath::Box3f Instancer::computeBranchBound( const ScenePath &parentPath, const S
 			childBound = prototypesPlug()->boundPlug()->getValue();
 		}
 
+		if( conservativeBoundsPlug()->getValue() )
+		{
+			// Rather than transform the prototype bound by every instance
+			// transform, we bound it with a sphere, which is invariant to
+			// orientation. This lets the engine compute a single bound
+			// for all instances from the point positions and the maximum
+			// scale. It may be larger than necessary, but it is guaranteed
+			// to contain all the instances.
+			if( childNames.empty() )
+			{
+				return Box3f();
+			}
+			childBound = transform( childBound, childTransform );
+			if( childBound.isEmpty() )
+			{
+				return childBound;
+			}
+			float radius = 0.0f;
+			for( int i = 0; i < 8; ++i )
+			{
+				const V3f corner(
+					i & 1 ? childBound.max.x : childBound.min.x,
+					i & 2 ? childBound.max.y : childBound.min.y,
+					i & 4 ? childBound.max.z : childBound.min.z
+				);
+				radius = std::max( radius, corner.length() );
+			}
+			return e->conservativeBound( radius );
+		}
+
 		typedef vector<InternedString>::const_iterator Iterator;
 		typedef blocked_range<Iterator> Range;
 
@@ -46,9 +46,13 @@
 #include "GafferScene/SceneAlgo.h"
 
 #include "Gaffer/ArrayPlug.h"
+#include "Gaffer/ThreadState.h"
 
 #include "IECore/NullObject.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
 #include "unordered_set"
 
 using namespace std;
@@ -67,20 +71,22 @@ GAFFER_NODE_DEFINE_TYPE( MergeScenes );
 namespace
 {
 
-size_t first( const std::bitset<32> &inputs )
+// Below this number of active inputs, per-input queries are
+// made serially, since the overhead of spawning tasks would
+// outweigh the benefits.
+const size_t g_parallelThreshold = 8;
+
+size_t first( const std::vector<int> &inputs )
 {
-	for( size_t i = 0; i < inputs.size(); ++i )
-	{
-		if( inputs[i] )
-		{
-			return i;
-		}
-	}
+	// We shouldn't get an empty mask, because all valid
+	// locations should have at least one active input.
+	assert( inputs.size() );
+	return inputs.front();
+}
 
-	// We shouldn't get here, because all valid locations should
-	// have at least one active input.
-	assert( false );
-	return 0;
+bool soleInputIs( const std::vector<int> &inputs, size_t index )
+{
+	return inputs.size() == 1 && (size_t)inputs.front() == index;
 }
 
 } // namespace
@@ -90,7 +96,7 @@ size_t first( const std::bitset<32> &inputs )
 //////////////////////////////////////////////////////////////////////////
 
 MergeScenes::MergeScenes( const std::string &name )
-	:	SceneProcessor( name, /* minInputs = */ 2, /* maxInputs = */ InputMask().size() )
+	:	SceneProcessor( name, /* minInputs = */ 2 )
 {
 	storeIndexOfNextChild( g_firstPlugIndex );
 
@@ -99,7 +105,7 @@ MergeScenes::MergeScenes( const std::string &name )
 	addChild( new IntPlug( "objectMode", Plug::In, (int)Mode::Keep, (int)Mode::Keep, (int)Mode::Replace ) );
 	addChild( new IntPlug( "globalsMode", Plug::In, (int)Mode::Keep, (int)Mode::Keep, (int)Mode::Merge ) );
 	addChild( new BoolPlug( "adjustBounds", Plug::In, true ) );
-	addChild( new IntPlug( "__activeInputs", Plug::Out, 0 ) );
+	addChild( new IntVectorDataPlug( "__activeInputs", Plug::Out, new IntVectorData ) );
 	addChild( new AtomicBox3fPlug( "__mergedDescendantsBound", Plug::Out ) );
 
 	outPlug()->childBoundsPlug()->setFlags( Plug::AcceptsDependencyCycles, true );
@@ -159,14 +165,14 @@ const Gaffer::BoolPlug *MergeScenes::adjustBoundsPlug() const
 	return getChild<BoolPlug>( g_firstPlugIndex + 4 );
 }
 
-Gaffer::IntPlug *MergeScenes::activeInputsPlug()
+Gaffer::IntVectorDataPlug *MergeScenes::activeInputsPlug()
 {
-	return getChild<IntPlug>( g_firstPlugIndex + 5 );
+	return getChild<IntVectorDataPlug>( g_firstPlugIndex + 5 );
 }
 
-const Gaffer::IntPlug *MergeScenes::activeInputsPlug() const
+const Gaffer::IntVectorDataPlug *MergeScenes::activeInputsPlug() const
 {
-	return getChild<IntPlug>( g_firstPlugIndex + 5 );
+	return getChild<IntVectorDataPlug>( g_firstPlugIndex + 5 );
 }
 
 Gaffer::AtomicBox3fPlug *MergeScenes::mergedDescendantsBoundPlug()
@@ -288,7 +294,7 @@ void MergeScenes::compute( Gaffer::ValuePlug *output, const Gaffer::Context *con
 {
 	if( output == activeInputsPlug() )
 	{
-		static_cast<IntPlug *>( output )->setValue( computeActiveInputs( context ) );
+		static_cast<IntVectorDataPlug *>( output )->setValue( computeActiveInputs( context ) );
 	}
 	else if( output == mergedDescendantsBoundPlug() )
 	{
@@ -300,100 +306,97 @@ void MergeScenes::compute( Gaffer::ValuePlug *output, const Gaffer::Context *con
 	}
 }
 
-void MergeScenes::hashActiveInputs( const Gaffer::Context *context, IECore::MurmurHash &h ) const
+Gaffer::ValuePlug::CachePolicy MergeScenes::hashCachePolicy( const Gaffer::ValuePlug *output ) const
 {
-	const ScenePath &scenePath = context->get<ScenePath>( ScenePlug::scenePathContextName );
-
-	if( scenePath.empty() )
+	if( output == activeInputsPlug() )
 	{
-		h.append( (uint64_t)connectedInputs().to_ulong() );
+		// `hashActiveInputs()` queries inputs in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
 	}
-	else
-	{
-		InputMask parentActiveInputs;
-		{
-			ScenePath parentPath = scenePath; parentPath.pop_back();
-			ScenePlug::PathScope parentScope( context, parentPath );
-			parentActiveInputs = activeInputsPlug()->getValue();
-		}
+	return SceneProcessor::hashCachePolicy( output );
+}
 
-		if( parentActiveInputs.count() == 1 )
-		{
-			h.append( (uint64_t)parentActiveInputs.to_ulong() );
-		}
-		else
-		{
-			InputMask activeInputs;
-			visit(
-				parentActiveInputs,
-				[&scenePath, &activeInputs] ( InputType type, size_t index, const ScenePlug *scene ) {
-					if( scene->exists( scenePath ) )
-					{
-						activeInputs[index] = true;
-					}
-					return true;
-				}
-			);
-			h.append( (uint64_t)activeInputs.to_ulong() );
-		}
+Gaffer::ValuePlug::CachePolicy MergeScenes::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if(
+		output == activeInputsPlug() ||
+		output == outPlug()->childNamesPlug() ||
+		output == outPlug()->setPlug()
+	)
+	{
+		// These query inputs in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
 	}
+	return SceneProcessor::computeCachePolicy( output );
+}
+
+void MergeScenes::hashActiveInputs( const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	// The value depends only on the existence of the location in
+	// each input, and computing that is as cheap as hashing it.
+	computeActiveInputs( context )->hash( h );
 }
 
-int MergeScenes::computeActiveInputs( const Gaffer::Context *context ) const
+IECore::ConstIntVectorDataPtr MergeScenes::computeActiveInputs( const Gaffer::Context *context ) const
 {
 	const ScenePath &scenePath = context->get<ScenePath>( ScenePlug::scenePathContextName );
 
-	InputMask result;
 	if( scenePath.empty() )
 	{
 		// Root
-		result = connectedInputs();
+		return new IntVectorData( connectedInputs() );
 	}
-	else
+
+	// Get active inputs from the parent.
+	ConstIntVectorDataPtr parentActiveInputsData;
 	{
-		// Get active inputs from the parent.
-		InputMask parentActiveInputs;
-		{
-			ScenePath parentPath = scenePath; parentPath.pop_back();
-			ScenePlug::PathScope parentScope( context, parentPath );
-			parentActiveInputs = activeInputsPlug()->getValue();
+		ScenePath parentPath = scenePath; parentPath.pop_back();
+		ScenePlug::PathScope parentScope( context, parentPath );
+		parentActiveInputsData = activeInputsPlug()->getValue();
+	}
+	const InputMask &parentActiveInputs = parentActiveInputsData->readable();
+
+	if( parentActiveInputs.size() == 1 )
+	{
+		// It is forbidden for anyone to evaluate us for a location
+		// that doesn't exist. Therefore, if our parent only has
+		// one active input, then that input must still be active for
+		// us.
+		return parentActiveInputsData;
+	}
+
+	// Figure out which of those parent inputs are
+	// still active. Using the parent active inputs as
+	// a mask reduces the number of existence queries
+	// we must make when merging many sparsely overlapping
+	// scenes.
+	// Note : not using `bool` because concurrent writes to
+	// `std::vector<bool>` aren't safe.
+	const std::vector<char> exists = parallelGet(
+		parentActiveInputs,
+		[&scenePath] ( size_t index, const ScenePlug *scene ) -> char {
+			return scene->exists( scenePath );
 		}
+	);
 
-		if( parentActiveInputs.count() == 1 )
+	IntVectorDataPtr resultData = new IntVectorData;
+	InputMask &result = resultData->writable();
+	for( size_t i = 0; i < parentActiveInputs.size(); ++i )
+	{
+		if( exists[i] )
 		{
-			// It is forbidden for anyone to evaluate us for a location
-			// that doesn't exist. Therefore, if our parent only has
-			// one active input, then that input must still be active for
-			// us.
-			result = parentActiveInputs;
-		}
-		else
-		{
-			// Figure out which of those parent inputs are
-			// still active. Using the parent active inputs as
-			// a mask reduces the number of existence queries
-			// we must make when merging many sparsely overlapping
-			// scenes.
-			visit(
-				parentActiveInputs,
-				[&result, &scenePath] ( InputType type, size_t index, const ScenePlug *scene ) {
-					if( scene->exists( scenePath ) )
-					{
-						result[index] = true;
-					}
-					return true;
-				}
-			);
+			result.push_back( parentActiveInputs[i] );
 		}
 	}
 
-	return result.to_ulong();
+	return resultData;
 }
 
 void MergeScenes::hashMergedDescendantsBound( const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
-	const InputMask activeInputs( activeInputsPlug()->getValue() );
-	if( activeInputs.count() == 1 )
+	ConstIntVectorDataPtr activeInputsData = activeInputsPlug()->getValue();
+	const InputMask &activeInputs = activeInputsData->readable();
+	if( activeInputs.size() == 1 )
 	{
 		return;
 	}
@@ -414,15 +417,16 @@ void MergeScenes::hashMergedDescendantsBound( const Gaffer::Context *context, IE
 	{
 		childPath.back() = childName;
 		childScope.setPath( childPath );
-		const InputMask childActiveInputs( activeInputsPlug()->getValue() );
-		if( childActiveInputs.count() == 1 && childActiveInputs[firstActiveIndex] )
+		ConstIntVectorDataPtr childActiveInputsData = activeInputsPlug()->getValue();
+		const InputMask &childActiveInputs = childActiveInputsData->readable();
+		if( soleInputIs( childActiveInputs, firstActiveIndex ) )
 		{
 			continue;
 		}
 
 		const ScenePlug *childScene = inPlugs()->getChild<ScenePlug>( first( childActiveInputs ) );
 
-		if( childActiveInputs.count() == 1 )
+		if( childActiveInputs.size() == 1 )
 		{
 			childScene->boundPlug()->hash( h );
 		}
@@ -437,8 +441,9 @@ void MergeScenes::hashMergedDescendantsBound( const Gaffer::Context *context, IE
 
 const Imath::Box3f MergeScenes::computeMergedDescendantsBound( const Gaffer::Context *context ) const
 {
-	const InputMask activeInputs( activeInputsPlug()->getValue() );
-	if( activeInputs.count() == 1 )
+	ConstIntVectorDataPtr activeInputsData = activeInputsPlug()->getValue();
+	const InputMask &activeInputs = activeInputsData->readable();
+	if( activeInputs.size() == 1 )
 	{
 		// All children coming from the first input. There can be no descendants to merge.
 		return Box3f();
@@ -462,8 +467,9 @@ const Imath::Box3f MergeScenes::computeMergedDescendantsBound( const Gaffer::Con
 	{
 		childPath.back() = childName;
 		childScope.setPath( childPath );
-		const InputMask childActiveInputs( activeInputsPlug()->getValue() );
-		if( childActiveInputs.count() == 1 && childActiveInputs[firstActiveIndex] )
+		ConstIntVectorDataPtr childActiveInputsData = activeInputsPlug()->getValue();
+		const InputMask &childActiveInputs = childActiveInputsData->readable();
+		if( soleInputIs( childActiveInputs, firstActiveIndex ) )
 		{
 			// Child coming from first input only.
 			// There can be no descendants to merge.
@@ -473,7 +479,7 @@ const Imath::Box3f MergeScenes::computeMergedDescendantsBound( const Gaffer::Con
 		const ScenePlug *childScene = inPlugs()->getChild<ScenePlug>( first( childActiveInputs ) );
 
 		Box3f bound;
-		if( childActiveInputs.count() == 1 )
+		if( childActiveInputs.size() == 1 )
 		{
 			// Child being merged in from another input.
 			bound = childScene->boundPlug()->getValue();
@@ -495,8 +501,9 @@ void MergeScenes::hashBound( const ScenePath &path, const Gaffer::Context *conte
 {
 	// Pass through.
 
-	const InputMask activeInputs( activeInputsPlug()->getValue() );
-	if( activeInputs.count() == 1 || !adjustBoundsPlug()->getValue() )
+	ConstIntVectorDataPtr activeInputsData = activeInputsPlug()->getValue();
+	const InputMask &activeInputs = activeInputsData->readable();
+	if( activeInputs.size() == 1 || !adjustBoundsPlug()->getValue() )
 	{
 		h = inPlugs()->getChild<ScenePlug>( first( activeInputs ) )->boundPlug()->hash();
 		return;
@@ -523,8 +530,9 @@ Imath::Box3f MergeScenes::computeBound( const ScenePath &path, const Gaffer::Con
 {
 	// Pass through for simple cases.
 
-	const InputMask activeInputs( activeInputsPlug()->getValue() );
-	if( activeInputs.count() == 1 || !adjustBoundsPlug()->getValue() )
+	ConstIntVectorDataPtr activeInputsData = activeInputsPlug()->getValue();
+	const InputMask &activeInputs = activeInputsData->readable();
+	if( activeInputs.size() == 1 || !adjustBoundsPlug()->getValue() )
 	{
 		return inPlugs()->getChild<ScenePlug>( first( activeInputs ) )->boundPlug()->getValue();
 	}
@@ -553,7 +561,7 @@ Imath::Box3f MergeScenes::computeBound( const ScenePath &path, const Gaffer::Con
 void MergeScenes::hashTransform( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
 {
 	visit(
-		activeInputsPlug()->getValue(),
+		activeInputsPlug()->getValue()->readable(),
 		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
 			h = scene->transformPlug()->hash();
 			return false;
@@ -566,7 +574,7 @@ Imath::M44f MergeScenes::computeTransform( const ScenePath &path, const Gaffer::
 {
 	M44f result;
 	visit(
-		activeInputsPlug()->getValue(),
+		activeInputsPlug()->getValue()->readable(),
 		[&result] ( InputType type, size_t index, const ScenePlug *scene ) {
 			result = scene->transformPlug()->getValue();
 			return false;
@@ -580,7 +588,7 @@ Imath::M44f MergeScenes::computeTransform( const ScenePath &path, const Gaffer::
 void MergeScenes::hashAttributes( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
 {
 	visit(
-		activeInputsPlug()->getValue(),
+		activeInputsPlug()->getValue()->readable(),
 		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
 			switch( type )
 			{
@@ -606,7 +614,7 @@ IECore::ConstCompoundObjectPtr MergeScenes::computeAttributes( const ScenePath &
 	ConstCompoundObjectPtr result;
 	CompoundObjectPtr merged;
 	visit(
-		activeInputsPlug()->getValue(),
+		activeInputsPlug()->getValue()->readable(),
 		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
 			switch( type )
 			{
@@ -638,7 +646,7 @@ IECore::ConstCompoundObjectPtr MergeScenes::computeAttributes( const ScenePath &
 void MergeScenes::hashObject( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
 {
 	visit(
-		activeInputsPlug()->getValue(),
+		activeInputsPlug()->getValue()->readable(),
 		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
 			switch( type )
 			{
@@ -663,7 +671,7 @@ IECore::ConstObjectPtr MergeScenes::computeObject( const ScenePath &path, const
 {
 	ConstObjectPtr result = IECore::NullObject::defaultNullObject();
 	visit(
-		activeInputsPlug()->getValue(),
+		activeInputsPlug()->getValue()->readable(),
 		[&result] ( InputType type, size_t index, const ScenePlug *scene ) {
 			ConstObjectPtr o = scene->objectPlug()->getValue();
 			if( runTimeCast<const NullObject>( o.get() ) )
@@ -687,7 +695,7 @@ IECore::ConstObjectPtr MergeScenes::computeObject( const ScenePath &path, const
 void MergeScenes::hashChildNames( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
 {
 	visit(
-		activeInputsPlug()->getValue(),
+		activeInputsPlug()->getValue()->readable(),
 		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
 			switch( type )
 			{
@@ -706,42 +714,47 @@ void MergeScenes::hashChildNames( const ScenePath &path, const Gaffer::Context *
 
 IECore::ConstInternedStringVectorDataPtr MergeScenes::computeChildNames( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	ConstInternedStringVectorDataPtr result;
+	ConstIntVectorDataPtr activeInputsData = activeInputsPlug()->getValue();
+	const InputMask &activeInputs = activeInputsData->readable();
+	if( activeInputs.size() == 1 )
+	{
+		return inPlugs()->getChild<ScenePlug>( first( activeInputs ) )->childNamesPlug()->getValue();
+	}
+
+	const std::vector<ConstInternedStringVectorDataPtr> inputChildNames = parallelGet(
+		activeInputs,
+		[] ( size_t index, const ScenePlug *scene ) {
+			return scene->childNamesPlug()->getValue();
+		}
+	);
+
+	ConstInternedStringVectorDataPtr result = inputChildNames.front();
 	InternedStringVectorDataPtr merged;
 	unordered_set<InternedString> visited;
 
-	visit(
-		activeInputsPlug()->getValue(),
-		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
-			{
-				case InputType::Sole :
-				case InputType::First :
-					result = scene->childNamesPlug()->getValue();
-					break;
-				case InputType::Other :
-					ConstInternedStringVectorDataPtr toMerge = scene->childNamesPlug()->getValue();
-					if( toMerge->readable().size() )
-					{
-						if( !merged )
-						{
-							merged = result->copy();
-							result = merged;
-							visited.insert( merged->readable().begin(), merged->readable().end() );
-						}
+	for( auto it = inputChildNames.begin() + 1; it != inputChildNames.end(); ++it )
+	{
+		const auto &toMerge = (*it)->readable();
+		if( toMerge.empty() )
+		{
+			continue;
+		}
 
-						for( const auto & n : toMerge->readable() )
-						{
-							if( visited.insert( n ).second )
-							{
-								merged->writable().push_back( n );
-							}
-						}
-					}
+		if( !merged )
+		{
+			merged = result->copy();
+			result = merged;
+			visited.insert( merged->readable().begin(), merged->readable().end() );
+		}
+
+		for( const auto &n : toMerge )
+		{
+			if( visited.insert( n ).second )
+			{
+				merged->writable().push_back( n );
 			}
-			return true;
 		}
-	);
+	}
 
 	return result;
 }
@@ -890,31 +903,27 @@ void MergeScenes::hashSet( const IECore::InternedString &setName, const Gaffer::
 
 IECore::ConstPathMatcherDataPtr MergeScenes::computeSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	ConstPathMatcherDataPtr result;
-	PathMatcherDataPtr merged;
-	visit(
-		connectedInputs(),
-		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
-			{
-				case InputType::Sole :
-					// Pass input through unchanged.
-					result = scene->setPlug()->getValue();
-					break;
-				case InputType::First :
-					// Initialise merged result and
-					// fall through.
-					merged = new PathMatcherData();
-					result = merged;
-				case InputType::Other :
-					ConstPathMatcherDataPtr paths = scene->setPlug()->getValue();
-					merged->writable().addPaths( paths->readable() );
-			}
-			return true;
+	const InputMask inputs = connectedInputs();
+	if( inputs.size() == 1 )
+	{
+		// Pass input through unchanged.
+		return inPlugs()->getChild<ScenePlug>( first( inputs ) )->setPlug()->getValue();
+	}
+
+	const std::vector<ConstPathMatcherDataPtr> inputSets = parallelGet(
+		inputs,
+		[] ( size_t index, const ScenePlug *scene ) {
+			return scene->setPlug()->getValue();
 		}
 	);
 
-	return result;
+	PathMatcherDataPtr merged = new PathMatcherData();
+	for( const auto &paths : inputSets )
+	{
+		merged->writable().addPaths( paths->readable() );
+	}
+
+	return merged;
 }
 
 MergeScenes::VisitOrder MergeScenes::visitOrder( Mode mode, VisitOrder replaceOrder ) const
@@ -935,29 +944,32 @@ MergeScenes::InputMask MergeScenes::connectedInputs() const
 	InputMask result;
 	for( size_t i = 0, e = inPlugs()->children().size(); i < e; ++i )
 	{
-		result[i] = (bool)inPlugs()->getChild<ScenePlug>( i )->getInput();
+		if( inPlugs()->getChild<ScenePlug>( i )->getInput() )
+		{
+			result.push_back( i );
+		}
 	}
 
-	if( !result.count() )
+	if( result.empty() )
 	{
-		result[0] = true;
+		result.push_back( 0 );
 	}
 
 	return result;
 }
 
 template<typename Visitor>
-void MergeScenes::visit( InputMask inputMask, Visitor &&visitor, VisitOrder order ) const
+void MergeScenes::visit( const InputMask &inputMask, Visitor &&visitor, VisitOrder order ) const
 {
-	assert( inputMask.count() );
+	assert( inputMask.size() );
 
 	const bool backwards = order == VisitOrder::Backwards || order == VisitOrder::LastOnly;
-	const int startIndex = backwards ? inPlugs()->children().size() - 1 : 0;
-	const int endIndex = backwards ? -1 : inPlugs()->children().size();
+	const int startIndex = backwards ? inputMask.size() - 1 : 0;
+	const int endIndex = backwards ? -1 : inputMask.size();
 	const int increment = backwards ? -1 : 1;
 
 	InputType type;
-	if( order == VisitOrder::FirstOnly || order == VisitOrder::LastOnly || inputMask.count() == 1 )
+	if( order == VisitOrder::FirstOnly || order == VisitOrder::LastOnly || inputMask.size() == 1 )
 	{
 		type = InputType::Sole;
 	}
@@ -968,14 +980,42 @@ void MergeScenes::visit( InputMask inputMask, Visitor &&visitor, VisitOrder orde
 
 	for( int i = startIndex; i != endIndex; i += increment )
 	{
-		if( inputMask[i] )
+		const int inputIndex = inputMask[i];
+		const bool c = visitor( type, inputIndex, inPlugs()->getChild<ScenePlug>( inputIndex ) );
+		if( !c || order == VisitOrder::FirstOnly || order == VisitOrder::LastOnly )
 		{
-			const bool c = visitor( type, i, inPlugs()->getChild<ScenePlug>( i ) );
-			if( !c || order == VisitOrder::FirstOnly || order == VisitOrder::LastOnly )
-			{
-				break;
-			}
-			type = InputType::Other;
+			break;
 		}
+		type = InputType::Other;
 	}
 }
+
+template<typename Getter>
+auto MergeScenes::parallelGet( const InputMask &inputMask, Getter &&getter ) const -> std::vector<decltype( getter( 0, nullptr ) )>
+{
+	std::vector<decltype( getter( 0, nullptr ) )> result( inputMask.size() );
+	if( inputMask.size() < g_parallelThreshold )
+	{
+		for( size_t i = 0; i < inputMask.size(); ++i )
+		{
+			result[i] = getter( inputMask[i], inPlugs()->getChild<ScenePlug>( inputMask[i] ) );
+		}
+		return result;
+	}
+
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, inputMask.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			ThreadState::Scope threadStateScope( threadState );
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				result[i] = getter( inputMask[i], inPlugs()->getChild<ScenePlug>( inputMask[i] ) );
+			}
+		},
+		taskGroupContext
+	);
+
+	return result;
+}
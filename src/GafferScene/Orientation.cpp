@@ -53,6 +53,9 @@
 #include "OpenEXR/ImathMatrixAlgo.h"
 #include "OpenEXR/ImathRandom.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
 #include <random>
 
 using namespace std;
@@ -76,6 +79,35 @@ using namespace GafferScene;
 namespace
 {
 
+// Primitive variables with at least this many elements are
+// converted in parallel.
+const size_t g_parallelThreshold = 10000;
+
+template<typename F>
+void forEachElement( size_t size, F &&f )
+{
+	if( size < g_parallelThreshold )
+	{
+		for( size_t i = 0; i < size; ++i )
+		{
+			f( i );
+		}
+		return;
+	}
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, size ),
+		[&f]( const tbb::blocked_range<size_t> &r ) {
+			for( size_t i = r.begin(); i != r.end(); ++i )
+			{
+				f( i );
+			}
+		},
+		taskGroupContext
+	);
+}
+
 struct ViewSpec
 {
 	std::string name;
@@ -155,13 +187,15 @@ PrimitiveVariable inEuler( const Primitive *inputPrimitive, Primitive *outputPri
 
 	QuatfVectorDataPtr quaternionData = new QuatfVectorData;
 	auto &quaternions = quaternionData->writable();
-	quaternions.reserve( view.size() );
+	quaternions.resize( view.size() );
 
-	for( auto &eulerVec : view )
-	{
-		const Eulerf euler( degreesToRadians( eulerVec ), order, Eulerf::XYZLayout );
-		quaternions.push_back( euler.toQuat() );
-	}
+	forEachElement(
+		view.size(),
+		[&]( size_t i ) {
+			const Eulerf euler( degreesToRadians( view[i] ), order, Eulerf::XYZLayout );
+			quaternions[i] = euler.toQuat();
+		}
+	);
 
 	return PrimitiveVariable( spec.interpolation, quaternionData );
 }
@@ -178,19 +212,22 @@ PrimitiveVariable inQuaternion( const Primitive *inputPrimitive, Primitive *outp
 
 	QuatfVectorDataPtr quaternionData = new QuatfVectorData;
 	auto &quaternions = quaternionData->writable();
-	quaternions.reserve( view.size() );
-
-	for( auto &q : view )
-	{
-		if( xyzw )
-		{
-			quaternions.push_back( Quatf( q.v.z, V3f( q.r, q.v.x, q.v.y ) ) );
+	quaternions.resize( view.size() );
+
+	forEachElement(
+		view.size(),
+		[&]( size_t i ) {
+			const Quatf &q = view[i];
+			if( xyzw )
+			{
+				quaternions[i] = Quatf( q.v.z, V3f( q.r, q.v.x, q.v.y ) );
+			}
+			else
+			{
+				quaternions[i] = q;
+			}
 		}
-		else
-		{
-			quaternions.push_back( q );
-		}
-	}
+	);
 
 	return PrimitiveVariable( spec.interpolation, quaternionData );
 }
@@ -208,12 +245,14 @@ PrimitiveVariable inAxisAngle( const Primitive *inputPrimitive, Primitive *outpu
 
 	QuatfVectorDataPtr quaternionData = new QuatfVectorData;
 	auto &quaternions = quaternionData->writable();
-	quaternions.reserve( axisView.size() );
+	quaternions.resize( axisView.size() );
 
-	for( size_t i = 0, s = axisView.size(); i < s; ++i )
-	{
-		quaternions.push_back( Quatf().setAxisAngle( axisView[i], angleView[i] ) );
-	}
+	forEachElement(
+		axisView.size(),
+		[&]( size_t i ) {
+			quaternions[i] = Quatf().setAxisAngle( axisView[i], angleView[i] );
+		}
+	);
 
 	return PrimitiveVariable( spec.interpolation, quaternionData );
 }
@@ -245,49 +284,51 @@ PrimitiveVariable inAim( const Primitive *inputPrimitive, Primitive *outputPrimi
 
 	QuatfVectorDataPtr quaternionData = new QuatfVectorData;
 	auto &quaternions = quaternionData->writable();
-	quaternions.reserve( spec.size );
-
-	for( size_t i = 0; i < spec.size; ++i )
-	{
-		M44f m;
-		if( xAxis && yAxis && zAxis )
-		{
-			m = matrixFromBasis( (*xAxis)[i], (*yAxis)[i], (*zAxis)[i], V3f( 0 ) );
-		}
-		else if( xAxis && yAxis )
-		{
-			const V3f &x = (*xAxis)[i];
-			const V3f &y = (*yAxis)[i];
-			m = matrixFromBasis( x, y, x.cross( y ), V3f( 0 ) );
-		}
-		else if( xAxis && zAxis )
-		{
-			const V3f &x = (*xAxis)[i];
-			const V3f &z = (*zAxis)[i];
-			m = matrixFromBasis( x, z.cross( x ), z, V3f( 0 ) );
-		}
-		else if( yAxis && zAxis )
-		{
-			const V3f &y = (*yAxis)[i];
-			const V3f &z = (*zAxis)[i];
-			m = matrixFromBasis( y.cross( z ), y, z, V3f( 0 ) );
+	quaternions.resize( spec.size );
+
+	forEachElement(
+		spec.size,
+		[&]( size_t i ) {
+			M44f m;
+			if( xAxis && yAxis && zAxis )
+			{
+				m = matrixFromBasis( (*xAxis)[i], (*yAxis)[i], (*zAxis)[i], V3f( 0 ) );
+			}
+			else if( xAxis && yAxis )
+			{
+				const V3f &x = (*xAxis)[i];
+				const V3f &y = (*yAxis)[i];
+				m = matrixFromBasis( x, y, x.cross( y ), V3f( 0 ) );
+			}
+			else if( xAxis && zAxis )
+			{
+				const V3f &x = (*xAxis)[i];
+				const V3f &z = (*zAxis)[i];
+				m = matrixFromBasis( x, z.cross( x ), z, V3f( 0 ) );
+			}
+			else if( yAxis && zAxis )
+			{
+				const V3f &y = (*yAxis)[i];
+				const V3f &z = (*zAxis)[i];
+				m = matrixFromBasis( y.cross( z ), y, z, V3f( 0 ) );
+			}
+			else if( xAxis )
+			{
+				m = rotationMatrixWithUpDir( V3f( 1, 0, 0 ), (*xAxis)[i], V3f( 0, 1, 0 ) );
+			}
+			else if( yAxis )
+			{
+				m = rotationMatrixWithUpDir( V3f( 0, 1, 0 ), (*yAxis)[i], V3f( 0, 1, 0 ) );
+			}
+			else if( zAxis )
+			{
+				m = rotationMatrixWithUpDir( V3f( 0, 0, 1 ), (*zAxis)[i], V3f( 0, 1, 0 ) );
+			}
+
+			removeScalingAndShear( m );
+			quaternions[i] = extractQuat( m );
 		}
-		else if( xAxis )
-		{
-			m = rotationMatrixWithUpDir( V3f( 1, 0, 0 ), (*xAxis)[i], V3f( 0, 1, 0 ) );
-		}
-		else if( yAxis )
-		{
-			m = rotationMatrixWithUpDir( V3f( 0, 1, 0 ), (*yAxis)[i], V3f( 0, 1, 0 ) );
-		}
-		else if( zAxis )
-		{
-			m = rotationMatrixWithUpDir( V3f( 0, 0, 1 ), (*zAxis)[i], V3f( 0, 1, 0 ) );
-		}
-
-		removeScalingAndShear( m );
-		quaternions.push_back( extractQuat( m ) );
-	}
+	);
 
 	return PrimitiveVariable( spec.interpolation, quaternionData );
 }
@@ -299,12 +340,14 @@ PrimitiveVariable inMatrix( const Primitive *inputPrimitive, Primitive *outputPr
 
 	QuatfVectorDataPtr quaternionData = new QuatfVectorData;
 	auto &quaternions = quaternionData->writable();
-	quaternions.reserve( matrixView.size() );
+	quaternions.resize( matrixView.size() );
 
-	for( auto &m : matrixView )
-	{
-		quaternions.push_back( extractQuat( M44f( m, V3f( 0 ) ) ) );
-	}
+	forEachElement(
+		matrixView.size(),
+		[&]( size_t i ) {
+			quaternions[i] = extractQuat( M44f( matrixView[i], V3f( 0 ) ) );
+		}
+	);
 
 	return PrimitiveVariable( spec.interpolation, quaternionData );
 }
@@ -320,13 +363,15 @@ void outEuler( const PrimitiveVariable &orientations, Primitive *outputPrimitive
 
 	V3fVectorDataPtr eulerData = new V3fVectorData();
 	auto &euler = eulerData->writable();
-	euler.reserve( quaternions.size() );
+	euler.resize( quaternions.size() );
 
-	for( auto &q : quaternions )
-	{
-		Eulerf e( q.toMatrix33(), order );
-		euler.push_back( radiansToDegrees( e.toXYZVector() ) );
-	}
+	forEachElement(
+		quaternions.size(),
+		[&]( size_t i ) {
+			Eulerf e( quaternions[i].toMatrix33(), order );
+			euler[i] = radiansToDegrees( e.toXYZVector() );
+		}
+	);
 
 	outputPrimitive->variables[eulerName] = PrimitiveVariable( orientations.interpolation, eulerData );
 }
@@ -350,7 +395,7 @@ void outAxisAngle( const PrimitiveVariable &orientations, Primitive *outputPrimi
 	{
 		axisData = new V3fVectorData();
 		axis = &axisData->writable();
-		axis->reserve( quaternions.size() );
+		axis->resize( quaternions.size() );
 		outputPrimitive->variables[axisName] = PrimitiveVariable( orientations.interpolation, axisData );
 	}
 
@@ -360,7 +405,7 @@ void outAxisAngle( const PrimitiveVariable &orientations, Primitive *outputPrimi
 	{
 		angleData = new FloatVectorData();
 		angle = &angleData->writable();
-		angle->reserve( quaternions.size() );
+		angle->resize( quaternions.size() );
 		outputPrimitive->variables[angleName] = PrimitiveVariable( orientations.interpolation, angleData );
 	}
 
@@ -369,17 +414,19 @@ void outAxisAngle( const PrimitiveVariable &orientations, Primitive *outputPrimi
 		return;
 	}
 
-	for( auto &q : quaternions )
-	{
-		if( axis )
-		{
-			axis->push_back( q.axis() );
+	forEachElement(
+		quaternions.size(),
+		[&]( size_t i ) {
+			if( axis )
+			{
+				(*axis)[i] = quaternions[i].axis();
+			}
+			if( angle )
+			{
+				(*angle)[i] = quaternions[i].angle();
+			}
 		}
-		if( angle )
-		{
-			angle->push_back( q.angle() );
-		}
-	}
+	);
 }
 
 void outAim( const PrimitiveVariable &orientations, Primitive *outputPrimitive, const std::string &xAxisName, const std::string &yAxisName, const std::string &zAxisName )
@@ -392,7 +439,7 @@ void outAim( const PrimitiveVariable &orientations, Primitive *outputPrimitive,
 	{
 		xAxisData = new V3fVectorData;
 		xAxis = &xAxisData->writable();
-		xAxis->reserve( quaternions.size() );
+		xAxis->resize( quaternions.size() );
 		outputPrimitive->variables[xAxisName] = PrimitiveVariable( orientations.interpolation, xAxisData );
 	}
 
@@ -402,7 +449,7 @@ void outAim( const PrimitiveVariable &orientations, Primitive *outputPrimitive,
 	{
 		yAxisData = new V3fVectorData;
 		yAxis = &yAxisData->writable();
-		yAxis->reserve( quaternions.size() );
+		yAxis->resize( quaternions.size() );
 		outputPrimitive->variables[yAxisName] = PrimitiveVariable( orientations.interpolation, yAxisData );
 	}
 
@@ -412,7 +459,7 @@ void outAim( const PrimitiveVariable &orientations, Primitive *outputPrimitive,
 	{
 		zAxisData = new V3fVectorData;
 		zAxis = &zAxisData->writable();
-		zAxis->reserve( quaternions.size() );
+		zAxis->resize( quaternions.size() );
 		outputPrimitive->variables[zAxisName] = PrimitiveVariable( orientations.interpolation, zAxisData );
 	}
 
@@ -421,22 +468,24 @@ void outAim( const PrimitiveVariable &orientations, Primitive *outputPrimitive,
 		return;
 	}
 
-	for( auto &q : quaternions )
-	{
-		const M44f m = q.toMatrix44();
-		if( xAxis )
-		{
-			xAxis->push_back( V3f( m[0][0], m[0][1], m[0][2] ) );
-		}
-		if( yAxis )
-		{
-			yAxis->push_back( V3f( m[1][0], m[1][1], m[1][2] ) );
-		}
-		if( zAxis )
-		{
-			zAxis->push_back( V3f( m[2][0], m[2][1], m[2][2] ) );
+	forEachElement(
+		quaternions.size(),
+		[&]( size_t i ) {
+			const M44f m = quaternions[i].toMatrix44();
+			if( xAxis )
+			{
+				(*xAxis)[i] = V3f( m[0][0], m[0][1], m[0][2] );
+			}
+			if( yAxis )
+			{
+				(*yAxis)[i] = V3f( m[1][0], m[1][1], m[1][2] );
+			}
+			if( zAxis )
+			{
+				(*zAxis)[i] = V3f( m[2][0], m[2][1], m[2][2] );
+			}
 		}
-	}
+	);
 }
 
 void outMatrix( const PrimitiveVariable &orientations, Primitive *outputPrimitive, const std::string &matrixName )
@@ -450,12 +499,14 @@ void outMatrix( const PrimitiveVariable &orientations, Primitive *outputPrimitiv
 
 	M33fVectorDataPtr matricesData = new M33fVectorData();
 	auto &matrices = matricesData->writable();
-	matrices.reserve( matrices.size() );
+	matrices.resize( quaternions.size() );
 
-	for( auto &q : quaternions )
-	{
-		matrices.push_back( q.toMatrix33() );
-	}
+	forEachElement(
+		quaternions.size(),
+		[&]( size_t i ) {
+			matrices[i] = quaternions[i].toMatrix33();
+		}
+	);
 
 	outputPrimitive->variables[matrixName] = PrimitiveVariable( orientations.interpolation, matricesData );
 }
@@ -1068,3 +1119,8 @@ IECore::ConstObjectPtr Orientation::computeProcessedObject( const ScenePath &pat
 
 	return result;
 }
+
+Gaffer::ValuePlug::CachePolicy Orientation::processedObjectComputeCachePolicy() const
+{
+	return ValuePlug::CachePolicy::TaskCollaboration;
+}
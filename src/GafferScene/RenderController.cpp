@@ -288,7 +288,10 @@ class RenderController::SceneGraph
 
 		// Called by SceneGraphUpdateTask to update this location. Returns true if
 		// anything changed.
-		bool update( const ScenePlug::ScenePath &path, unsigned changedGlobals, Type type, RenderController *controller )
+		// If `deferObjects` is true, then new objects at leaf locations are
+		// represented by their bounding box, and ObjectComponent remains dirty
+		// so that they are loaded by the next update.
+		bool update( const ScenePlug::ScenePath &path, unsigned changedGlobals, Type type, RenderController *controller, bool deferObjects = false )
 		{
 			const unsigned originalChangedComponents = m_changedComponents;
 
@@ -352,9 +355,35 @@ class RenderController::SceneGraph
 
 			clean( TransformComponent );
 
+			// Children
+
+			if( ( m_dirtyComponents & ChildNamesComponent ) && updateChildren( controller->m_scene->childNamesPlug() ) )
+			{
+				m_changedComponents |= ChildNamesComponent;
+			}
+
+			clean( ChildNamesComponent );
+
 			// Object
 
-			if( ( m_dirtyComponents & ObjectComponent ) && updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_globals.get(), controller->m_scene.get(), controller->m_lightLinks.get() ) )
+			const bool deferObject =
+				deferObjects && type == ObjectType &&
+				( m_dirtyComponents & ObjectComponent ) &&
+				m_objectHash == MurmurHash() && m_children.empty()
+			;
+
+			if( deferObject )
+			{
+				// Output a bounding box as a placeholder, leaving the object
+				// itself to be loaded by a subsequent update. We only do this
+				// for leaf locations, so that placeholders don't overlap the
+				// boxes drawn for unexpanded children.
+				if( !m_placeholderInterface || ( m_changedComponents & TransformComponent ) || ( m_dirtyComponents & BoundComponent ) )
+				{
+					updatePlaceholder( path, controller );
+				}
+			}
+			else if( ( m_dirtyComponents & ObjectComponent ) && updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_globals.get(), controller->m_scene.get(), controller->m_lightLinks.get() ) )
 			{
 				m_changedComponents |= ObjectComponent;
 			}
@@ -404,20 +433,15 @@ class RenderController::SceneGraph
 				}
 			}
 
-			clean( ObjectComponent );
-
-			// Children
-
-			if( ( m_dirtyComponents & ChildNamesComponent ) && updateChildren( controller->m_scene->childNamesPlug() ) )
+			if( !deferObject )
 			{
-				m_changedComponents |= ChildNamesComponent;
+				clean( ObjectComponent );
+				m_placeholderInterface = nullptr;
 			}
 
-			clean( ChildNamesComponent );
-
 			// Expansion
 
-			if( ( m_dirtyComponents & ExpansionComponent ) && updateExpansion( path, controller->m_expandedPaths, controller->m_minimumExpansionDepth ) )
+			if( ( m_dirtyComponents & ExpansionComponent ) && updateExpansion( path, controller->m_updateExpandedPaths, controller->m_updateMinimumExpansionDepth ) )
 			{
 				m_changedComponents |= ExpansionComponent;
 			}
@@ -469,7 +493,7 @@ class RenderController::SceneGraph
 
 			m_cleared = false;
 
-			assert( m_dirtyComponents == NoComponent );
+			assert( m_dirtyComponents == NoComponent || ( deferObject && m_dirtyComponents == ObjectComponent ) );
 
 			return originalChangedComponents != m_changedComponents;
 		}
@@ -504,6 +528,7 @@ class RenderController::SceneGraph
 			m_cleared = true;
 			m_expanded = false;
 			m_boundInterface = nullptr;
+			m_placeholderInterface = nullptr;
 			m_dirtyComponents = AllComponents;
 		}
 
@@ -725,6 +750,35 @@ class RenderController::SceneGraph
 			return true;
 		}
 
+		// Outputs a bounding box in place of an object which
+		// has not been loaded yet.
+		void updatePlaceholder( const ScenePlug::ScenePath &path, RenderController *controller )
+		{
+			const Box3f bound = controller->m_scene->boundPlug()->getValue();
+			if( bound.isEmpty() )
+			{
+				m_placeholderInterface = nullptr;
+				return;
+			}
+
+			std::string placeholderName;
+			ScenePlug::pathToString( path, placeholderName );
+			placeholderName += "/__placeholderBound__";
+
+			if( controller->m_renderer->name() != g_openGLRendererName )
+			{
+				// See comments in `updateObject()`.
+				m_placeholderInterface = nullptr;
+			}
+
+			IECoreScene::CurvesPrimitivePtr boundCurves = IECoreScene::CurvesPrimitive::createBox( bound );
+			m_placeholderInterface = controller->m_renderer->object( placeholderName, boundCurves.get(), controller->m_boundAttributes.get() );
+			if( m_placeholderInterface )
+			{
+				m_placeholderInterface->transform( m_fullTransform );
+			}
+		}
+
 		void clearObject()
 		{
 			m_objectInterface = nullptr;
@@ -842,6 +896,7 @@ class RenderController::SceneGraph
 		std::vector<std::unique_ptr<SceneGraph>> m_children;
 
 		IECoreScenePreview::Renderer::ObjectInterfacePtr m_boundInterface;
+		IECoreScenePreview::Renderer::ObjectInterfacePtr m_placeholderInterface;
 		bool m_expanded;
 
 		// Tracks work which needs to be done on
@@ -884,7 +939,8 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 			const ThreadState &threadState,
 			const ScenePlug::ScenePath &scenePath,
 			const ProgressCallback &callback,
-			const PathMatcher *pathsToUpdate
+			const PathMatcher *pathsToUpdate,
+			bool deferObjects
 		)
 			:	m_controller( controller ),
 				m_sceneGraph( sceneGraph ),
@@ -893,13 +949,24 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 				m_threadState( threadState ),
 				m_scenePath( scenePath ),
 				m_callback( callback ),
-				m_pathsToUpdate( pathsToUpdate )
+				m_pathsToUpdate( pathsToUpdate ),
+				m_deferObjects( deferObjects )
 		{
 		}
 
 		task *execute() override
 		{
 
+			// If the expansion has been changed since the update started, stop
+			// early so that `updateInternal()` can pick up the changes and
+			// start another pass. Any locations we have already updated remain
+			// clean, so no completed work is thrown away.
+
+			if( m_controller->m_expansionPending )
+			{
+				return nullptr;
+			}
+
 			const unsigned pathsToUpdateMatch = m_pathsToUpdate ? m_pathsToUpdate->match( m_scenePath ) : (unsigned)PathMatcher::EveryMatch;
 			if( !pathsToUpdateMatch )
 			{
@@ -929,7 +996,8 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 				m_scenePath,
 				m_changedGlobalComponents,
 				sceneGraphMatch & IECore::PathMatcher::ExactMatch ? m_sceneGraphType : SceneGraph::NoType,
-				m_controller
+				m_controller,
+				m_deferObjects
 			);
 
 			if( changesMade && m_callback )
@@ -949,7 +1017,7 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 				for( const auto &child : children )
 				{
 					childPath.back() = child->name();
-					SceneGraphUpdateTask *t = new( allocate_child() ) SceneGraphUpdateTask( m_controller, child.get(), m_sceneGraphType, m_changedGlobalComponents, m_threadState, childPath, m_callback, m_pathsToUpdate );
+					SceneGraphUpdateTask *t = new( allocate_child() ) SceneGraphUpdateTask( m_controller, child.get(), m_sceneGraphType, m_changedGlobalComponents, m_threadState, childPath, m_callback, m_pathsToUpdate, m_deferObjects );
 					spawn( *t );
 				}
 
@@ -963,7 +1031,11 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 				}
 			}
 
-			if( pathsToUpdateMatch & ( PathMatcher::AncestorMatch | PathMatcher::ExactMatch ) )
+			if(
+				( pathsToUpdateMatch & ( PathMatcher::AncestorMatch | PathMatcher::ExactMatch ) ) &&
+				// If we stopped early, some children may not have been updated.
+				!m_controller->m_expansionPending
+			)
 			{
 				m_sceneGraph->allChildrenUpdated();
 			}
@@ -1015,6 +1087,7 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 		ScenePlug::ScenePath m_scenePath;
 		const ProgressCallback &m_callback;
 		const PathMatcher *m_pathsToUpdate;
+		bool m_deferObjects;
 
 };
 
@@ -1025,6 +1098,9 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 RenderController::RenderController( const ConstScenePlugPtr &scene, const Gaffer::ConstContextPtr &context, const IECoreScenePreview::RendererPtr &renderer )
 	:	m_renderer( renderer ),
 		m_minimumExpansionDepth( 0 ),
+		m_updateMinimumExpansionDepth( 0 ),
+		m_expansionPending( false ),
+		m_boundsFirst( false ),
 		m_updateRequired( false ),
 		m_updateRequested( false ),
 		m_failedAttributeEdits( 0 ),
@@ -1128,11 +1204,12 @@ const Gaffer::Context *RenderController::getContext() const
 
 void RenderController::setExpandedPaths( const IECore::PathMatcher &expandedPaths )
 {
-	cancelBackgroundTask();
-
-	m_expandedPaths = expandedPaths;
-	dirtySceneGraphs( SceneGraph::ExpansionComponent );
-	requestUpdate();
+	{
+		std::lock_guard<std::mutex> lock( m_expansionMutex );
+		m_expandedPaths = expandedPaths;
+		m_expansionPending = true;
+	}
+	expansionChanged();
 }
 
 const IECore::PathMatcher &RenderController::getExpandedPaths() const
@@ -1147,11 +1224,12 @@ void RenderController::setMinimumExpansionDepth( size_t depth )
 		return;
 	}
 
-	cancelBackgroundTask();
-
-	m_minimumExpansionDepth = depth;
-	dirtySceneGraphs( SceneGraph::ExpansionComponent );
-	requestUpdate();
+	{
+		std::lock_guard<std::mutex> lock( m_expansionMutex );
+		m_minimumExpansionDepth = depth;
+		m_expansionPending = true;
+	}
+	expansionChanged();
 }
 
 size_t RenderController::getMinimumExpansionDepth() const
@@ -1159,6 +1237,16 @@ size_t RenderController::getMinimumExpansionDepth() const
 	return m_minimumExpansionDepth;
 }
 
+void RenderController::setBoundsFirst( bool boundsFirst )
+{
+	m_boundsFirst = boundsFirst;
+}
+
+bool RenderController::getBoundsFirst() const
+{
+	return m_boundsFirst;
+}
+
 RenderController::UpdateRequiredSignal &RenderController::updateRequiredSignal()
 {
 	return m_updateRequiredSignal;
@@ -1234,6 +1322,54 @@ void RenderController::dirtyGlobals( unsigned components )
 	m_dirtyGlobalComponents |= components;
 }
 
+void RenderController::expansionChanged()
+{
+	if( !backgroundTaskRunning() )
+	{
+		// No update is in progress, so we can apply
+		// the change to our scene graphs immediately.
+		// Otherwise the background update will pick
+		// it up without needing to be cancelled.
+		cancelBackgroundTask();
+		applyPendingExpansion();
+	}
+	requestUpdate();
+}
+
+void RenderController::applyPendingExpansion( IECore::PathMatcher *newlyExpandedPaths )
+{
+	{
+		std::lock_guard<std::mutex> lock( m_expansionMutex );
+		if( !m_expansionPending )
+		{
+			return;
+		}
+
+		if( newlyExpandedPaths )
+		{
+			IECore::PathMatcher expanded = m_expandedPaths;
+			expanded.removePaths( m_updateExpandedPaths );
+			newlyExpandedPaths->addPaths( expanded );
+		}
+
+		m_updateExpandedPaths = m_expandedPaths;
+		m_updateMinimumExpansionDepth = m_minimumExpansionDepth;
+		m_expansionPending = false;
+	}
+
+	dirtySceneGraphs( SceneGraph::ExpansionComponent );
+}
+
+bool RenderController::backgroundTaskRunning() const
+{
+	if( !m_backgroundTask )
+	{
+		return false;
+	}
+	const BackgroundTask::Status status = m_backgroundTask->status();
+	return status == BackgroundTask::Pending || status == BackgroundTask::Running;
+}
+
 void RenderController::dirtySceneGraphs( unsigned components )
 {
 	for( auto &sg : m_sceneGraphs )
@@ -1254,7 +1390,11 @@ void RenderController::update( const ProgressCallback &callback )
 	Context::EditableScope scopedContext( m_context.get() );
 	scopedContext.set( "scene:renderer", m_renderer->name().string() );
 
-	updateInternal( callback );
+	applyPendingExpansion();
+	if( updateInternal( callback ) && callback )
+	{
+		callback( BackgroundTask::Completed );
+	}
 }
 
 std::shared_ptr<Gaffer::BackgroundTask> RenderController::updateInBackground( const ProgressCallback &callback, const IECore::PathMatcher &priorityPaths )
@@ -1270,15 +1410,37 @@ std::shared_ptr<Gaffer::BackgroundTask> RenderController::updateInBackground( co
 	Context::EditableScope scopedContext( m_context.get() );
 	scopedContext.set( "scene:renderer", m_renderer->name().string() );
 
+	const bool boundsFirst = m_boundsFirst;
 	m_backgroundTask = ParallelAlgo::callOnBackgroundThread(
 		// Subject
 		m_scene.get(),
-		[this, callback, priorityPaths] {
-			if( !priorityPaths.isEmpty() )
+		[this, callback, priorityPaths, boundsFirst] {
+			IECore::PathMatcher pathsToUpdate = priorityPaths;
+			while( true )
+			{
+				// Pick up any changes made to the expansion since
+				// the last pass, giving priority to newly expanded
+				// locations. Passes are stopped early when the
+				// expansion changes, so we repeat until we get
+				// all the way through.
+				applyPendingExpansion( &pathsToUpdate );
+				const bool completed =
+					( pathsToUpdate.isEmpty() || updateInternal( callback, &pathsToUpdate ) ) &&
+					( !boundsFirst || updateInternal( callback, nullptr, /* deferObjects = */ true ) ) &&
+					updateInternal( callback )
+				;
+				// The expansion may also have changed after the final
+				// pass last checked it. The UI thread won't apply the
+				// change while we're running, so we must go round again.
+				if( completed && !m_expansionPending )
+				{
+					break;
+				}
+			}
+			if( callback )
 			{
-				updateInternal( callback, &priorityPaths );
+				callback( BackgroundTask::Completed );
 			}
-			updateInternal( callback );
 		}
 	);
 
@@ -1295,10 +1457,14 @@ void RenderController::updateMatchingPaths( const IECore::PathMatcher &pathsToUp
 	Context::EditableScope scopedContext( m_context.get() );
 	scopedContext.set( "scene:renderer", m_renderer->name().string() );
 
-	updateInternal( callback, &pathsToUpdate );
+	applyPendingExpansion();
+	if( updateInternal( callback, &pathsToUpdate ) && callback )
+	{
+		callback( BackgroundTask::Completed );
+	}
 }
 
-void RenderController::updateInternal( const ProgressCallback &callback, const IECore::PathMatcher *pathsToUpdate )
+bool RenderController::updateInternal( const ProgressCallback &callback, const IECore::PathMatcher *pathsToUpdate, bool deferObjects )
 {
 	try
 	{
@@ -1351,10 +1517,16 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 
 			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
 			SceneGraphUpdateTask *task = new( tbb::task::allocate_root( taskGroupContext ) ) SceneGraphUpdateTask(
-				this, sceneGraph, (SceneGraph::Type)i, m_changedGlobalComponents, ThreadState::current(), ScenePlug::ScenePath(), callback, pathsToUpdate
+				this, sceneGraph, (SceneGraph::Type)i, m_changedGlobalComponents, ThreadState::current(), ScenePlug::ScenePath(), callback, pathsToUpdate, deferObjects
 			);
 			tbb::task::spawn_root_and_wait( *task );
 
+			if( m_expansionPending )
+			{
+				// Stopped early by `SceneGraphUpdateTask`.
+				return false;
+			}
+
 			if( i == SceneGraph::LightFilterType && m_lightLinks && m_lightLinks->lightFilterLinksDirty() )
 			{
 				m_lightLinks->outputLightFilterLinks( m_scene.get() );
@@ -1366,12 +1538,17 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 			updateDefaultCamera();
 		}
 
-		if( !pathsToUpdate )
+		if( !pathsToUpdate && !deferObjects )
 		{
 			// Only clear `m_changedGlobalComponents` when we
 			// know our entire scene has been updated successfully.
 			m_changedGlobalComponents = NoGlobalComponent;
-			m_updateRequired = false;
+			{
+				// The expansion may have been changed too late
+				// for us to merge it into this update.
+				std::lock_guard<std::mutex> lock( m_expansionMutex );
+				m_updateRequired = m_expansionPending.load();
+			}
 			if( m_failedAttributeEdits )
 			{
 				IECore::msg(
@@ -1388,10 +1565,7 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 			}
 		}
 
-		if( callback )
-		{
-			callback( BackgroundTask::Completed );
-		}
+		return true;
 	}
 	catch( const IECore::Cancelled &e )
 	{
@@ -51,6 +51,7 @@
 #include "Gaffer/Monitor.h"
 #include "Gaffer/Process.h"
 #include "Gaffer/ScriptNode.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
 
 #include "IECoreScene/Camera.h"
 #include "IECoreScene/ClippingPlane.h"
@@ -592,27 +593,23 @@ InternedString SceneAlgo::historyIDContextName()
 	return s;
 }
 
-SceneAlgo::History::Ptr SceneAlgo::history( const Gaffer::ValuePlug *scenePlugChild, const ScenePlug::ScenePath &path )
+namespace
 {
-	if( !scenePlugChild->parent<ScenePlug>() )
-	{
-		throw IECore::Exception( boost::str(
-			boost::format( "Plug \"%1%\" is not a child of a ScenePlug." ) % scenePlugChild->fullName()
-		) );
-	}
 
+SceneAlgo::History::Ptr historyGetter( const Gaffer::ValuePlug *scenePlugChild, const ScenePlug::ScenePath &path )
+{
 	CapturingMonitorPtr monitor = new CapturingMonitor;
 	{
 		ScenePlug::PathScope pathScope( Context::current(), path );
 		// Trick to bypass the hash cache and get a full upstream evaluation.
-		pathScope.set( historyIDContextName(), g_historyID++ );
+		pathScope.set( SceneAlgo::historyIDContextName(), g_historyID++ );
 		Monitor::Scope monitorScope( monitor );
 		scenePlugChild->hash();
 	}
 
 	if( monitor->rootProcesses().size() == 0 )
 	{
-		return new History(
+		return new SceneAlgo::History(
 			const_cast<ScenePlug *>( scenePlugChild->parent<ScenePlug>() ),
 			new Context( *Context::current(), /* omitCanceller = */ true )
 		);
@@ -622,6 +619,94 @@ SceneAlgo::History::Ptr SceneAlgo::history( const Gaffer::ValuePlug *scenePlugCh
 	return historyWalk( monitor->rootProcesses().front().get(), scenePlugChild->getName(), nullptr );
 }
 
+// Capturing history requires a full upstream evaluation, which is expensive
+// for large graphs. But the editors that use history tend to query the same
+// locations over and over, so we index the results by plug, context and
+// dirty count. The dirty count is incremented whenever an upstream edit
+// dirties the plug, which invalidates the index entry for us.
+struct HistoryCacheGetterKey
+{
+
+	HistoryCacheGetterKey( const Gaffer::ValuePlug *scenePlugChild, const ScenePlug::ScenePath &path )
+		:	scenePlugChild( scenePlugChild ), path( path )
+	{
+		ScenePlug::PathScope pathScope( Context::current(), path );
+		hash = Context::current()->hash();
+		hash.append( (uint64_t)scenePlugChild );
+		hash.append( scenePlugChild->dirtyCount() );
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return hash;
+	}
+
+	const Gaffer::ValuePlug *scenePlugChild;
+	const ScenePlug::ScenePath &path;
+	IECore::MurmurHash hash;
+
+};
+
+using HistoryCache = IECorePreview::LRUCache<IECore::MurmurHash, SceneAlgo::History::ConstPtr, IECorePreview::LRUCachePolicy::Parallel, HistoryCacheGetterKey>;
+
+HistoryCache &historyCache()
+{
+	// Deliberately leaked, because the cached histories hold plugs, and those
+	// may have Python wrappers which can't be destroyed after Python has shut
+	// down during static destruction.
+	static HistoryCache *g_cache = new HistoryCache(
+		[] ( const HistoryCacheGetterKey &key, size_t &cost ) {
+			cost = 1;
+			return historyGetter( key.scenePlugChild, key.path );
+		},
+		1000,
+		HistoryCache::RemovalCallback(),
+		// Errors may be caused by things outside the node graph,
+		// such as missing files, so we don't want to cache them.
+		/* cacheErrors = */ false
+	);
+	return *g_cache;
+}
+
+// Returns a history which is shared with the cache, and must therefore
+// not be modified.
+SceneAlgo::History::ConstPtr cachedHistory( const Gaffer::ValuePlug *scenePlugChild, const ScenePlug::ScenePath &path )
+{
+	if( !scenePlugChild->parent<ScenePlug>() )
+	{
+		throw IECore::Exception( boost::str(
+			boost::format( "Plug \"%1%\" is not a child of a ScenePlug." ) % scenePlugChild->fullName()
+		) );
+	}
+
+	return historyCache().get( HistoryCacheGetterKey( scenePlugChild, path ) );
+}
+
+SceneAlgo::History::Ptr copyHistory( const SceneAlgo::History *history )
+{
+	SceneAlgo::History::Ptr result = new SceneAlgo::History( history->scene, new Context( *history->context ) );
+	result->predecessors.reserve( history->predecessors.size() );
+	for( const auto &p : history->predecessors )
+	{
+		result->predecessors.push_back( copyHistory( p.get() ) );
+	}
+	return result;
+}
+
+} // namespace
+
+SceneAlgo::History::Ptr SceneAlgo::history( const Gaffer::ValuePlug *scenePlugChild, const ScenePlug::ScenePath &path )
+{
+	// The caller is free to modify the result, so we must return
+	// a copy rather than the cached original.
+	return copyHistory( cachedHistory( scenePlugChild, path ).get() );
+}
+
+void SceneAlgo::clearHistoryCache()
+{
+	historyCache().clear();
+}
+
 SceneAlgo::AttributeHistory::Ptr SceneAlgo::attributeHistory( const SceneAlgo::History *attributesHistory, const IECore::InternedString &attribute )
 {
 	Context::Scope scopedContext( attributesHistory->context.get() );
@@ -679,7 +764,7 @@ SceneAlgo::AttributeHistory::Ptr SceneAlgo::attributeHistory( const SceneAlgo::H
 
 ScenePlug *SceneAlgo::source( const ScenePlug *scene, const ScenePlug::ScenePath &path )
 {
-	History::ConstPtr h = history( scene->objectPlug(), path );
+	History::ConstPtr h = cachedHistory( scene->objectPlug(), path );
 	if( h )
 	{
 		const History *c = h.get();
@@ -700,7 +785,7 @@ ScenePlug *SceneAlgo::source( const ScenePlug *scene, const ScenePlug::ScenePath
 
 SceneProcessor *SceneAlgo::objectTweaks( const ScenePlug *scene, const ScenePlug::ScenePath &path )
 {
-	History::ConstPtr h = history( scene->objectPlug(), path );
+	History::ConstPtr h = cachedHistory( scene->objectPlug(), path );
 	if( h )
 	{
 		return objectTweaksWalk( h.get() );
@@ -713,7 +798,7 @@ ShaderTweaks *SceneAlgo::shaderTweaks( const ScenePlug *scene, const ScenePlug::
 	ScenePlug::ScenePath inheritancePath = path;
 	while( inheritancePath.size() )
 	{
-		History::ConstPtr h = history( scene->attributesPlug(), inheritancePath );
+		History::ConstPtr h = cachedHistory( scene->attributesPlug(), inheritancePath );
 		if( auto ah = attributeHistory( h.get(), attributeName ) )
 		{
 			return shaderTweaksWalk( ah.get() );
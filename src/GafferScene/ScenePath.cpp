@@ -167,6 +167,11 @@ PathPtr ScenePath::copy() const
 	return new ScenePath( m_scene, m_context, names(), root(), const_cast<PathFilter *>( getFilter() ) );
 }
 
+const Gaffer::Plug *ScenePath::cancellationSubject() const
+{
+	return m_scene.get();
+}
+
 void ScenePath::doChildren( std::vector<PathPtr> &children ) const
 {
 	Context::Scope scopedContext( m_context.get() );
@@ -40,6 +40,10 @@
 
 #include "GafferScene/SetAlgo.h"
 
+#include "GafferScene/SceneAlgo.h"
+
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
 #include "IECore/MessageHandler.h"
 
 #include "boost/algorithm/string/predicate.hpp"
@@ -51,6 +55,12 @@
 #include "boost/variant/apply_visitor.hpp"
 #include "boost/variant/recursive_variant.hpp"
 
+#include "tbb/task_arena.h"
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
 using namespace IECore;
 using namespace Gaffer;
 using namespace GafferScene;
@@ -189,14 +199,126 @@ std::ostream& operator<<( std::ostream& stream, const ExpressionAst& expr )
 }
 #endif
 
+// Collecting set names
+// ---------------------
+// Finds the names of all the sets referenced by the AST, expanding
+// wildcards, so that they can be fetched in parallel before evaluation.
+struct AstSetNameCollector
+{
+	typedef void result_type;
+
+	AstSetNameCollector( const ScenePlug *scene, std::vector<InternedString> &setNames )
+		:	m_scene( scene ), m_setNames( setNames )
+	{
+	}
+
+	void operator()( const std::string &identifier )
+	{
+		if( identifier[0] == '/' )
+		{
+			// Object name
+			return;
+		}
+
+		if( !StringAlgo::hasWildcards( identifier ) )
+		{
+			add( identifier );
+			return;
+		}
+
+		if( !m_allSetNames )
+		{
+			m_allSetNames = m_scene->setNamesPlug()->getValue();
+		}
+
+		for( const IECore::InternedString &setName : m_allSetNames->readable() )
+		{
+			if( StringAlgo::match( setName.string(), identifier ) )
+			{
+				add( setName );
+			}
+		}
+	}
+
+	void operator()( const ExpressionAst &ast )
+	{
+		boost::apply_visitor( *this, ast.expr );
+	}
+
+	void operator()( const BinaryOp &expr )
+	{
+		boost::apply_visitor( *this, expr.left.expr );
+		boost::apply_visitor( *this, expr.right.expr );
+	}
+
+	void operator()( const Nil &nil )
+	{
+	}
+
+	private :
+
+		void add( const InternedString &setName )
+		{
+			if( m_visited.insert( setName ).second )
+			{
+				m_setNames.push_back( setName );
+			}
+		}
+
+		const ScenePlug *m_scene;
+		std::vector<InternedString> &m_setNames;
+		std::unordered_set<InternedString> m_visited;
+		IECore::ConstInternedStringVectorDataPtr m_allSetNames;
+
+};
+
+// Estimating evaluation cost
+// --------------------------
+// Returns the number of operands in the AST. This is a crude proxy for
+// the cost of evaluating it, used to decide which side of an intersection
+// to evaluate first.
+struct AstOperandCounter
+{
+	typedef size_t result_type;
+
+	size_t operator()( const std::string &identifier ) const
+	{
+		return StringAlgo::hasWildcards( identifier ) ? 2 : 1;
+	}
+
+	size_t operator()( const ExpressionAst &ast ) const
+	{
+		return boost::apply_visitor( *this, ast.expr );
+	}
+
+	size_t operator()( const BinaryOp &expr ) const
+	{
+		return boost::apply_visitor( *this, expr.left.expr ) + boost::apply_visitor( *this, expr.right.expr );
+	}
+
+	size_t operator()( const Nil &nil ) const
+	{
+		return 0;
+	}
+};
+
 // Evaluating the AST
 // ------------------
+// All sets are fetched up front by `evaluateSetExpression()`, and passed to
+// the evaluator in `sets`. The evaluator takes an optional `restriction`,
+// and returns only the results which are also in the restriction. This
+// allows intersections and differences to be evaluated lazily : rather than
+// fully evaluate both operands, we evaluate the cheaper operand first, and
+// then use it to restrict the evaluation of the other. This avoids building
+// large unions only to intersect them with a much smaller set.
+typedef std::unordered_map<InternedString, ConstPathMatcherDataPtr> SetMap;
+
 struct AstEvaluator
 {
 	typedef PathMatcher result_type;
 
-	AstEvaluator( const ScenePlug *scene )
-		: m_scene( scene )
+	AstEvaluator( const SetMap &sets, const PathMatcher *restriction = nullptr )
+		: m_sets( sets ), m_restriction( restriction )
 	{
 	}
 
@@ -210,7 +332,12 @@ struct AstEvaluator
 			{
 				throw IECore::Exception( boost::str( boost::format( "Object name \"%1%\" contains wildcards" ) % identifier ) );
 			}
-			result.addPath( identifier );
+			std::vector<InternedString> path;
+			ScenePlug::stringToPath( identifier, path );
+			if( !m_restriction || ( m_restriction->match( path ) & PathMatcher::ExactMatch ) )
+			{
+				result.addPath( path );
+			}
 			return result;
 		}
 		else
@@ -219,29 +346,16 @@ struct AstEvaluator
 
 			if( !StringAlgo::hasWildcards( identifier ) )
 			{
-				return m_scene->set( identifier )->readable();
+				return applyRestriction( set( identifier ) );
 			}
 
 			result_type result;
-
-			IECore::ConstInternedStringVectorDataPtr setNamesData = m_scene->setNamesPlug()->getValue();
-			const std::vector<IECore::InternedString> &setNames = setNamesData->readable();
-			if( setNames.empty() )
-			{
-				return result;
-			}
-
-			ScenePlug::SetScope setScope( Context::current() );
-			for( const IECore::InternedString &setName : setNames )
+			for( const auto &namedSet : m_sets )
 			{
-				if( !StringAlgo::match( setName.string(), identifier ) )
+				if( StringAlgo::match( namedSet.first.string(), identifier ) )
 				{
-					continue;
+					result.addPaths( applyRestriction( namedSet.second->readable() ) );
 				}
-
-				setScope.setSetName( setName );
-				ConstPathMatcherDataPtr setData = m_scene->setPlug()->getValue();
-				result.addPaths( setData->readable() );
 			}
 			return result;
 		}
@@ -260,29 +374,49 @@ struct AstEvaluator
 
 	result_type operator()( const BinaryOp &expr ) const
 	{
-		PathMatcher left = boost::apply_visitor( *this, expr.left.expr );
-		PathMatcher right = boost::apply_visitor( *this, expr.right.expr );
-
 		switch( expr.op )
 		{
 			case Or :
 			{
-				PathMatcher result = PathMatcher( left );
-				result.addPaths( right );
+				PathMatcher result = boost::apply_visitor( *this, expr.left.expr );
+				result.addPaths( boost::apply_visitor( *this, expr.right.expr ) );
 				return result;
 			}
 			case And :
 			{
-				return left.intersection( right );
+				const AstOperandCounter counter;
+				const bool leftFirst = boost::apply_visitor( counter, expr.left.expr ) <= boost::apply_visitor( counter, expr.right.expr );
+				const PathMatcher first = boost::apply_visitor( *this, leftFirst ? expr.left.expr : expr.right.expr );
+				if( first.isEmpty() )
+				{
+					return first;
+				}
+				// `first` is already restricted by `m_restriction`, so evaluating
+				// the second operand restricted by `first` gives us the intersection.
+				const AstEvaluator secondEvaluator( m_sets, &first );
+				return boost::apply_visitor( secondEvaluator, leftFirst ? expr.right.expr : expr.left.expr );
 			}
 			case AndNot :
 			{
-				PathMatcher result = PathMatcher( left );
-				result.removePaths( right );
+				PathMatcher result = boost::apply_visitor( *this, expr.left.expr );
+				if( result.isEmpty() )
+				{
+					return result;
+				}
+				// We only need the part of the right operand that could
+				// actually be removed from the result.
+				const AstEvaluator rightEvaluator( m_sets, &result );
+				result.removePaths( boost::apply_visitor( rightEvaluator, expr.right.expr ) );
 				return result;
 			}
 			case In :
 			{
+				const PathMatcher left = boost::apply_visitor( *this, expr.left.expr );
+				if( left.isEmpty() )
+				{
+					return left;
+				}
+				const PathMatcher right = boost::apply_visitor( AstEvaluator( m_sets ), expr.right.expr );
 				PathMatcher result;
 				for( PathMatcher::Iterator it = right.begin(), eIt = right.end(); it != eIt; ++it )
 				{
@@ -293,6 +427,12 @@ struct AstEvaluator
 			}
 			case Containing :
 			{
+				const PathMatcher left = boost::apply_visitor( *this, expr.left.expr );
+				if( left.isEmpty() )
+				{
+					return left;
+				}
+				const PathMatcher right = boost::apply_visitor( AstEvaluator( m_sets ), expr.right.expr );
 				PathMatcher result;
 				for( PathMatcher::Iterator it = left.begin(), eIt = left.end(); it != eIt; ++it )
 				{
@@ -308,7 +448,22 @@ struct AstEvaluator
 		}
 	}
 
-	const ScenePlug *m_scene;
+	private :
+
+		const PathMatcher &set( const InternedString &name ) const
+		{
+			// All referenced sets are fetched before evaluation,
+			// so we can't fail to find one here.
+			return m_sets.find( name )->second->readable();
+		}
+
+		PathMatcher applyRestriction( const PathMatcher &paths ) const
+		{
+			return m_restriction ? paths.intersection( *m_restriction ) : paths;
+		}
+
+		const SetMap &m_sets;
+		const PathMatcher *m_restriction;
 
 };
 
@@ -465,7 +620,7 @@ struct ExpressionGrammar : qi::grammar<Iterator, ExpressionAst(), ascii::space_t
 	qi::rule<Iterator, ExpressionAst(), ascii::space_type> expression, inExpression, containingExpression, andNotExpression, andExpression, orExpression, element;
 };
 
-void expressionToAST( const std::string &setExpression, ExpressionAst &ast)
+void expressionToAST( const std::string &setExpression, ExpressionAst &ast )
 {
 	if( setExpression == "" )
 	{
@@ -511,6 +666,28 @@ void expressionToAST( const std::string &setExpression, ExpressionAst &ast)
 	}
 }
 
+// Parsing is relatively expensive compared to hashing, and the same
+// expressions are evaluated and hashed repeatedly, so we cache the
+// parsed ASTs.
+
+typedef std::shared_ptr<const ExpressionAst> ConstExpressionAstPtr;
+
+ConstExpressionAstPtr astGetter( const std::string &setExpression, size_t &cost )
+{
+	std::shared_ptr<ExpressionAst> result = std::make_shared<ExpressionAst>();
+	expressionToAST( setExpression, *result );
+	cost = 1;
+	return result;
+}
+
+typedef IECorePreview::LRUCache<std::string, ConstExpressionAstPtr> AstCache;
+AstCache g_astCache( astGetter, 10000 );
+
+ConstExpressionAstPtr expressionToAST( const std::string &setExpression )
+{
+	return g_astCache.get( setExpression );
+}
+
 } // namespace
 
 namespace GafferScene
@@ -521,20 +698,41 @@ namespace SetAlgo
 
 PathMatcher evaluateSetExpression( const std::string &setExpression, const ScenePlug *scene )
 {
-	ExpressionAst ast;
-	expressionToAST( setExpression, ast );
+	ConstExpressionAstPtr ast = expressionToAST( setExpression );
+
+	std::vector<InternedString> setNames;
+	AstSetNameCollector collector( scene, setNames );
+	collector( *ast );
+
+	SetMap sets;
+	if( setNames.size() )
+	{
+		// Fetch all sets in parallel. We isolate the work because we may be
+		// called while our caller holds a lock, and must not steal outer
+		// tasks that might try to acquire the same lock.
+		IECore::ConstCompoundDataPtr setsData;
+		tbb::this_task_arena::isolate(
+			[&setsData, scene, &setNames] {
+				setsData = SceneAlgo::sets( scene, setNames );
+			}
+		);
+
+		for( const auto &namedSet : setsData->readable() )
+		{
+			sets[namedSet.first] = static_cast<const PathMatcherData *>( namedSet.second.get() );
+		}
+	}
 
-	AstEvaluator eval( scene );
-	return eval( ast );
+	AstEvaluator eval( sets );
+	return eval( *ast );
 }
 
 void setExpressionHash( const std::string &setExpression, const ScenePlug* scene, IECore::MurmurHash &h )
 {
-	ExpressionAst ast;
-	expressionToAST( setExpression, ast );
+	ConstExpressionAstPtr ast = expressionToAST( setExpression );
 
 	AstHasher hasher = AstHasher( scene, h );
-	hasher(ast);
+	hasher( *ast );
 }
 
 IECore::MurmurHash setExpressionHash( const std::string &setExpression, const ScenePlug* scene)
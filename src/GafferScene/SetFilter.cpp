@@ -127,6 +127,16 @@ void SetFilter::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 	}
 }
 
+Gaffer::ValuePlug::CachePolicy SetFilter::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == expressionResultPlug() )
+	{
+		// `evaluateSetExpression()` fetches sets in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return Filter::computeCachePolicy( output );
+}
+
 void SetFilter::hashMatch( const ScenePlug *scene, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	if( !scene )
@@ -38,6 +38,8 @@
 #include "GafferScene/UDIMQuery.h"
 #include "GafferScene/SceneAlgo.h"
 
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
 #include "IECoreScene/MeshPrimitive.h"
 #include "IECoreScene/Output.h"
 #include "IECore/StringAlgo.h"
@@ -183,7 +185,126 @@ void UDIMQuery::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *co
 	}
 }
 
-namespace {
+namespace
+{
+
+// Caches the UDIMs covered by each mesh, keyed by the hash of the mesh and
+// the UV set. This means that following an edit, we only need to re-extract
+// the UDIMs for the meshes which have actually changed.
+struct UDIMsCacheGetterKey
+{
+
+	UDIMsCacheGetterKey( const ScenePlug *scene, const ScenePlug::ScenePath &path, const std::string &uvSet )
+		:	scene( scene ), path( path ), uvSet( uvSet ), objectHash( scene->objectPlug()->hash() )
+	{
+		hash = objectHash;
+		hash.append( uvSet );
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return hash;
+	}
+
+	const ScenePlug *scene;
+	const ScenePlug::ScenePath &path;
+	const std::string &uvSet;
+	IECore::MurmurHash objectHash;
+	IECore::MurmurHash hash;
+
+};
+
+// Returns the sorted UDIMs covered by the mesh at the current location, or
+// null if there is no mesh, or the mesh has no suitable UVs.
+ConstIntVectorDataPtr udimsGetter( const UDIMsCacheGetterKey &key, size_t &cost )
+{
+	cost = 1;
+
+	IECore::ConstObjectPtr object = key.scene->objectPlug()->getValue( &key.objectHash );
+	const IECoreScene::MeshPrimitive *meshPrimitive = runTimeCast<const IECoreScene::MeshPrimitive>( object.get() );
+	if( !meshPrimitive )
+	{
+		return nullptr;
+	}
+
+	// First check if there are face-varying UVs
+	bool faceVarying = true;
+	auto uvs = meshPrimitive->variableIndexedView<IECore::V2fVectorData>( key.uvSet,  IECoreScene::PrimitiveVariable::FaceVarying );
+	if( !uvs )
+	{
+		// Next check for vertex UVs
+		faceVarying = false;
+		uvs = meshPrimitive->variableIndexedView<IECore::V2fVectorData>( key.uvSet,  IECoreScene::PrimitiveVariable::Vertex );
+	}
+
+	if( !uvs )
+	{
+		// No face-varying or vertex UVs
+		return nullptr;
+	}
+
+	unsigned int targetSize = meshPrimitive->variableSize( faceVarying ? IECoreScene::PrimitiveVariable::FaceVarying : IECoreScene::PrimitiveVariable::Vertex );
+	if( uvs->size() != targetSize )
+	{
+		std::string pathString;
+		ScenePlug::pathToString( key.path, pathString );
+		throw IECore::Exception(
+			boost::str(
+				boost::format(
+					"Cannot query UDIMs.  Bad uvs at location %s.  Required count %i but found %i."
+				) % pathString % targetSize % uvs->size()
+			)
+		);
+	}
+
+	const IntVectorData *vertsPerFaceData = meshPrimitive->verticesPerFace();
+	const std::vector<int> &vertsPerFace = vertsPerFaceData->readable();
+
+	boost::container::flat_set<int> udims;
+
+	// We check the center UVs of each face, because the edge uvs could lie directly on a UDIM boundary,
+	// and without checking adjacency information, it would be impossible to tell which UDIM the edge
+	// belongs to.  Checking face centers is fairly simple, and is completely accurate except in extreme
+	// cases of polygons spanning multiple UDIMs, which is not done according to UDIM conventions.
+	int faceVertId = 0;
+	for( int numVerts : vertsPerFace )
+	{
+		Imath::V2f accum = Imath::V2f(0);
+		if( faceVarying )
+		{
+			for( int i = 0; i < numVerts; i++ )
+			{
+				accum += (*uvs)[faceVertId];
+				faceVertId++;
+			}
+		}
+		else
+		{
+			for( int i = 0; i < numVerts; i++ )
+			{
+				accum += (*uvs)[ meshPrimitive->vertexIds()->readable()[faceVertId] ];
+				faceVertId++;
+			}
+		}
+		Imath::V2f centerUV = accum / numVerts;
+		int udim = 1001 + int( floor( centerUV[0] ) ) + 10 * int( floor( centerUV[1] ) );
+
+		udims.insert( udim );
+	}
+
+	cost += udims.size();
+	return new IntVectorData( std::vector<int>( udims.begin(), udims.end() ) );
+}
+
+using UDIMsCache = IECorePreview::LRUCache<IECore::MurmurHash, ConstIntVectorDataPtr, IECorePreview::LRUCachePolicy::Parallel, UDIMsCacheGetterKey>;
+
+UDIMsCache &udimsCache()
+{
+	// Errors aren't cached, because the error message
+	// refers to the location the mesh was found at.
+	static UDIMsCache g_cache( udimsGetter, 100000, UDIMsCache::RemovalCallback(), /* cacheErrors = */ false );
+	return g_cache;
+}
 
 struct BakeInfoData
 {
@@ -201,80 +322,15 @@ struct InfoDataAccumulator
 
 	bool operator()( const GafferScene::ScenePlug *in, const GafferScene::ScenePlug::ScenePath &path )
 	{
-		IECore::CompoundObjectPtr locationDict;
-
-		IECore::ConstObjectPtr object = in->objectPlug()->getValue();
-		const IECoreScene::MeshPrimitive *meshPrimitive = runTimeCast<const IECoreScene::MeshPrimitive>( object.get() );
-		if( !meshPrimitive )
+		ConstIntVectorDataPtr udims = udimsCache().get( UDIMsCacheGetterKey( in, path, m_uvSet ) );
+		if( !udims )
 		{
 			return true;
 		}
 
-		// First check if there are face-varying UVs
-		bool faceVarying = true;
-		auto uvs = meshPrimitive->variableIndexedView<IECore::V2fVectorData>( m_uvSet,  IECoreScene::PrimitiveVariable::FaceVarying );
-		if( !uvs )
-		{
-			// Next check for vertex UVs
-			faceVarying = false;
-			uvs = meshPrimitive->variableIndexedView<IECore::V2fVectorData>( m_uvSet,  IECoreScene::PrimitiveVariable::Vertex );
-		}
-
-		if( !uvs )
-		{
-			// No face-varying or vertex UVs
-			return true;
-		}
-
-		std::string pathString;
-		ScenePlug::pathToString( path, pathString );
-		unsigned int targetSize = meshPrimitive->variableSize( faceVarying ? IECoreScene::PrimitiveVariable::FaceVarying : IECoreScene::PrimitiveVariable::Vertex );
-		if( uvs->size() != targetSize )
-		{
-			throw IECore::Exception(
-				boost::str(
-					boost::format(
-						"Cannot query UDIMs.  Bad uvs at location %s.  Required count %i but found %i."
-					) % pathString % targetSize % uvs->size()
-				)
-			);
-		}
-
-		const IntVectorData *vertsPerFaceData = meshPrimitive->verticesPerFace();
-		const std::vector<int> &vertsPerFace = vertsPerFaceData->readable();
-
 		BakeInfoData &info = *m_data.grow_by( 1 );
-		info.mesh = pathString;
-
-		// We check the center UVs of each face, because the edge uvs could lie directly on a UDIM boundary,
-		// and without checking adjacency information, it would be impossible to tell which UDIM the edge
-		// belongs to.  Checking face centers is fairly simple, and is completely accurate except in extreme
-		// cases of polygons spanning multiple UDIMs, which is not done according to UDIM conventions.
-		int faceVertId = 0;
-		for( int numVerts : vertsPerFace )
-		{
-			Imath::V2f accum = Imath::V2f(0);
-			if( faceVarying )
-			{
-				for( int i = 0; i < numVerts; i++ )
-				{
-					accum += (*uvs)[faceVertId];
-					faceVertId++;
-				}
-			}
-			else
-			{
-				for( int i = 0; i < numVerts; i++ )
-				{
-					accum += (*uvs)[ meshPrimitive->vertexIds()->readable()[faceVertId] ];
-					faceVertId++;
-				}
-			}
-			Imath::V2f centerUV = accum / numVerts;
-			int udim = 1001 + int( floor( centerUV[0] ) ) + 10 * int( floor( centerUV[1] ) );
-
-			info.udims.insert( udim );
-		}
+		ScenePlug::pathToString( path, info.mesh );
+		info.udims.insert( boost::container::ordered_unique_range, udims->readable().begin(), udims->readable().end() );
 
 		info.attributes = new CompoundObject();
 		if( m_attributeNames.size() )
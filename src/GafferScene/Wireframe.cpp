@@ -45,6 +45,10 @@
 
 #include "boost/functional/hash.hpp"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_sort.h"
+
 #include <unordered_set>
 
 using namespace std;
@@ -61,20 +65,27 @@ using namespace GafferScene;
 namespace
 {
 
+// Meshes with at least this many face-vertices are converted using
+// the parallel kernel in `MakeWireframe::makeWireframeParallel()`.
+const size_t g_parallelThreshold = 100000;
+// Number of face-vertices processed by each task when gathering
+// the output edges.
+const size_t g_outputChunkSize = 65536;
+
 struct MakeWireframe
 {
 
-	CurvesPrimitivePtr operator() ( const V2fVectorData *data, const MeshPrimitive *mesh, const string &name, const PrimitiveVariable &primitiveVariable )
+	CurvesPrimitivePtr operator() ( const V2fVectorData *data, const MeshPrimitive *mesh, const string &name, const PrimitiveVariable &primitiveVariable, const Canceller *canceller )
 	{
-		return makeWireframe<V2fVectorData>( data, mesh, name, primitiveVariable );
+		return makeWireframe<V2fVectorData>( data, mesh, name, primitiveVariable, canceller );
 	}
 
-	CurvesPrimitivePtr operator() ( const V3fVectorData *data, const MeshPrimitive *mesh, const string &name, const PrimitiveVariable &primitiveVariable )
+	CurvesPrimitivePtr operator() ( const V3fVectorData *data, const MeshPrimitive *mesh, const string &name, const PrimitiveVariable &primitiveVariable, const Canceller *canceller )
 	{
-		return makeWireframe<V3fVectorData>( data, mesh, name, primitiveVariable );
+		return makeWireframe<V3fVectorData>( data, mesh, name, primitiveVariable, canceller );
 	}
 
-	CurvesPrimitivePtr operator() ( const Data *data, const MeshPrimitive *mesh, const string &name, const PrimitiveVariable &primitiveVariable )
+	CurvesPrimitivePtr operator() ( const Data *data, const MeshPrimitive *mesh, const string &name, const PrimitiveVariable &primitiveVariable, const Canceller *canceller )
 	{
 		throw IECore::Exception( boost::str(
 			boost::format( "PrimitiveVariable \"%1%\" has unsupported type \"%2%\"" ) % name % data->typeName()
@@ -84,7 +95,7 @@ struct MakeWireframe
 	private :
 
 		template<typename T>
-		CurvesPrimitivePtr makeWireframe( const T *data, const MeshPrimitive *mesh, const string &name, const PrimitiveVariable &primitiveVariable )
+		CurvesPrimitivePtr makeWireframe( const T *data, const MeshPrimitive *mesh, const string &name, const PrimitiveVariable &primitiveVariable, const Canceller *canceller )
 		{
 			using Vec = typename T::ValueType::value_type;
 			using DataView = PrimitiveVariable::IndexedView<Vec>;
@@ -110,7 +121,26 @@ struct MakeWireframe
 
 			IECore::V3fVectorDataPtr pData = new V3fVectorData;
 			pData->setInterpretation( GeometricData::Point );
-			vector<V3f> &p = pData->writable();
+			if( mesh->variableSize( PrimitiveVariable::FaceVarying ) >= g_parallelThreshold )
+			{
+				makeWireframeParallel( mesh, dataView, vertexIds, pData->writable(), canceller );
+			}
+			else
+			{
+				makeWireframeSerial( mesh, dataView, vertexIds, pData->writable() );
+			}
+
+			IECore::IntVectorDataPtr vertsPerCurveData = new IntVectorData;
+			vertsPerCurveData->writable().resize( pData->readable().size() / 2, 2 );
+
+			CurvesPrimitivePtr result = new CurvesPrimitive( vertsPerCurveData );
+			result->variables["P"] = PrimitiveVariable( PrimitiveVariable::Vertex, pData );
+			return result;
+		}
+
+		template<typename DataView>
+		void makeWireframeSerial( const MeshPrimitive *mesh, const DataView &dataView, const vector<int> *vertexIds, vector<V3f> &p )
+		{
 			// We don't know upfront how many edges we will generate.
 			// `mesh->variableSize( PrimitiveVariable::FaceVarying )` gives us
 			// an upper bound, but edges can be shared by faces in which case
@@ -149,13 +179,142 @@ struct MakeWireframe
 				}
 				vertexIdsIndex += numVertices;
 			}
+		}
 
-			IECore::IntVectorDataPtr vertsPerCurveData = new IntVectorData;
-			vertsPerCurveData->writable().resize( p.size() / 2, 2 );
+		// Produces exactly the same result as `makeWireframeSerial()`, by
+		// emitting each edge only from the first face-vertex that references
+		// it. We find that face-vertex by sorting all candidate edges (with
+		// the face-vertex index as a tie-breaker) rather than by inserting
+		// into a shared set, so the output doesn't depend on scheduling.
+		template<typename DataView>
+		void makeWireframeParallel( const MeshPrimitive *mesh, const DataView &dataView, const vector<int> *vertexIds, vector<V3f> &p, const Canceller *canceller )
+		{
+			const vector<int> &verticesPerFace = mesh->verticesPerFace()->readable();
+			const size_t numFaceVertices = mesh->variableSize( PrimitiveVariable::FaceVarying );
 
-			CurvesPrimitivePtr result = new CurvesPrimitive( vertsPerCurveData );
-			result->variables["P"] = PrimitiveVariable( PrimitiveVariable::Vertex, pData );
-			return result;
+			vector<size_t> faceOffsets;
+			faceOffsets.reserve( verticesPerFace.size() );
+			size_t offset = 0;
+			for( int numVertices : verticesPerFace )
+			{
+				faceOffsets.push_back( offset );
+				offset += numVertices;
+			}
+
+			// Edge endpoints for each face-vertex, in winding order, and
+			// the same edges keyed by their unordered endpoints for sorting.
+
+			using Endpoints = std::pair<int, int>;
+			vector<Endpoints> endpoints( numFaceVertices );
+
+			struct SortableEdge
+			{
+				uint64_t key;
+				size_t faceVertex;
+				bool operator < ( const SortableEdge &rhs ) const
+				{
+					return key < rhs.key || ( key == rhs.key && faceVertex < rhs.faceVertex );
+				}
+			};
+			vector<SortableEdge> sortedEdges( numFaceVertices );
+
+			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, verticesPerFace.size() ),
+				[&]( const tbb::blocked_range<size_t> &r ) {
+					Canceller::check( canceller );
+					for( size_t f = r.begin(); f != r.end(); ++f )
+					{
+						const int numVertices = verticesPerFace[f];
+						const size_t faceOffset = faceOffsets[f];
+						for( int i = 0; i < numVertices; ++i )
+						{
+							const size_t faceVertex = faceOffset + i;
+							int index0 = faceVertex;
+							int index1 = faceOffset + (i + 1) % numVertices;
+							if( vertexIds )
+							{
+								index0 = (*vertexIds)[index0];
+								index1 = (*vertexIds)[index1];
+							}
+							endpoints[faceVertex] = Endpoints( index0, index1 );
+							sortedEdges[faceVertex] = {
+								(uint64_t)(uint32_t)min( index0, index1 ) << 32 | (uint32_t)max( index0, index1 ),
+								faceVertex
+							};
+						}
+					}
+				},
+				taskGroupContext
+			);
+
+			tbb::parallel_sort( sortedEdges.begin(), sortedEdges.end() );
+			Canceller::check( canceller );
+
+			vector<unsigned char> emit( numFaceVertices, 0 );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, numFaceVertices ),
+				[&]( const tbb::blocked_range<size_t> &r ) {
+					for( size_t i = r.begin(); i != r.end(); ++i )
+					{
+						if( i == 0 || sortedEdges[i].key != sortedEdges[i-1].key )
+						{
+							emit[sortedEdges[i].faceVertex] = 1;
+						}
+					}
+				},
+				taskGroupContext
+			);
+
+			// Count the edges emitted by each fixed-size chunk of face-vertices,
+			// so that each chunk knows where to write its output.
+
+			const size_t numChunks = ( numFaceVertices + g_outputChunkSize - 1 ) / g_outputChunkSize;
+			vector<size_t> chunkOffsets( numChunks + 1, 0 );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, numChunks ),
+				[&]( const tbb::blocked_range<size_t> &r ) {
+					Canceller::check( canceller );
+					for( size_t c = r.begin(); c != r.end(); ++c )
+					{
+						const size_t end = min( ( c + 1 ) * g_outputChunkSize, numFaceVertices );
+						size_t count = 0;
+						for( size_t i = c * g_outputChunkSize; i < end; ++i )
+						{
+							count += emit[i];
+						}
+						chunkOffsets[c+1] = count;
+					}
+				},
+				taskGroupContext
+			);
+
+			for( size_t c = 0; c < numChunks; ++c )
+			{
+				chunkOffsets[c+1] += chunkOffsets[c];
+			}
+
+			p.resize( chunkOffsets.back() * 2 );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, numChunks ),
+				[&]( const tbb::blocked_range<size_t> &r ) {
+					Canceller::check( canceller );
+					for( size_t c = r.begin(); c != r.end(); ++c )
+					{
+						const size_t end = min( ( c + 1 ) * g_outputChunkSize, numFaceVertices );
+						size_t pIndex = chunkOffsets[c] * 2;
+						for( size_t i = c * g_outputChunkSize; i < end; ++i )
+						{
+							if( emit[i] )
+							{
+								p[pIndex++] = v3f( dataView[endpoints[i].first] );
+								p[pIndex++] = v3f( dataView[endpoints[i].second] );
+							}
+						}
+					}
+				},
+				taskGroupContext
+			);
 		}
 
 		V3f v3f( const Imath::V3f &v )
@@ -171,7 +330,7 @@ struct MakeWireframe
 };
 
 /// \todo Perhaps this could go in IECoreScene::MeshAlgo
-CurvesPrimitivePtr wireframe( const MeshPrimitive *mesh, const std::string &position )
+CurvesPrimitivePtr wireframe( const MeshPrimitive *mesh, const std::string &position, const Canceller *canceller )
 {
 	auto it = mesh->variables.find( position );
 	if( it == mesh->variables.end() )
@@ -181,7 +340,7 @@ CurvesPrimitivePtr wireframe( const MeshPrimitive *mesh, const std::string &posi
 		) );
 	}
 
-	CurvesPrimitivePtr result = dispatch( it->second.data.get(), MakeWireframe(), mesh, it->first, it->second );
+	CurvesPrimitivePtr result = dispatch( it->second.data.get(), MakeWireframe(), mesh, it->first, it->second, canceller );
 	return result;
 }
 
@@ -250,7 +409,7 @@ IECore::ConstObjectPtr Wireframe::computeProcessedObject( const ScenePath &path,
 		return inputObject;
 	}
 
-	CurvesPrimitivePtr result = wireframe( mesh, positionPlug()->getValue() );
+	CurvesPrimitivePtr result = wireframe( mesh, positionPlug()->getValue(), context->canceller() );
 	for( const auto &pv : mesh->variables )
 	{
 		if( pv.second.interpolation == PrimitiveVariable::Constant )
@@ -264,6 +423,11 @@ IECore::ConstObjectPtr Wireframe::computeProcessedObject( const ScenePath &path,
 	return result;
 }
 
+Gaffer::ValuePlug::CachePolicy Wireframe::processedObjectComputeCachePolicy() const
+{
+	return ValuePlug::CachePolicy::TaskCollaboration;
+}
+
 bool Wireframe::adjustBounds() const
 {
 	if( !Deformer::adjustBounds() )
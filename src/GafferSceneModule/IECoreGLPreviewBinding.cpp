@@ -40,12 +40,49 @@
 #include "GafferScene/Private/IECoreGLPreview/ObjectVisualiser.h"
 #include "GafferScene/Private/IECoreGLPreview/AttributeVisualiser.h"
 #include "GafferScene/Private/IECoreGLPreview/LightVisualiser.h"
+#include "GafferScene/Private/IECoreGLPreview/MeshProxyAlgo.h"
 
 #include "IECorePython/RefCountedBinding.h"
+#include "IECorePython/ScopedGILRelease.h"
+
+#include "boost/python/suite/indexing/container_utils.hpp"
 
 using namespace IECoreGLPreview;
 using namespace boost::python;
 
+namespace
+{
+
+IECoreScene::MeshPrimitivePtr decimateWrapper( const IECoreScene::MeshPrimitive &mesh, size_t targetTriangles )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return MeshProxyAlgo::decimate( &mesh, targetTriangles );
+}
+
+size_t numTrianglesWrapper( const IECoreScene::MeshPrimitive &mesh )
+{
+	return MeshProxyAlgo::numTriangles( &mesh );
+}
+
+list levelTriangleCountsWrapper( size_t numTriangles )
+{
+	list result;
+	for( auto c : MeshProxyAlgo::levelTriangleCounts( numTriangles ) )
+	{
+		result.append( c );
+	}
+	return result;
+}
+
+size_t selectLevelWrapper( object pythonLevelTriangleCounts, float projectedArea )
+{
+	std::vector<size_t> levelTriangleCounts;
+	boost::python::container_utils::extend_container( levelTriangleCounts, pythonLevelTriangleCounts );
+	return MeshProxyAlgo::selectLevel( levelTriangleCounts, projectedArea );
+}
+
+} // namespace
+
 void GafferSceneModule::bindIECoreGLPreview()
 {
 	object module( borrowed( PyImport_AddModule( "GafferScene.IECoreScenePreview" ) ) );
@@ -110,4 +147,16 @@ void GafferSceneModule::bindIECoreGLPreview()
 		.def( "createFrustum", &Visualisation::createFrustum )
 		.staticmethod( "createFrustum" )
 	;
+
+	{
+		object meshProxyAlgoModule( borrowed( PyImport_AddModule( "GafferScene.IECoreScenePreview.MeshProxyAlgo" ) ) );
+		scope().attr( "MeshProxyAlgo" ) = meshProxyAlgoModule;
+		scope meshProxyAlgoScope( meshProxyAlgoModule );
+
+		def( "decimate", &decimateWrapper, ( arg( "mesh" ), arg( "targetTriangles" ) ) );
+		def( "numTriangles", &numTrianglesWrapper, ( arg( "mesh" ) ) );
+		def( "levelTriangleCounts", &levelTriangleCountsWrapper, ( arg( "numTriangles" ) ) );
+		def( "projectedArea", &MeshProxyAlgo::projectedArea, ( arg( "bound" ), arg( "worldToClip" ), arg( "viewportSize" ) ) );
+		def( "selectLevel", &selectLevelWrapper, ( arg( "levelTriangleCounts" ), arg( "projectedArea" ) ) );
+	}
 }
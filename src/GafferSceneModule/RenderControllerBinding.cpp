@@ -119,6 +119,8 @@ void GafferSceneModule::bindRenderController()
 		.def( "getExpandedPaths", &RenderController::getExpandedPaths, return_value_policy<copy_const_reference>() )
 		.def( "setMinimumExpansionDepth", &setMinimumExpansionDepth )
 		.def( "getMinimumExpansionDepth", &RenderController::getMinimumExpansionDepth )
+		.def( "setBoundsFirst", &RenderController::setBoundsFirst )
+		.def( "getBoundsFirst", &RenderController::getBoundsFirst )
 		.def( "updateRequiredSignal", &RenderController::updateRequiredSignal, return_internal_reference<1>() )
 		.def( "update", &update )
 		.def( "updateMatchingPaths", &updateMatchingPaths )
@@ -38,6 +38,8 @@
 
 #include "GafferUI/ViewportGadget.h"
 
+#include "GafferScene/Private/IECoreGLPreview/MeshProxyAlgo.h"
+
 #include "Gaffer/BackgroundTask.h"
 
 #include "boost/bind.hpp"
@@ -89,6 +91,7 @@ SceneGadget::SceneGadget()
 	);
 
 	visibilityChangedSignal().connect( boost::bind( &SceneGadget::visibilityChanged, this ) );
+	IECoreGLPreview::MeshProxyAlgo::conversionCompletedSignal().connect( boost::bind( &SceneGadget::meshConversionCompleted, this ) );
 
 	setContext( new Context );
 }
@@ -168,6 +171,16 @@ bool SceneGadget::getPaused() const
 	return m_paused;
 }
 
+void SceneGadget::setBoundsFirst( bool boundsFirst )
+{
+	m_controller.setBoundsFirst( boundsFirst );
+}
+
+bool SceneGadget::getBoundsFirst() const
+{
+	return m_controller.getBoundsFirst();
+}
+
 void SceneGadget::setBlockingPaths( const IECore::PathMatcher &blockingPaths )
 {
 	if( m_updateTask )
@@ -391,16 +404,19 @@ IECore::PathMatcher SceneGadget::convertSelection( IECore::UIntVectorDataPtr ids
 	// Unexpanded locations are represented with
 	// objects named __unexpandedChildren__ to allow
 	// locations to have an object _and_ children.
+	// Likewise, objects which haven't been loaded yet
+	// are represented by __placeholderBound__ objects.
 	// We want to replace any such locations with their
 	// parent location.
 	const InternedString unexpandedChildren = "__unexpandedChildren__";
+	const InternedString placeholderBound = "__placeholderBound__";
 	vector<InternedString> parent;
 
 	PathMatcher toAdd;
 	PathMatcher toRemove;
 	for( PathMatcher::Iterator it = result.begin(), eIt = result.end(); it != eIt; ++it )
 	{
-		if( it->size() && it->back() == unexpandedChildren )
+		if( it->size() && ( it->back() == unexpandedChildren || it->back() == placeholderBound ) )
 		{
 			toRemove.addPath( *it );
 			parent.assign( it->begin(), it->end() - 1 );
@@ -576,3 +592,10 @@ void SceneGadget::visibilityChanged()
 		m_updateTask->cancelAndWait();
 	}
 }
+
+void SceneGadget::meshConversionCompleted()
+{
+	// The renderer may have been drawing a proxy in place
+	// of the converted mesh, so must draw again.
+	dirty( DirtyType::Render );
+}
@@ -500,6 +500,10 @@ class TextureGadget : public GafferUI::Gadget
 			m_resize->inPlug()->setInput( m_imageReader->outPlug() );
 			m_resize->formatPlug()->setValue( Format( 256, 256 ) );
 			m_resize->fitModePlug()->setValue( Resize::Distort );
+			// Textures are typically much larger than the display resolution,
+			// so we use the cheapest filter, which visits each input pixel
+			// only once when downsampling.
+			m_resize->filterPlug()->setValue( "box" );
 
 			setChild( g_imageGadgetName, new ImageGadget );
 			imageGadget()->setLabelsVisible( false );
@@ -526,13 +530,7 @@ class TextureGadget : public GafferUI::Gadget
 			}
 
 			m_imageReader->fileNamePlug()->setValue( fileName );
-
-			// Transform ImageGadget into 0-1 space.
-			const Box3f b = imageGadget()->bound();
-			M44f m;
-			m.translate( -b.min );
-			m.scale( V3f( 1 / b.size().x, 1 / b.size().y, 1 ) );
-			imageGadget()->setTransform( m );
+			updateImageGadgetTransform();
 		}
 
 		string getFileName() const
@@ -540,6 +538,22 @@ class TextureGadget : public GafferUI::Gadget
 			return m_imageReader->fileNamePlug()->getValue();
 		}
 
+		void setResolution( int resolution )
+		{
+			if( resolution == getResolution() )
+			{
+				return;
+			}
+
+			m_resize->formatPlug()->setValue( Format( resolution, resolution ) );
+			updateImageGadgetTransform();
+		}
+
+		int getResolution() const
+		{
+			return m_resize->formatPlug()->getValue().width();
+		}
+
 		void setDisplayTransform( const std::string &name )
 		{
 			ImageProcessorPtr processor;
@@ -580,6 +594,16 @@ class TextureGadget : public GafferUI::Gadget
 
 	private :
 
+		void updateImageGadgetTransform()
+		{
+			// Transform ImageGadget into 0-1 space.
+			const Box3f b = imageGadget()->bound();
+			M44f m;
+			m.translate( -b.min );
+			m.scale( V3f( 1 / b.size().x, 1 / b.size().y, 1 ) );
+			imageGadget()->setTransform( m );
+		}
+
 		ImageReaderPtr m_imageReader;
 		ResizePtr m_resize;
 		std::string m_displayTransform;
@@ -613,6 +637,7 @@ UVView::UVView( const std::string &name )
 	addChild( new StringPlug( "uvSet", Plug::In, "uv" ) );
 	addChild( new StringPlug( "textureFileName" ) );
 	addChild( new StringPlug( "displayTransform", Plug::In, "Default" ) );
+	addChild( new IntPlug( "textureResolution", Plug::In, 256, 16, 4096 ) );
 	addChild( new CompoundObjectPlug( "__textures", Plug::In, new CompoundObject ) );
 
 	addChild( new UVScene( "__uvScene" ) );
@@ -698,24 +723,34 @@ const Gaffer::StringPlug *UVView::displayTransformPlug() const
 	return getChild<StringPlug>( g_firstPlugIndex + 2 );
 }
 
+Gaffer::IntPlug *UVView::textureResolutionPlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 3 );
+}
+
+const Gaffer::IntPlug *UVView::textureResolutionPlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 3 );
+}
+
 Gaffer::CompoundObjectPlug *UVView::texturesPlug()
 {
-	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 3 );
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 4 );
 }
 
 const Gaffer::CompoundObjectPlug *UVView::texturesPlug() const
 {
-	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 3 );
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 4 );
 }
 
 UVView::UVScene *UVView::uvScene()
 {
-	return getChild<UVScene>( g_firstPlugIndex + 4 );
+	return getChild<UVScene>( g_firstPlugIndex + 5 );
 }
 
 const UVView::UVScene *UVView::uvScene() const
 {
-	return getChild<UVScene>( g_firstPlugIndex + 4 );
+	return getChild<UVScene>( g_firstPlugIndex + 5 );
 }
 
 void UVView::setPaused( bool paused )
@@ -784,6 +819,10 @@ void UVView::plugSet( const Gaffer::Plug *plug )
 	{
 		updateDisplayTransform();
 	}
+	else if( plug == textureResolutionPlug() )
+	{
+		updateTextureResolution();
+	}
 }
 
 void UVView::plugDirtied( const Gaffer::Plug *plug )
@@ -869,6 +908,7 @@ void UVView::updateTextureGadgets( const IECore::ConstCompoundObjectPtr &texture
 
 			g->setTransform( M44f().translate( V3f( u, v, 0 ) ) );
 			g->setDisplayTransform( displayTransformPlug()->getValue() );
+			g->setResolution( textureResolutionPlug()->getValue() );
 
 			g->imageGadget()->stateChangedSignal().connect(
 				[this]( ImageGadget *g ) { this->gadgetStateChanged( g, g->state() == ImageGadget::Running ); }
@@ -905,6 +945,15 @@ void UVView::updateDisplayTransform()
 	}
 }
 
+void UVView::updateTextureResolution()
+{
+	const int resolution = textureResolutionPlug()->getValue();
+	for( TextureGadgetIterator it( textureGadgets() ); !it.done(); ++it )
+	{
+		(*it)->setResolution( resolution );
+	}
+}
+
 void UVView::gadgetStateChanged( const Gadget *gadget, bool running )
 {
 	const State oldState = state();
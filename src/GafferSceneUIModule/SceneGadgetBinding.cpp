@@ -162,6 +162,8 @@ void GafferSceneUIModule::bindSceneGadget()
 		.def( "getMinimumExpansionDepth", &SceneGadget::getMinimumExpansionDepth )
 		.def( "getPaused", &SceneGadget::getPaused )
 		.def( "setPaused", &setPaused )
+		.def( "setBoundsFirst", &SceneGadget::setBoundsFirst )
+		.def( "getBoundsFirst", &SceneGadget::getBoundsFirst )
 		.def( "state", &SceneGadget::state )
 		.def( "stateChangedSignal", &SceneGadget::stateChangedSignal, return_internal_reference<1>() )
 		.def( "waitForCompletion", &waitForCompletion )
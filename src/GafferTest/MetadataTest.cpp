@@ -81,3 +81,31 @@ void GafferTest::testMetadataThreading()
 	TestThreading t;
 	parallel_for( blocked_range<size_t>( 0, 10000 ), t );
 }
+
+void GafferTest::parallelMetadataValues( const Gaffer::GraphComponent *root, const std::vector<IECore::InternedString> &keys, size_t iterations )
+{
+	std::vector<const GraphComponent *> graphComponents( { root } );
+	for( size_t i = 0; i < graphComponents.size(); ++i )
+	{
+		for( const auto &child : graphComponents[i]->children() )
+		{
+			graphComponents.push_back( child.get() );
+		}
+	}
+
+	parallel_for(
+		blocked_range<size_t>( 0, iterations ),
+		[&]( const blocked_range<size_t> &r ) {
+			for( size_t i = r.begin(); i != r.end(); ++i )
+			{
+				for( const auto &graphComponent : graphComponents )
+				{
+					for( const auto &key : keys )
+					{
+						Metadata::value( graphComponent, key );
+					}
+				}
+			}
+		}
+	);
+}
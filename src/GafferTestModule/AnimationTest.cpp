@@ -0,0 +1,93 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2021, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#include "boost/python.hpp"
+
+#include "AnimationTest.h"
+
+#include "Gaffer/Animation.h"
+#include "Gaffer/Context.h"
+
+#include "IECorePython/ScopedGILRelease.h"
+
+#include "tbb/parallel_for.h"
+
+using namespace boost::python;
+using namespace Gaffer;
+
+namespace
+{
+
+// Simulates playback of a rig, by evaluating the outputs of
+// all the curves on `animation` in parallel, once for each
+// frame in the range `[startFrame, startFrame + numFrames)`.
+void playbackAnimation( const Animation *animation, int startFrame, int numFrames )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+
+	std::vector<const FloatPlug *> outputs;
+	for( const auto &child : animation->curvesPlug()->children() )
+	{
+		if( auto curve = IECore::runTimeCast<const Animation::CurvePlug>( child.get() ) )
+		{
+			outputs.push_back( curve->outPlug() );
+		}
+	}
+
+	const Context *context = Context::current();
+	for( int frame = startFrame; frame < startFrame + numFrames; ++frame )
+	{
+		tbb::parallel_for(
+			tbb::blocked_range<size_t>( 0, outputs.size() ),
+			[&outputs, &context, frame]( const tbb::blocked_range<size_t> &r ) {
+				Context::EditableScope scope( context );
+				scope.setFrame( frame );
+				for( size_t i = r.begin(); i < r.end(); ++i )
+				{
+					outputs[i]->getValue();
+				}
+			}
+		);
+	}
+}
+
+} // namespace
+
+void GafferTestModule::bindAnimationTest()
+{
+	def( "playbackAnimation", &playbackAnimation );
+}
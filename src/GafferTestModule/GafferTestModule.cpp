@@ -45,6 +45,7 @@
 #include "GafferTest/MultiplyNode.h"
 #include "GafferTest/RecursiveChildIteratorTest.h"
 
+#include "AnimationTest.h"
 #include "LRUCacheTest.h"
 #include "TaskMutexTest.h"
 #include "ValuePlugTest.h"
@@ -62,6 +63,17 @@ static void testMetadataThreadingWrapper()
 	testMetadataThreading();
 }
 
+static void parallelMetadataValuesWrapper( const Gaffer::GraphComponent *root, object pythonKeys, size_t iterations )
+{
+	std::vector<IECore::InternedString> keys;
+	for( size_t i = 0, e = len( pythonKeys ); i < e; ++i )
+	{
+		keys.push_back( extract<std::string>( pythonKeys[i] )() );
+	}
+	IECorePython::ScopedGILRelease gilRelease;
+	parallelMetadataValues( root, keys, iterations );
+}
+
 BOOST_PYTHON_MODULE( _GafferTest )
 {
 
@@ -78,6 +90,7 @@ BOOST_PYTHON_MODULE( _GafferTest )
 	def( "testRecursiveChildIterator", &testRecursiveChildIterator );
 	def( "testFilteredRecursiveChildIterator", &testFilteredRecursiveChildIterator );
 	def( "testMetadataThreading", &testMetadataThreadingWrapper );
+	def( "parallelMetadataValues", &parallelMetadataValuesWrapper );
 	def( "testManyContexts", &testManyContexts );
 	def( "testManySubstitutions", &testManySubstitutions );
 	def( "testManyEnvironmentSubstitutions", &testManyEnvironmentSubstitutions );
@@ -90,5 +103,6 @@ BOOST_PYTHON_MODULE( _GafferTest )
 	bindLRUCacheTest();
 	bindValuePlugTest();
 	bindMessagesTest();
+	bindAnimationTest();
 
 }
@@ -40,8 +40,12 @@
 
 #include "GafferTest/MultiplyNode.h"
 
+#include "Gaffer/Context.h"
+#include "Gaffer/NumericPlug.h"
 #include "Gaffer/ValuePlug.h"
 
+#include "IECorePython/ScopedGILRelease.h"
+
 #include "tbb/parallel_for.h"
 
 using namespace boost::python;
@@ -66,9 +70,29 @@ void testValuePlugContentionForOneItem()
 	);
 }
 
+// Evaluates `plug` in parallel, once for each frame in the range
+// `[0, numFrames)`.
+void parallelGetValueForFrames( const IntPlug *plug, int numFrames )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	const Context *context = Context::current();
+	tbb::parallel_for(
+		tbb::blocked_range<int>( 0, numFrames ),
+		[&plug, &context]( const tbb::blocked_range<int> &r ) {
+			Context::EditableScope scope( context );
+			for( int i = r.begin(); i < r.end(); ++i )
+			{
+				scope.setFrame( i );
+				plug->getValue();
+			}
+		}
+	);
+}
+
 } // namespace
 
 void GafferTestModule::bindValuePlugTest()
 {
 	def( "testValuePlugContentionForOneItem", &testValuePlugContentionForOneItem );
+	def( "parallelGetValueForFrames", &parallelGetValueForFrames );
 }
@@ -369,7 +369,9 @@ void AnimationGadget::doRenderLayer( Layer layer, const Style *style ) const
 		boost::format formatX( "%.2f" );
 		boost::format formatY( "%.3f" );
 
-		// \todo: pull matrix stack operations out of the loops.
+		const M44f labelScale = M44f().scale( V3f( m_textScale, -m_textScale, m_textScale ) );
+		std::vector<Style::TextLabel> labels;
+
 		for( const auto &x : xAxis.main )
 		{
 			if( x.first < m_xMargin )
@@ -377,17 +379,11 @@ void AnimationGadget::doRenderLayer( Layer layer, const Style *style ) const
 				continue;
 			}
 
-			glPushMatrix();
-
 			std::string label = boost::str( formatX % x.second );
 			Box3f labelBound = style->textBound( Style::BodyText, label );
 
-			glTranslatef( x.first - labelBound.center().x * m_textScale, resolution.y - m_labelPadding, 0.0f );
-			glScalef( m_textScale, -m_textScale, m_textScale );
-
-			style->renderText( Style::BodyText, label );
-
-			glPopMatrix();
+			const V3f translate( x.first - labelBound.center().x * m_textScale, resolution.y - m_labelPadding, 0.0f );
+			labels.push_back( { label, labelScale * M44f().translate( translate ) } );
 		}
 
 		for( const auto &y : yAxis.main )
@@ -397,19 +393,15 @@ void AnimationGadget::doRenderLayer( Layer layer, const Style *style ) const
 				continue;
 			}
 
-			glPushMatrix();
-
 			std::string label = boost::str( formatY % y.second );
 			Box3f labelBound = style->textBound( Style::BodyText, label );
 
-			glTranslatef( ( m_xMargin - m_labelPadding ) - labelBound.size().x * m_textScale, y.first + labelBound.center().y * m_textScale, 0.0f );
-			glScalef( m_textScale, -m_textScale, m_textScale );
-
-			style->renderText( Style::BodyText, label );
-
-			glPopMatrix();
+			const V3f translate( ( m_xMargin - m_labelPadding ) - labelBound.size().x * m_textScale, y.first + labelBound.center().y * m_textScale, 0.0f );
+			labels.push_back( { label, labelScale * M44f().translate( translate ) } );
 		}
 
+		style->renderTextBatch( Style::BodyText, labels );
+
 		break;
 
 	}
@@ -59,6 +59,7 @@
 #include "Gaffer/StandardSet.h"
 #include "Gaffer/TypedPlug.h"
 
+#include "IECore/BoundedKDTree.h"
 #include "IECore/BoxOps.h"
 #include "IECore/Export.h"
 #include "IECore/NullObject.h"
@@ -70,6 +71,9 @@ IECORE_POP_DEFAULT_VISIBILITY
 #include "boost/bind.hpp"
 #include "boost/bind/placeholders.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+
 using namespace GafferUI;
 using namespace Imath;
 using namespace IECore;
@@ -104,6 +108,16 @@ const InternedString g_nodeGadgetTypeName( "nodeGadget:type" );
 const InternedString g_auxiliaryConnectionsGadgetName( "__auxiliaryConnections" );
 const InternedString g_annotationsGadgetName( "__annotations" );
 
+// When zoomed out so that there are fewer raster pixels than this
+// per unit of gadget space, node labels become illegible and nodules
+// too small to interact with, so we omit them.
+const float g_lowDetailPixelsPerUnit = 2.0f;
+
+Box2f box2( const Box3f &b )
+{
+	return Box2f( V2f( b.min.x, b.min.y ), V2f( b.max.x, b.max.y ) );
+}
+
 struct CompareV2fX{
 	bool operator()(const Imath::V2f &a, const Imath::V2f &b) const
 	{
@@ -225,6 +239,98 @@ IE_CORE_DECLAREPTR( SetPositionsAction )
 
 } // namespace
 
+//////////////////////////////////////////////////////////////////////////
+// SpatialIndex
+//////////////////////////////////////////////////////////////////////////
+
+struct GraphGadget::SpatialIndex
+{
+
+	SpatialIndex( const GraphGadget *graphGadget )
+	{
+		for( const auto &child : graphGadget->children() )
+		{
+			const Gadget *gadget = static_cast<const Gadget *>( child.get() );
+			if( !gadget->getVisible() )
+			{
+				continue;
+			}
+
+			Box2f bound;
+			if( runTimeCast<const NodeGadget>( gadget ) )
+			{
+				bound = box2( gadget->transformedBound() );
+			}
+			else if( runTimeCast<const ConnectionGadget>( gadget ) )
+			{
+				// Connections are drawn as curves which may bulge outside
+				// the bound of their endpoints, so we pad the bound generously.
+				bound = box2( gadget->transformedBound() );
+				if( !bound.isEmpty() )
+				{
+					const V2f size = bound.size();
+					bound.min -= V2f( 1.0f + std::max( size.x, size.y ) * 0.5f );
+					bound.max += V2f( 1.0f + std::max( size.x, size.y ) * 0.5f );
+				}
+			}
+			else
+			{
+				continue;
+			}
+
+			if( bound.isEmpty() )
+			{
+				continue;
+			}
+
+			indices[gadget] = bounds.size();
+			bounds.push_back( bound );
+			gadgets.push_back( const_cast<Gadget *>( gadget ) );
+		}
+
+		if( bounds.size() )
+		{
+			tree.reset( new Box2fTree( bounds.begin(), bounds.end() ) );
+		}
+	}
+
+	template<typename T>
+	size_t gadgetsInRegion( const Box2f &region, std::vector<T *> &result ) const
+	{
+		if( !tree )
+		{
+			return result.size();
+		}
+
+		std::vector<std::vector<Box2f>::const_iterator> intersectingBounds;
+		tree->intersectingBounds( region, intersectingBounds );
+		// Sort so that results are in child order, which
+		// is also the order in which gadgets are drawn.
+		std::sort( intersectingBounds.begin(), intersectingBounds.end() );
+		for( const auto &it : intersectingBounds )
+		{
+			if( T *gadget = runTimeCast<T>( gadgets[it - bounds.begin()] ) )
+			{
+				result.push_back( gadget );
+			}
+		}
+		return result.size();
+	}
+
+	// Returns nullptr if the gadget isn't indexed.
+	const Box2f *bound( const Gadget *gadget ) const
+	{
+		auto it = indices.find( gadget );
+		return it != indices.end() ? &bounds[it->second] : nullptr;
+	}
+
+	std::vector<Box2f> bounds;
+	std::vector<Gadget *> gadgets;
+	std::unordered_map<const Gadget *, size_t> indices;
+	std::unique_ptr<Box2fTree> tree;
+
+};
+
 //////////////////////////////////////////////////////////////////////////
 // GraphGadget implementation
 //////////////////////////////////////////////////////////////////////////
@@ -232,7 +338,8 @@ IE_CORE_DECLAREPTR( SetPositionsAction )
 GAFFER_GRAPHCOMPONENT_DEFINE_TYPE( GraphGadget );
 
 GraphGadget::GraphGadget( Gaffer::NodePtr root, Gaffer::SetPtr filter )
-	:	m_dragStartPosition( 0 ), m_lastDragPosition( 0 ), m_dragMode( None ), m_dragReconnectCandidate( nullptr ), m_dragReconnectSrcNodule( nullptr ), m_dragReconnectDstNodule( nullptr ), m_dragMergeGroupId( 0 )
+	:	m_dragStartPosition( 0 ), m_lastDragPosition( 0 ), m_dragMode( None ), m_dragReconnectCandidate( nullptr ), m_dragReconnectSrcNodule( nullptr ), m_dragReconnectDstNodule( nullptr ), m_dragMergeGroupId( 0 ),
+		m_renderingLowDetail( false )
 {
 	keyPressSignal().connect( boost::bind( &GraphGadget::keyPressed, this, ::_1,  ::_2 ) );
 	buttonPressSignal().connect( boost::bind( &GraphGadget::buttonPress, this, ::_1,  ::_2 ) );
@@ -680,6 +787,15 @@ const GraphLayout *GraphGadget::getLayout() const
 
 NodeGadget *GraphGadget::nodeGadgetAt( const IECore::LineSegment3f &lineInGadgetSpace ) const
 {
+	// Use the spatial index to avoid a costly selection
+	// render when there are no nodes under the line.
+	const V2f p( lineInGadgetSpace.p0.x, lineInGadgetSpace.p0.y );
+	std::vector<NodeGadget *> candidates;
+	if( !nodeGadgetsInRegion( Box2f( p, p ), candidates ) )
+	{
+		return nullptr;
+	}
+
 	const ViewportGadget *viewportGadget = ancestor<ViewportGadget>();
 
 	std::vector<GadgetPtr> gadgetsUnderMouse;
@@ -704,6 +820,13 @@ NodeGadget *GraphGadget::nodeGadgetAt( const IECore::LineSegment3f &lineInGadget
 
 ConnectionGadget *GraphGadget::connectionGadgetAt( const IECore::LineSegment3f &lineInGadgetSpace ) const
 {
+	const V2f p( lineInGadgetSpace.p0.x, lineInGadgetSpace.p0.y );
+	std::vector<ConnectionGadget *> candidates;
+	if( !connectionGadgetsInRegion( Box2f( p, p ), candidates ) )
+	{
+		return nullptr;
+	}
+
 	const ViewportGadget *viewportGadget = ancestor<ViewportGadget>();
 
 	std::vector<GadgetPtr> gadgetsUnderMouse;
@@ -760,10 +883,77 @@ ConnectionGadget *GraphGadget::reconnectionGadgetAt( const NodeGadget *gadget, c
 	return nullptr;
 }
 
+size_t GraphGadget::nodeGadgetsInRegion( const Imath::Box2f &region, std::vector<NodeGadget *> &nodeGadgets ) const
+{
+	return spatialIndex()->gadgetsInRegion( region, nodeGadgets );
+}
+
+size_t GraphGadget::connectionGadgetsInRegion( const Imath::Box2f &region, std::vector<ConnectionGadget *> &connectionGadgets ) const
+{
+	return spatialIndex()->gadgetsInRegion( region, connectionGadgets );
+}
+
+bool GraphGadget::renderingLowDetail() const
+{
+	return m_renderingLowDetail;
+}
+
+const GraphGadget::SpatialIndex *GraphGadget::spatialIndex() const
+{
+	// Updates the layout if necessary, which
+	// discards any out of date index.
+	bound();
+	if( !m_spatialIndex )
+	{
+		m_spatialIndex.reset( new SpatialIndex( this ) );
+	}
+	return m_spatialIndex.get();
+}
+
+void GraphGadget::updateLayout() const
+{
+	ContainerGadget::updateLayout();
+	m_spatialIndex.reset();
+}
+
+bool GraphGadget::shouldRenderChild( const Gadget *child ) const
+{
+	const Box2f *bound = m_spatialIndex ? m_spatialIndex->bound( child ) : nullptr;
+	if( !bound )
+	{
+		// Not a NodeGadget or ConnectionGadget.
+		return true;
+	}
+	return m_renderRegion.intersects( *bound );
+}
+
 void GraphGadget::doRenderLayer( Layer layer, const Style *style ) const
 {
 	Gadget::doRenderLayer( layer, style );
 
+	// Update the state used by `shouldRenderChild()` and
+	// `renderingLowDetail()`.
+
+	spatialIndex();
+	m_renderRegion.makeInfinite();
+	m_renderingLowDetail = false;
+	if( const ViewportGadget *viewportGadget = ancestor<ViewportGadget>() )
+	{
+		const V2f viewport( viewportGadget->getViewport() );
+		m_renderRegion.makeEmpty();
+		for( const V2f &corner : { V2f( 0 ), V2f( viewport.x, 0 ), viewport, V2f( 0, viewport.y ) } )
+		{
+			const V3f p = viewportGadget->rasterToGadgetSpace( corner, this ).p0;
+			m_renderRegion.extendBy( V2f( p.x, p.y ) );
+		}
+
+		const float pixelsPerUnit = (
+			viewportGadget->gadgetToRasterSpace( V3f( 1, 0, 0 ), this ) -
+			viewportGadget->gadgetToRasterSpace( V3f( 0 ), this )
+		).length();
+		m_renderingLowDetail = pixelsPerUnit < g_lowDetailPixelsPerUnit;
+	}
+
 	glDisable( GL_DEPTH_TEST );
 
 	switch( layer )
@@ -326,7 +326,7 @@ StandardNodeGadget::StandardNodeGadget( Gaffer::NodePtr node )
 	////////////////////////////////////////////////////////
 
 	node->errorSignal().connect( boost::bind( &StandardNodeGadget::error, this, ::_1, ::_2, ::_3 ) );
-	node->plugDirtiedSignal().connect( boost::bind( &StandardNodeGadget::plugDirtied, this, ::_1 ) );
+	node->plugsDirtiedSignal().connect( boost::bind( &StandardNodeGadget::plugsDirtied, this, ::_1 ) );
 
 	dragEnterSignal().connect( boost::bind( &StandardNodeGadget::dragEnter, this, ::_1, ::_2 ) );
 	dragMoveSignal().connect( boost::bind( &StandardNodeGadget::dragMove, this, ::_1, ::_2 ) );
@@ -420,6 +420,12 @@ bool StandardNodeGadget::hasLayer( Layer layer ) const
 	return layer != GraphLayer::Backdrops;
 }
 
+bool StandardNodeGadget::shouldRenderChild( const Gadget *child ) const
+{
+	const GraphGadget *graphGadget = parent<GraphGadget>();
+	return !graphGadget || !graphGadget->renderingLowDetail();
+}
+
 const Imath::Color3f *StandardNodeGadget::userColor() const
 {
 	return m_userColor.get_ptr();
@@ -608,12 +614,16 @@ bool StandardNodeGadget::getLabelsVisibleOnHover() const
 	return m_labelsVisibleOnHover;
 }
 
-void StandardNodeGadget::plugDirtied( const Gaffer::Plug *plug )
+void StandardNodeGadget::plugsDirtied( const std::vector<Gaffer::Plug *> &plugs )
 {
-	updateNodeEnabled( plug );
-	if( ErrorGadget *e = errorGadget( /* createIfMissing = */ false ) )
+	ErrorGadget *e = errorGadget( /* createIfMissing = */ false );
+	for( auto plug : plugs )
 	{
-		e->removeError( plug );
+		updateNodeEnabled( plug );
+		if( e )
+		{
+			e->removeError( plug );
+		}
 	}
 }
 
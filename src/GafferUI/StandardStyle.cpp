@@ -37,6 +37,8 @@
 
 #include "GafferUI/StandardStyle.h"
 
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
 #include "IECoreGL/Camera.h"
 #include "IECoreGL/CurvesPrimitive.h"
 #include "IECoreGL/Font.h"
@@ -63,6 +65,8 @@
 #include "boost/container/flat_map.hpp"
 #include "boost/tokenizer.hpp"
 
+#include <mutex>
+
 using namespace GafferUI;
 using namespace IECore;
 using namespace IECoreScene;
@@ -508,6 +512,92 @@ V3f auxiliaryConnectionArrowPosition( const Box2f &dstNodeFrame, const V3f &p, c
 
 } // namespace
 
+//////////////////////////////////////////////////////////////////////////
+// Text layout
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+struct GlyphRunCacheGetterKey
+{
+
+	GlyphRunCacheGetterKey( Style::TextType textType, const std::string &text )
+		:	textType( textType ), text( text )
+	{
+		hash.append( (int)textType );
+		hash.append( text );
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return hash;
+	}
+
+	const Style::TextType textType;
+	const std::string &text;
+	IECore::MurmurHash hash;
+
+};
+
+// Measured in glyphs.
+const size_t g_glyphRunCacheCost = 100000;
+
+// IECoreScene::Font builds its glyph meshes lazily, so must
+// not be used by several threads at once. This must be held for
+// all access to `IECoreGL::Font::coreFont()`, and to
+// `IECoreGL::Font::texture()`, which uses the core font.
+std::mutex g_coreFontMutex;
+
+void drawGlyphs( int positionSize, const float *positions, const V2f *uvs, size_t numVertices )
+{
+	if( !numVertices )
+	{
+		return;
+	}
+
+	glPushClientAttrib( GL_CLIENT_VERTEX_ARRAY_BIT );
+
+		glClientActiveTexture( GL_TEXTURE0 );
+		glEnableClientState( GL_VERTEX_ARRAY );
+		glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+		glVertexPointer( positionSize, GL_FLOAT, 0, positions );
+		glTexCoordPointer( 2, GL_FLOAT, 0, uvs );
+		glDrawArrays( GL_QUADS, 0, numVertices );
+
+	glPopClientAttrib();
+}
+
+} // namespace
+
+struct StandardStyle::GlyphRun
+{
+	Imath::Box3f bound;
+	// As above, but without the font scale applied.
+	Imath::Box2f unscaledBound;
+	// Four vertices per glyph, to be drawn as `GL_QUADS`.
+	std::vector<Imath::V2f> positions;
+	std::vector<Imath::V2f> uvs;
+};
+
+class StandardStyle::GlyphRunCache : public IECorePreview::LRUCache<IECore::MurmurHash, StandardStyle::ConstGlyphRunPtr, IECorePreview::LRUCachePolicy::Parallel, GlyphRunCacheGetterKey>
+{
+
+	public :
+
+		GlyphRunCache( const StandardStyle *style )
+			:	LRUCache(
+					[style] ( const GlyphRunCacheGetterKey &key, size_t &cost ) {
+						cost = std::max<size_t>( key.text.size(), 1 );
+						return style->computeGlyphRun( key.textType, key.text );
+					},
+					g_glyphRunCacheCost
+				)
+		{
+		}
+
+};
+
 //////////////////////////////////////////////////////////////////////////
 // StandardStyle
 //////////////////////////////////////////////////////////////////////////
@@ -515,7 +605,8 @@ V3f auxiliaryConnectionArrowPosition( const Box2f &dstNodeFrame, const V3f &p, c
 IE_CORE_DEFINERUNTIMETYPED( StandardStyle );
 
 StandardStyle::StandardStyle()
-	:	m_highlightState( new IECoreGL::State( /* complete = */ false ) )
+	:	m_highlightState( new IECoreGL::State( /* complete = */ false ) ),
+		m_glyphRunCache( new GlyphRunCache( this ) )
 {
 	setFont( LabelText, FontLoader::defaultFontLoader()->load( "VeraBd.ttf" ) );
 	setFontScale( LabelText, 1.0f );
@@ -565,7 +656,11 @@ void StandardStyle::bind( const Style *currentStyle ) const
 
 Imath::Box3f StandardStyle::characterBound( TextType textType ) const
 {
-	Imath::Box2f b = m_fonts[textType]->coreFont()->bound();
+	Imath::Box2f b;
+	{
+		std::lock_guard<std::mutex> lock( g_coreFontMutex );
+		b = m_fonts[textType]->coreFont()->bound();
+	}
 	return Imath::Box3f(
 		m_fontScales[textType] * Imath::V3f( b.min.x, b.min.y, 0 ),
 		m_fontScales[textType] * Imath::V3f( b.max.x, b.max.y, 0 )
@@ -574,18 +669,44 @@ Imath::Box3f StandardStyle::characterBound( TextType textType ) const
 
 Imath::Box3f StandardStyle::textBound( TextType textType, const std::string &text ) const
 {
-	Imath::Box2f b = m_fonts[textType]->coreFont()->bound( text );
-	return Imath::Box3f(
-		m_fontScales[textType] * Imath::V3f( b.min.x, b.min.y, 0 ),
-		m_fontScales[textType] * Imath::V3f( b.max.x, b.max.y, 0 )
-	);
+	return glyphRun( textType, text )->bound;
 }
 
 void StandardStyle::renderText( TextType textType, const std::string &text, State state, const Imath::Color4f *userColor ) const
+{
+	ConstGlyphRunPtr run = glyphRun( textType, text );
+	bindText( textType, state, userColor );
+	drawGlyphs( 2, reinterpret_cast<const float *>( run->positions.data() ), run->uvs.data(), run->positions.size() );
+}
+
+void StandardStyle::renderTextBatch( TextType textType, const std::vector<TextLabel> &labels, State state, const Imath::Color4f *userColor ) const
+{
+	// Transform all the glyphs into a single buffer, so they
+	// can be drawn in one call.
+	vector<V3f> positions;
+	vector<V2f> uvs;
+	for( const auto &label : labels )
+	{
+		ConstGlyphRunPtr run = glyphRun( textType, label.text );
+		for( const auto &p : run->positions )
+		{
+			positions.push_back( V3f( p.x, p.y, 0 ) * label.transform );
+		}
+		uvs.insert( uvs.end(), run->uvs.begin(), run->uvs.end() );
+	}
+
+	bindText( textType, state, userColor );
+	drawGlyphs( 3, reinterpret_cast<const float *>( positions.data() ), uvs.data(), positions.size() );
+}
+
+void StandardStyle::bindText( TextType textType, State state, const Imath::Color4f *userColor ) const
 {
 	glEnable( GL_TEXTURE_2D );
 	glActiveTexture( GL_TEXTURE0 );
-	m_fonts[textType]->texture()->bind();
+	{
+		std::lock_guard<std::mutex> lock( g_coreFontMutex );
+		m_fonts[textType]->texture()->bind();
+	}
 	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR );
 	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
 	glTexParameterf( GL_TEXTURE_2D, GL_TEXTURE_LOD_BIAS, -1.25 );
@@ -608,25 +729,22 @@ void StandardStyle::renderText( TextType textType, const std::string &text, Stat
 	{
 		glColor( colorForState( ForegroundColor, state ) );
 	}
-
-	glPushMatrix();
-
-		glScalef( m_fontScales[textType], m_fontScales[textType], m_fontScales[textType] );
-		m_fonts[textType]->renderSprites( text );
-
-	glPopMatrix();
 }
 
 void StandardStyle::renderWrappedText( TextType textType, const std::string &text, const Imath::Box2f &bound, State state ) const
 {
-	IECoreGL::Font *glFont = m_fonts[textType].get();
-	const IECoreScene::Font *coreFont = glFont->coreFont();
+	Box2f fontBound;
+	{
+		std::lock_guard<std::mutex> lock( g_coreFontMutex );
+		fontBound = m_fonts[textType]->coreFont()->bound();
+	}
 
-	const float spaceWidth = coreFont->bound().size().x * 0.25;
-	const float descent = coreFont->bound().min.y;
-	const float newlineHeight = coreFont->bound().size().y * 1.2;
+	const float spaceWidth = fontBound.size().x * 0.25;
+	const float descent = fontBound.min.y;
+	const float newlineHeight = fontBound.size().y * 1.2;
 
-	V2f cursor( bound.min.x, bound.max.y - coreFont->bound().size().y );
+	V2f cursor( bound.min.x, bound.max.y - fontBound.size().y );
+	vector<TextLabel> labels;
 
 	typedef boost::tokenizer<boost::char_separator<char> > Tokenizer;
 	boost::char_separator<char> separator( "", " \n\t" );
@@ -649,7 +767,7 @@ void StandardStyle::renderWrappedText( TextType textType, const std::string &tex
 		}
 		else
 		{
-			const float width = coreFont->bound( *it ).size().x;
+			const float width = glyphRun( textType, *it )->unscaledBound.size().x;
 			if( cursor.x + width > bound.max.x )
 			{
 				cursor.x = bound.min.x;
@@ -662,15 +780,14 @@ void StandardStyle::renderWrappedText( TextType textType, const std::string &tex
 				}
 			}
 
-			glPushMatrix();
-				glTranslatef( cursor.x, cursor.y, 0.0f );
-				renderText( textType, *it, state );
-				cursor.x += width;
-			glPopMatrix();
+			labels.push_back( { *it, M44f().translate( V3f( cursor.x, cursor.y, 0.0f ) ) } );
+			cursor.x += width;
 		}
 
 		++it;
 	}
+
+	renderTextBatch( textType, labels, state );
 }
 
 void StandardStyle::renderFrame( const Imath::Box2f &frame, float borderWidth, State state ) const
@@ -1114,6 +1231,7 @@ void StandardStyle::setFont( TextType textType, IECoreGL::FontPtr font )
 		return;
 	}
 	m_fonts[textType] = font;
+	m_glyphRunCache->clear();
 	changedSignal()( this );
 }
 
@@ -1129,6 +1247,7 @@ void StandardStyle::setFontScale( TextType textType, float scale )
 		return;
 	}
 	m_fontScales[textType] = scale;
+	m_glyphRunCache->clear();
 	changedSignal()( this );
 }
 
@@ -1137,6 +1256,66 @@ float StandardStyle::getFontScale( TextType textType ) const
 	return m_fontScales[textType];
 }
 
+StandardStyle::ConstGlyphRunPtr StandardStyle::glyphRun( TextType textType, const std::string &text ) const
+{
+	return m_glyphRunCache->get( GlyphRunCacheGetterKey( textType, text ) );
+}
+
+StandardStyle::ConstGlyphRunPtr StandardStyle::computeGlyphRun( TextType textType, const std::string &text ) const
+{
+	std::shared_ptr<GlyphRun> result = std::make_shared<GlyphRun>();
+	const float scale = m_fontScales[textType];
+
+	std::lock_guard<std::mutex> lock( g_coreFontMutex );
+	const IECoreScene::Font *coreFont = m_fonts[textType]->coreFont();
+
+	const Box2f bound = coreFont->bound( text );
+	result->unscaledBound = bound;
+	result->bound = Box3f(
+		scale * V3f( bound.min.x, bound.min.y, 0 ),
+		scale * V3f( bound.max.x, bound.max.y, 0 )
+	);
+
+	// We draw each glyph as a sprite from the font texture, in the same way
+	// as `IECoreGL::Font::renderSprites()`. The texture contains a grid of
+	// 16x8 cells holding the first 128 characters, with each cell covering
+	// the bound of the font.
+
+	const Box2f cellBound = coreFont->bound();
+	result->positions.reserve( text.size() * 4 );
+	result->uvs.reserve( text.size() * 4 );
+
+	V2f cursor( 0 );
+	for( size_t i = 0, e = text.size(); i < e; ++i )
+	{
+		const unsigned char c = text[i];
+		if( c < 128 )
+		{
+			const V2f pMin = ( cursor + cellBound.min ) * scale;
+			const V2f pMax = ( cursor + cellBound.max ) * scale;
+			const V2f uvMin( ( c % 16 ) / 16.0f, 1.0f - ( c / 16 + 1 ) / 8.0f );
+			const V2f uvMax( uvMin.x + 1.0f / 16.0f, uvMin.y + 1.0f / 8.0f );
+
+			result->positions.push_back( pMin );
+			result->positions.push_back( V2f( pMax.x, pMin.y ) );
+			result->positions.push_back( pMax );
+			result->positions.push_back( V2f( pMin.x, pMax.y ) );
+
+			result->uvs.push_back( uvMin );
+			result->uvs.push_back( V2f( uvMax.x, uvMin.y ) );
+			result->uvs.push_back( uvMax );
+			result->uvs.push_back( V2f( uvMin.x, uvMax.y ) );
+		}
+
+		if( i + 1 < e )
+		{
+			cursor += coreFont->advance( text[i], text[i+1] );
+		}
+	}
+
+	return result;
+}
+
 void StandardStyle::renderConnectionInternal( const Imath::V3f &srcPosition, const Imath::V3f &srcTangent, const Imath::V3f &dstPosition, const Imath::V3f &dstTangent ) const
 {
 	glUniform1i( g_isCurveParameter, 1 );
@@ -56,6 +56,17 @@ Style::~Style()
 {
 }
 
+void Style::renderTextBatch( TextType textType, const std::vector<TextLabel> &labels, State state, const Imath::Color4f *userColor ) const
+{
+	for( const auto &label : labels )
+	{
+		glPushMatrix();
+			glMultMatrixf( label.transform.getValue() );
+			renderText( textType, label.text, state, userColor );
+		glPopMatrix();
+	}
+}
+
 Style::UnarySignal &Style::changedSignal()
 {
 	return m_changedSignal;
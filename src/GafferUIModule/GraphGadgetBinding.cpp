@@ -161,6 +161,32 @@ list unpositionedNodeGadgets( GraphGadget &graphGadget )
 	return l;
 }
 
+list nodeGadgetsInRegion( GraphGadget &graphGadget, const Imath::Box2f &region )
+{
+	std::vector<NodeGadget *> nodeGadgets;
+	graphGadget.nodeGadgetsInRegion( region, nodeGadgets );
+
+	boost::python::list l;
+	for( auto nodeGadget : nodeGadgets )
+	{
+		l.append( NodeGadgetPtr( nodeGadget ) );
+	}
+	return l;
+}
+
+list connectionGadgetsInRegion( GraphGadget &graphGadget, const Imath::Box2f &region )
+{
+	std::vector<ConnectionGadget *> connectionGadgets;
+	graphGadget.connectionGadgetsInRegion( region, connectionGadgets );
+
+	boost::python::list l;
+	for( auto connectionGadget : connectionGadgets )
+	{
+		l.append( ConnectionGadgetPtr( connectionGadget ) );
+	}
+	return l;
+}
+
 void setNodePosition( GraphGadget &graphGadget, Gaffer::Node &node, const Imath::V2f &position )
 {
 	IECorePython::ScopedGILRelease gilRelease;
@@ -247,6 +273,8 @@ void GafferUIModule::bindGraphGadget()
 			.def( "getLayout", (GraphLayout *(GraphGadget::*)())&GraphGadget::getLayout, return_value_policy<CastToIntrusivePtr>() )
 			.def( "nodeGadgetAt", &GraphGadget::nodeGadgetAt, return_value_policy<CastToIntrusivePtr>() )
 			.def( "connectionGadgetAt", &GraphGadget::connectionGadgetAt, return_value_policy<CastToIntrusivePtr>() )
+			.def( "nodeGadgetsInRegion", &nodeGadgetsInRegion )
+			.def( "connectionGadgetsInRegion", &connectionGadgetsInRegion )
 		;
 
 		GafferBindings::SignalClass<GraphGadget::RootChangedSignal, GafferBindings::DefaultSignalCaller<GraphGadget::RootChangedSignal>, RootChangedSlotCaller>( "RootChangedSignal" );
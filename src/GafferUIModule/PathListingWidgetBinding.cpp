@@ -38,7 +38,9 @@
 
 #include "PathListingWidgetBinding.h"
 
+#include "Gaffer/BackgroundTask.h"
 #include "Gaffer/FileSystemPath.h"
+#include "Gaffer/ParallelAlgo.h"
 #include "Gaffer/Path.h"
 #include "Gaffer/Private/IECorePreview/LRUCache.h"
 
@@ -68,6 +70,11 @@
 	#include "QtGui/QFileIconProvider"
 #endif
 
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <unordered_map>
+
 using namespace boost::python;
 using namespace boost::posix_time;
 using namespace Gaffer;
@@ -335,10 +342,69 @@ class FileIconColumn : public Column
 
 IE_CORE_DECLAREPTR( FileIconColumn )
 
+// Ordering used when sorting items by the value of a column.
+bool variantLess( const QVariant &left, const QVariant &right )
+{
+	switch( left.userType() )
+	{
+		case QVariant::Invalid :
+			return right.type() != QVariant::Invalid;
+		case QVariant::Int :
+			return left.toInt() < right.toInt();
+		case QVariant::UInt :
+			return left.toUInt() < right.toUInt();
+		case QVariant::LongLong:
+			return left.toLongLong() < right.toLongLong();
+		case QVariant::ULongLong:
+			return left.toULongLong() < right.toULongLong();
+		case QMetaType::Float:
+			return left.toFloat() < right.toFloat();
+		case QVariant::Double:
+			return left.toDouble() < right.toDouble();
+		case QVariant::Char:
+			return left.toChar() < right.toChar();
+		case QVariant::Date:
+			return left.toDate() < right.toDate();
+		case QVariant::Time:
+			return left.toTime() < right.toTime();
+		case QVariant::DateTime:
+			return left.toDateTime() < right.toDateTime();
+		default :
+			return left.toString().compare( right.toString() ) < 0;
+	}
+}
+
+// Calls `column->data()`, suppressing exceptions because Qt doesn't
+// use them for error handling.
+QVariant columnData( const Column *column, const Path *path, int role )
+{
+	try
+	{
+		return column->data( path, role );
+	}
+	catch( const std::exception &e )
+	{
+		IECore::msg( IECore::Msg::Warning, "PathListingWidget", e.what() );
+	}
+	catch( ... )
+	{
+		IECore::msg( IECore::Msg::Warning, "PathListingWidget", "Unknown error" );
+	}
+	return QVariant();
+}
+
 // A QAbstractItemModel for the navigation of Gaffer::Paths.
 // This allows us to view Paths in QTreeViews. This forms part
 // of the internal implementation of PathListingWidget, the rest
 // of which is implemented in Python.
+//
+// Children are listed, and sorted, by BackgroundTasks launched
+// when Qt first asks about them, so that large hierarchies don't
+// block the UI. Qt only sees an item's children once the task has
+// completed. Data for the columns is only generated for the items
+// that Qt asks to display. The methods used to find items by path
+// list children synchronously instead, because their callers need
+// immediate answers.
 class PathModel : public QAbstractItemModel
 {
 
@@ -356,12 +422,31 @@ class PathModel : public QAbstractItemModel
 				m_rootItem( new Item( nullptr, 0, nullptr ) ),
 				m_flat( true ),
 				m_sortColumn( -1 ),
-				m_sortOrder( Qt::AscendingOrder )
+				m_sortOrder( Qt::AscendingOrder ),
+				m_finishedUpdates( std::make_shared<FinishedUpdates>( this ) )
 		{
 		}
 
 		~PathModel() override
 		{
+			// Stop any pending UI thread calls from referencing us, and
+			// cancel all our tasks.
+			m_finishedUpdates->model = nullptr;
+			retireAllChildUpdates();
+
+			// We may be destroyed from Python or from the Qt event loop, so
+			// don't know if we hold the GIL. Make sure we do, so that Python
+			// Paths can be released safely, but release it while waiting for
+			// the tasks, since they may need it to list Python Paths.
+			IECorePython::ScopedGILLock gilLock;
+			{
+				IECorePython::ScopedGILRelease gilRelease;
+				for( const auto &update : m_retiredUpdates )
+				{
+					update->task->wait();
+				}
+			}
+			m_retiredUpdates.clear();
 			delete m_rootItem;
 		}
 
@@ -387,6 +472,8 @@ class PathModel : public QAbstractItemModel
 
 		void setRoot( PathPtr root )
 		{
+			// Any updates in flight refer to items we are about to delete.
+			retireAllChildUpdates();
 			beginResetModel();
 			delete m_rootItem;
 			m_rootItem = new Item( root, 0, nullptr );
@@ -443,7 +530,7 @@ class PathModel : public QAbstractItemModel
 			for( size_t i = rootPath->names().size(); i < path.size(); ++i )
 			{
 				bool foundNextItem = false;
-				const std::vector<Item *> &childItems = item->childItems( this );
+				const std::vector<Item *> &childItems = this->childItems( item );
 				for( std::vector<Item *>::const_iterator it = childItems.begin(), eIt = childItems.end(); it != eIt; ++it )
 				{
 					if( (*it)->path()->names()[i] == path[i] )
@@ -481,6 +568,18 @@ class PathModel : public QAbstractItemModel
 			return result;
 		}
 
+		// As for `rowCount()`, but listing the children
+		// immediately if they are not available yet.
+		int childCount( const QModelIndex &parentIndex )
+		{
+			Item *item = itemForIndex( parentIndex );
+			if( item == m_rootItem || !m_flat )
+			{
+				return childItems( item ).size();
+			}
+			return 0;
+		}
+
 		///////////////////////////////////////////////////////////////////
 		// QAbstractItemModel implementation - this is what Qt cares about
 		///////////////////////////////////////////////////////////////////
@@ -507,10 +606,10 @@ class PathModel : public QAbstractItemModel
 
 		QModelIndex index( int row, int column, const QModelIndex &parentIndex = QModelIndex() ) const override
 		{
-			Item *item = parentIndex.isValid() ? static_cast<Item *>( parentIndex.internalPointer() ) : m_rootItem;
-			if( row >=0 and row < (int)item->childItems( this ).size() and column >=0 and column < (int)m_columns.size() )
+			Item *item = itemForIndex( parentIndex );
+			if( row >=0 and row < (int)item->childItems().size() and column >=0 and column < (int)m_columns.size() )
 			{
-				return createIndex( row, column, item->childItems( this )[row] );
+				return createIndex( row, column, item->childItems()[row] );
 			}
 			else
 			{
@@ -531,19 +630,48 @@ class PathModel : public QAbstractItemModel
 				return QModelIndex();
 			}
 
-			return createIndex( item->parent()->row(), 0, item->parent() );
+			return indexForItem( item->parent() );
 		}
 
 		int rowCount( const QModelIndex &parentIndex = QModelIndex() ) const override
 		{
-			Item *item = parentIndex.isValid() ? static_cast<Item *>( parentIndex.internalPointer() ) : m_rootItem;
+			Item *item = itemForIndex( parentIndex );
 			if( item == m_rootItem || !m_flat )
 			{
-				return item->childItems( this ).size();
+				const_cast<PathModel *>( this )->requestChildUpdate( item );
+				return item->childItems().size();
 			}
 			return 0;
 		}
 
+		bool hasChildren( const QModelIndex &parentIndex = QModelIndex() ) const override
+		{
+			Item *item = itemForIndex( parentIndex );
+			if( item != m_rootItem && m_flat )
+			{
+				return false;
+			}
+
+			if( item->childItemsDone() || !item->path() )
+			{
+				return item->childItems().size();
+			}
+
+			// Start listing the children now, so that they are likely to
+			// be ready if the user expands the item. Until then, we must
+			// answer without them.
+			const_cast<PathModel *>( this )->requestChildUpdate( item );
+			try
+			{
+				return !item->path()->isLeaf();
+			}
+			catch( const std::exception &e )
+			{
+				IECore::msg( IECore::Msg::Error, "PathListingWidget", e.what() );
+				return false;
+			}
+		}
+
 		int columnCount( const QModelIndex &parent = QModelIndex() ) const override
 		{
 			return m_columns.size();
@@ -553,26 +681,25 @@ class PathModel : public QAbstractItemModel
 		// sort it right now", it seems really to also mean "and remember that
 		// this is how you should sort all other stuff you might generate later".
 		// So that's what we do. We also use a column of < 0 to say "turn off
-		// sorting".
+		// sorting". The sorting itself is performed in the background.
 		void sort( int column, Qt::SortOrder order = Qt::AscendingOrder ) override
 		{
 			m_sortColumn = column;
 			m_sortOrder = order;
 
-			if( m_sortColumn < 0 )
+			if( !sortColumn() )
 			{
 				return;
 			}
 
-			layoutAboutToBeChanged();
-			m_rootItem->sort( this );
-			layoutChanged();
+			sortWalk( m_rootItem );
 		}
 
 	private :
 
 		// A single item in the PathModel - stores a path and caches
-		// data extracted from it to provide the model content.
+		// data extracted from it to provide the model content. All
+		// access is from the UI thread.
 		struct Item
 		{
 
@@ -604,6 +731,11 @@ class PathModel : public QAbstractItemModel
 				return m_row;
 			}
 
+			void setRow( int row )
+			{
+				m_row = row;
+			}
+
 			// Returns the data for the specified column and role, using the provided
 			// Columns to generate it as necessary. The Item is responsible for caching
 			// the results of these queries internally.
@@ -624,175 +756,474 @@ class PathModel : public QAbstractItemModel
 				}
 			}
 
-			std::vector<Item *> &childItems( const PathModel *model )
+			// True if the children have been listed, either by
+			// a ChildUpdate or by `PathModel::childItems()`.
+			bool childItemsDone() const
+			{
+				return m_childItemsDone;
+			}
+
+			// The children listed so far. Empty if `childItemsDone()`
+			// is false.
+			std::vector<Item *> &childItems()
+			{
+				return m_childItems;
+			}
+
+			void setChildItems( std::vector<Item *> &childItems )
 			{
-				if( !m_childItemsDone && m_path )
+				assert( !m_childItemsDone );
+				m_childItems.swap( childItems );
+				m_childItemsDone = true;
+			}
+
+			private :
+
+				void ensureData( const std::vector<ColumnPtr> &columns )
 				{
-					std::vector<Gaffer::PathPtr> children;
-					try
+					if( m_dataDone )
 					{
-						m_path->children( children );
+						return;
 					}
-					catch( const std::exception &e )
+
+					m_displayData.reserve( columns.size() );
+					m_decorationData.reserve( columns.size() );
+					for( int i = 0, e = columns.size(); i < e; ++i )
 					{
-						IECore::msg( IECore::Msg::Error, "PathListingWidget", e.what() );
+						m_displayData.push_back( columnData( columns[i].get(), m_path.get(), Qt::DisplayRole ) );
+						m_decorationData.push_back( columnData( columns[i].get(), m_path.get(), Qt::DecorationRole ) );
 					}
 
-					for( std::vector<Gaffer::PathPtr>::const_iterator it = children.begin(), eIt = children.end(); it != eIt; ++it )
+					m_dataDone = true;
+				}
+
+				Gaffer::PathPtr m_path;
+				Item *m_parent;
+				int m_row;
+
+				bool m_dataDone;
+				std::vector<QVariant> m_displayData;
+				std::vector<QVariant> m_decorationData;
+
+				bool m_childItemsDone;
+				std::vector<Item *> m_childItems;
+
+		};
+
+		// Lists and/or sorts the children of an Item using a BackgroundTask.
+		// The task only accesses `path`, `sortColumn`, `sortOrder`, `children`
+		// and `order`. Everything else belongs to the UI thread.
+		struct ChildUpdate
+		{
+
+			ChildUpdate( Item *item, const Column *sortColumn, Qt::SortOrder sortOrder )
+				:	item( item ), path( item->path() ), sortColumn( sortColumn ), sortOrder( sortOrder ),
+					listChildren( !item->childItemsDone() )
+			{
+				if( !listChildren )
+				{
+					// We're just resorting the existing children.
+					items = item->childItems();
+					children.reserve( items.size() );
+					for( auto childItem : items )
 					{
-						m_childItems.push_back( new Item( *it, it - children.begin(), this ) );
+						children.push_back( childItem->path() );
 					}
-					// If the model is sorted, then we need to apply that same
-					// sorting to the new items - see comment for PathModel::sort().
-					sort( model );
 				}
-				m_childItemsDone = true;
-				return m_childItems;
 			}
 
-			void sort( const PathModel *model )
+			Item *item;
+			const Gaffer::ConstPathPtr path;
+			const ConstColumnPtr sortColumn;
+			const Qt::SortOrder sortOrder;
+			const bool listChildren;
+			// The existing children, when resorting.
+			std::vector<Item *> items;
+
+			std::vector<Gaffer::PathPtr> children;
+			// Sorted order for `children`. Empty if unsorted.
+			std::vector<size_t> order;
+
+			// Declared last, so that it is destroyed first, waiting
+			// for the task to finish before the members it uses.
+			std::unique_ptr<Gaffer::BackgroundTask> task;
+
+		};
+
+		typedef std::shared_ptr<ChildUpdate> ChildUpdatePtr;
+
+		// Shared with the BackgroundTasks, so they can queue completed
+		// updates to be applied in batches on the UI thread.
+		struct FinishedUpdates
+		{
+
+			FinishedUpdates( PathModel *model )
+				:	model( model )
 			{
-				if( model->m_sortColumn < 0 || model->m_sortColumn >= model->columnCount() )
-				{
-					return;
-				}
+			}
+
+			// Only accessed on the UI thread, and set to null
+			// when the model is destroyed.
+			PathModel *model;
+
+			std::mutex mutex;
+			std::vector<std::weak_ptr<ChildUpdate>> updates;
 
-				if( !m_childItems.size() )
+		};
+
+		Item *itemForIndex( const QModelIndex &index ) const
+		{
+			return index.isValid() ? static_cast<Item *>( index.internalPointer() ) : m_rootItem;
+		}
+
+		QModelIndex indexForItem( Item *item ) const
+		{
+			return item == m_rootItem ? QModelIndex() : createIndex( item->row(), 0, item );
+		}
+
+		const Column *sortColumn() const
+		{
+			if( m_sortColumn < 0 || m_sortColumn >= (int)m_columns.size() )
+			{
+				return nullptr;
+			}
+			return m_columns[m_sortColumn].get();
+		}
+
+		// Returns the children of `item`, listing them immediately
+		// if they are not available yet.
+		std::vector<Item *> &childItems( Item *item )
+		{
+			if( item->childItemsDone() || !item->path() )
+			{
+				return item->childItems();
+			}
+
+			// We're doing the work ourselves, so don't need
+			// any update that may be in flight.
+			retireChildUpdate( item );
+
+			std::vector<Gaffer::PathPtr> children;
+			try
+			{
+				item->path()->children( children );
+			}
+			catch( const std::exception &e )
+			{
+				IECore::msg( IECore::Msg::Error, "PathListingWidget", e.what() );
+			}
+
+			std::vector<Item *> childItems;
+			childItems.reserve( children.size() );
+			for( size_t i = 0; i < children.size(); ++i )
+			{
+				childItems.push_back( new Item( children[i], i, item ) );
+			}
+
+			// If the model is sorted, then we need to apply that same
+			// sorting to the new items - see comment for PathModel::sort().
+			if( const Column *column = sortColumn() )
+			{
+				std::vector<QVariant> values;
+				values.reserve( childItems.size() );
+				for( auto childItem : childItems )
 				{
-					return;
+					values.push_back( columnData( column, childItem->path(), Qt::DisplayRole ) );
 				}
-
-				SortableItems sortableChildren;
-				sortableChildren.reserve( m_childItems.size() );
-				for( int i = 0, e = m_childItems.size(); i < e; ++i )
+				std::vector<Item *> unsortedItems = childItems;
+				const std::vector<size_t> order = sortedOrder( values, m_sortOrder );
+				for( size_t i = 0; i < order.size(); ++i )
 				{
-					m_childItems[i]->ensureData( model->getColumns() );
-					sortableChildren.push_back( SortableItem( m_childItems[i], i ) );
+					childItems[i] = unsortedItems[order[i]];
+					childItems[i]->setRow( i );
 				}
+			}
 
-				std::sort( sortableChildren.begin(), sortableChildren.end(), Less( model->m_sortColumn ) );
+			setChildItems( item, childItems );
+			return item->childItems();
+		}
 
-				const bool reverse = model->m_sortOrder == Qt::DescendingOrder;
-				QModelIndexList changedPersistentIndexesFrom, changedPersistentIndexesTo;
-				for( int i = 0, e = sortableChildren.size(); i < e; ++i )
-				{
-					int fromRow = sortableChildren[i].second;
-					int toRow = reverse ? e - i - 1 : i;
-					m_childItems[toRow] = sortableChildren[i].first;
-					for( int c = 0, ce = model->getColumns().size(); c < ce; ++c )
-					{
-						changedPersistentIndexesFrom.append( model->createIndex( fromRow, c, sortableChildren[i].first ) );
-						changedPersistentIndexesTo.append( model->createIndex( toRow, c, sortableChildren[i].first ) );
-					}
+		// Sets the children for an item, notifying Qt if they are visible.
+		void setChildItems( Item *item, std::vector<Item *> &childItems )
+		{
+			const bool notify = childItems.size() && ( item == m_rootItem || !m_flat );
+			if( notify )
+			{
+				beginInsertRows( indexForItem( item ), 0, childItems.size() - 1 );
+			}
+			item->setChildItems( childItems );
+			if( notify )
+			{
+				endInsertRows();
+			}
+		}
+
+		static std::vector<size_t> sortedOrder( const std::vector<QVariant> &values, Qt::SortOrder sortOrder )
+		{
+			std::vector<size_t> result( values.size() );
+			std::iota( result.begin(), result.end(), 0 );
+			std::sort(
+				result.begin(), result.end(),
+				[&values] ( size_t a, size_t b ) {
+					return variantLess( values[a], values[b] );
 				}
+			);
+			if( sortOrder == Qt::DescendingOrder )
+			{
+				std::reverse( result.begin(), result.end() );
+			}
+			return result;
+		}
 
-				const_cast<PathModel *>( model )->changePersistentIndexList( changedPersistentIndexesFrom, changedPersistentIndexesTo );
+		void sortWalk( Item *item )
+		{
+			if( !item->path() )
+			{
+				return;
+			}
 
-				for( std::vector<Item *>::const_iterator it = m_childItems.begin(), eIt = m_childItems.end(); it != eIt; ++it )
+			if( !item->childItemsDone() )
+			{
+				// Relaunch any update in flight, so that it
+				// uses the new sort order.
+				if( m_childUpdates.count( item ) )
 				{
-					(*it)->sort( model );
+					launchChildUpdate( item );
 				}
+				return;
 			}
 
-			private :
+			if( item->childItems().size() > 1 )
+			{
+				launchChildUpdate( item );
+			}
 
-				typedef std::pair<Item *, size_t> SortableItem;
-				typedef std::vector<SortableItem> SortableItems;
+			for( auto childItem : item->childItems() )
+			{
+				sortWalk( childItem );
+			}
+		}
 
-				void ensureData( const std::vector<ColumnPtr> &columns )
-				{
-					if( m_dataDone )
-					{
-						return;
-					}
+		// Launches a ChildUpdate for `item` if one isn't already
+		// in flight and the children are not yet available.
+		void requestChildUpdate( Item *item )
+		{
+			if( item->childItemsDone() || !item->path() || m_childUpdates.count( item ) )
+			{
+				return;
+			}
+			launchChildUpdate( item );
+		}
 
-					m_displayData.reserve( columns.size() );
-					m_decorationData.reserve( columns.size() );
-					for( int i = 0, e = columns.size(); i < e; ++i )
-					{
-						QVariant displayData;
-						QVariant decorationData;
-						try
-						{
-							displayData = columns[i]->data( m_path.get(), Qt::DisplayRole );
-							decorationData = columns[i]->data( m_path.get(), Qt::DecorationRole );
-						}
-						catch( const std::exception &e )
+		// Launches a ChildUpdate for `item`, replacing any
+		// that is already in flight.
+		void launchChildUpdate( Item *item )
+		{
+			retireChildUpdate( item );
+			sweepRetiredUpdates();
+
+			ChildUpdatePtr update = std::make_shared<ChildUpdate>( item, sortColumn(), m_sortOrder );
+			m_childUpdates[item] = update;
+
+			std::weak_ptr<ChildUpdate> weakUpdate( update );
+			std::shared_ptr<FinishedUpdates> finishedUpdates = m_finishedUpdates;
+			ChildUpdate *u = update.get();
+
+			update->task.reset(
+				new Gaffer::BackgroundTask(
+					update->path->cancellationSubject(),
+					[u, weakUpdate, finishedUpdates] ( const IECore::Canceller &canceller ) {
+						runChildUpdate( *u, canceller );
+						bool first;
 						{
-							// Qt doesn't use exceptions for error handling,
-							// so we must suppress them.
-							IECore::msg( IECore::Msg::Warning, "PathListingWidget", e.what() );
+							std::lock_guard<std::mutex> lock( finishedUpdates->mutex );
+							finishedUpdates->updates.push_back( weakUpdate );
+							first = finishedUpdates->updates.size() == 1;
 						}
-						catch( ... )
+						if( first )
 						{
-							IECore::msg( IECore::Msg::Warning, "PathListingWidget", "Unknown error" );
+							// Later updates will be applied by the same call, until it
+							// takes the queue.
+							Gaffer::ParallelAlgo::callOnUIThread(
+								[finishedUpdates] {
+									if( finishedUpdates->model )
+									{
+										finishedUpdates->model->applyFinishedUpdates();
+									}
+								}
+							);
 						}
-
-						m_displayData.push_back( displayData );
-						m_decorationData.push_back( decorationData );
 					}
+				)
+			);
+		}
 
-					m_dataDone = true;
+		// Called on a background thread.
+		static void runChildUpdate( ChildUpdate &update, const IECore::Canceller &canceller )
+		{
+			IECore::Canceller::check( &canceller );
+			if( update.listChildren )
+			{
+				try
+				{
+					update.path->children( update.children );
+				}
+				catch( const std::exception &e )
+				{
+					IECore::msg( IECore::Msg::Error, "PathListingWidget", e.what() );
 				}
+			}
+
+			if( !update.sortColumn || update.children.size() < 2 )
+			{
+				return;
+			}
+
+			// We only need data for the column we are sorting by. Data for the
+			// other columns is generated later, for only the visible items.
+			std::vector<QVariant> values;
+			values.reserve( update.children.size() );
+			for( const auto &child : update.children )
+			{
+				IECore::Canceller::check( &canceller );
+				values.push_back( columnData( update.sortColumn.get(), child.get(), Qt::DisplayRole ) );
+			}
 
-				struct Less
+			update.order = sortedOrder( values, update.sortOrder );
+		}
+
+		void applyFinishedUpdates()
+		{
+			std::vector<std::weak_ptr<ChildUpdate>> finished;
+			{
+				std::lock_guard<std::mutex> lock( m_finishedUpdates->mutex );
+				finished.swap( m_finishedUpdates->updates );
+			}
+
+			std::vector<ChildUpdatePtr> resorts;
+			bool layoutChangeRequired = false;
+			for( const auto &weakUpdate : finished )
+			{
+				ChildUpdatePtr update = weakUpdate.lock();
+				if( !update )
 				{
-					Less( int column )
-						:	m_column( column )
-					{
-					}
+					continue;
+				}
 
-					bool operator () ( const SortableItem &leftItem, const SortableItem &rightItem )
-					{
-						const QVariant &left = leftItem.first->m_displayData[m_column];
-						const QVariant &right = rightItem.first->m_displayData[m_column];
-						switch( left.userType() )
-						{
-							case QVariant::Invalid :
-								return right.type() != QVariant::Invalid;
-							case QVariant::Int :
-								return left.toInt() < right.toInt();
-							case QVariant::UInt :
-								return left.toUInt() < right.toUInt();
-							case QVariant::LongLong:
-								return left.toLongLong() < right.toLongLong();
-							case QVariant::ULongLong:
-								return left.toULongLong() < right.toULongLong();
-							case QMetaType::Float:
-								return left.toFloat() < right.toFloat();
-							case QVariant::Double:
-								return left.toDouble() < right.toDouble();
-							case QVariant::Char:
-								return left.toChar() < right.toChar();
-							case QVariant::Date:
-								return left.toDate() < right.toDate();
-							case QVariant::Time:
-								return left.toTime() < right.toTime();
-							case QVariant::DateTime:
-								return left.toDateTime() < right.toDateTime();
-							default :
-								return left.toString().compare( right.toString() ) < 0;
-						}
-					}
+				auto it = m_childUpdates.find( update->item );
+				if( it == m_childUpdates.end() || it->second != update )
+				{
+					// Superseded by another update.
+					continue;
+				}
+				retireChildUpdate( update->item );
 
-					private :
+				if( !update->listChildren )
+				{
+					resorts.push_back( update );
+					layoutChangeRequired = true;
+					continue;
+				}
 
-						int m_column;
+				Item *item = update->item;
+				std::vector<Item *> childItems;
+				childItems.reserve( update->children.size() );
+				for( size_t i = 0; i < update->children.size(); ++i )
+				{
+					const size_t index = update->order.size() ? update->order[i] : i;
+					childItems.push_back( new Item( update->children[index], i, item ) );
+				}
+				update->children.clear();
 
-				};
+				if( childItems.empty() && item != m_rootItem && !m_flat )
+				{
+					// Qt may have been told the item has children in
+					// `hasChildren()`, so must lay it out again.
+					layoutChangeRequired = true;
+				}
+				setChildItems( item, childItems );
+			}
 
-				Gaffer::PathPtr m_path;
-				Item *m_parent;
-				int m_row;
+			if( layoutChangeRequired )
+			{
+				layoutAboutToBeChanged();
+				for( const auto &update : resorts )
+				{
+					applyOrder( *update );
+				}
+				layoutChanged();
+			}
 
-				bool m_dataDone;
-				std::vector<QVariant> m_displayData;
-				std::vector<QVariant> m_decorationData;
+			sweepRetiredUpdates();
+		}
 
-				bool m_childItemsDone;
-				std::vector<Item *> m_childItems;
+		void applyOrder( const ChildUpdate &update )
+		{
+			std::vector<Item *> &childItems = update.item->childItems();
+			if( childItems != update.items || update.order.size() != childItems.size() )
+			{
+				return;
+			}
 
-		};
+			QModelIndexList changedPersistentIndexesFrom, changedPersistentIndexesTo;
+			for( size_t i = 0; i < childItems.size(); ++i )
+			{
+				Item *childItem = update.items[update.order[i]];
+				childItems[i] = childItem;
+				for( int c = 0, ce = m_columns.size(); c < ce; ++c )
+				{
+					changedPersistentIndexesFrom.append( createIndex( childItem->row(), c, childItem ) );
+					changedPersistentIndexesTo.append( createIndex( i, c, childItem ) );
+				}
+				childItem->setRow( i );
+			}
+
+			changePersistentIndexList( changedPersistentIndexesFrom, changedPersistentIndexesTo );
+		}
+
+		// Cancels the update for `item`, keeping it alive until the task
+		// has finished, so the UI thread never has to wait for it.
+		void retireChildUpdate( Item *item )
+		{
+			auto it = m_childUpdates.find( item );
+			if( it == m_childUpdates.end() )
+			{
+				return;
+			}
+			it->second->task->cancel();
+			m_retiredUpdates.push_back( it->second );
+			m_childUpdates.erase( it );
+		}
+
+		void retireAllChildUpdates()
+		{
+			for( const auto &update : m_childUpdates )
+			{
+				update.second->task->cancel();
+				m_retiredUpdates.push_back( update.second );
+			}
+			m_childUpdates.clear();
+		}
+
+		void sweepRetiredUpdates()
+		{
+			m_retiredUpdates.erase(
+				std::remove_if(
+					m_retiredUpdates.begin(), m_retiredUpdates.end(),
+					[] ( const ChildUpdatePtr &update ) {
+						switch( update->task->status() )
+						{
+							case Gaffer::BackgroundTask::Pending :
+							case Gaffer::BackgroundTask::Running :
+								return false;
+							default :
+								return true;
+						}
+					}
+				),
+				m_retiredUpdates.end()
+			);
+		}
 
 		void indicesForPathsWalk( Item *item, const QModelIndex &itemIndex, const IECore::PathMatcher &paths, std::vector<QModelIndex> &indices )
 		{
@@ -812,7 +1243,7 @@ class PathModel : public QAbstractItemModel
 			}
 
 			size_t row = 0;
-			for( const auto &childItem : item->childItems( this ) )
+			for( const auto &childItem : childItems( item ) )
 			{
 				const QModelIndex childIndex = index( row++, 0, itemIndex );
 				indicesForPathsWalk( childItem, childIndex, paths, indices );
@@ -825,6 +1256,10 @@ class PathModel : public QAbstractItemModel
 		int m_sortColumn;
 		Qt::SortOrder m_sortOrder;
 
+		std::unordered_map<Item *, ChildUpdatePtr> m_childUpdates;
+		std::vector<ChildUpdatePtr> m_retiredUpdates;
+		std::shared_ptr<FinishedUpdates> m_finishedUpdates;
+
 };
 
 void setColumns( uint64_t treeViewAddress, object pythonColumns )
@@ -918,7 +1353,7 @@ IECore::PathMatcher getExpansion( uint64_t treeViewAddress )
 
 void propagateExpandedWalk( QTreeView *treeView, PathModel *model, QModelIndex index, bool expanded, int numLevels )
 {
-	for( int i = 0, e = model->rowCount( index ); i < e; ++i )
+	for( int i = 0, e = model->childCount( index ); i < e; ++i )
 	{
 		QModelIndex childIndex = model->index( i, 0, index );
 		treeView->setExpanded( childIndex, expanded );
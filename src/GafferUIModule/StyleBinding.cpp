@@ -135,6 +135,8 @@ void GafferUIModule::bindStyle()
 			.def( "getColor", &StandardStyle::getColor, return_value_policy<copy_const_reference>() )
 			.def( "setFont", &StandardStyle::setFont )
 			.def( "getFont", &getFont )
+			.def( "setFontScale", &StandardStyle::setFontScale )
+			.def( "getFontScale", &StandardStyle::getFontScale )
 		;
 
 		enum_<StandardStyle::Color>( "Color" )